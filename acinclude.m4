@@ -6,6 +6,10 @@ dnl Function to detect if libfsapfs dependencies are available
 AC_DEFUN([AX_LIBFSAPFS_CHECK_LOCAL],
   [dnl Check for internationalization functions in libfsapfs/libfsapfs_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Check for memory mapping functions in libfsapfs/libfsapfs_mapped_file.c
+  AC_CHECK_HEADERS([sys/mman.h sys/stat.h])
+  AC_CHECK_FUNCS([madvise mmap munmap])
 ])
 
 dnl Function to check if DLL support is needed
@@ -484,6 +484,10 @@ int main( int argc, char * const argv[] )
 	fsapfsmount_fuse_operations.readlink   = &mount_fuse_readlink;
 	fsapfsmount_fuse_operations.destroy    = &mount_fuse_destroy;
 
+#if defined( MOUNT_FUSE_HAVE_LSEEK )
+	fsapfsmount_fuse_operations.lseek      = &mount_fuse_lseek;
+#endif
+
 #if defined( HAVE_LIBFUSE3 )
 	fsapfsmount_fuse_handle = fuse_new(
 	                           &fsapfsmount_fuse_arguments,
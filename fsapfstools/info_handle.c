@@ -3883,6 +3883,143 @@ on_error:
 	return( -1 );
 }
 
+/* Prints the volume cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int info_handle_volume_cache_statistics_fprint(
+     info_handle_t *info_handle,
+     libfsapfs_volume_t *volume,
+     libcerror_error_t **error )
+{
+	const char *cache_type_names[ 5 ] = {
+		"Object map nodes",
+		"Snapshot metadata nodes",
+		"File system nodes",
+		"Data blocks",
+		"Decompressed data" };
+
+	static char *function        = "info_handle_volume_cache_statistics_fprint";
+	size64_t read_size           = 0;
+	size64_t resident_size       = 0;
+	size64_t used_size           = 0;
+	uint64_t number_of_evictions = 0;
+	uint64_t number_of_lookups   = 0;
+	uint64_t number_of_misses    = 0;
+	uint64_t number_of_reads     = 0;
+	int cache_type               = 0;
+
+	if( info_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid info handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\tCache statistics:\n" );
+
+	for( cache_type = LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES;
+	     cache_type <= LIBFSAPFS_CACHE_TYPE_DECOMPRESSED_DATA;
+	     cache_type++ )
+	{
+		if( libfsapfs_volume_get_cache_statistics(
+		     volume,
+		     cache_type,
+		     &number_of_lookups,
+		     &number_of_misses,
+		     &number_of_evictions,
+		     &resident_size,
+		     &read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve cache statistics: %d.",
+			 function,
+			 cache_type );
+
+			return( -1 );
+		}
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\t%s:\n",
+		 cache_type_names[ cache_type - 1 ] );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\t\tNumber of lookups\t: %" PRIu64 "\n",
+		 number_of_lookups );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\t\tNumber of hits\t\t: %" PRIu64 "\n",
+		 number_of_lookups - number_of_misses );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\t\tNumber of misses\t: %" PRIu64 "\n",
+		 number_of_misses );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\t\tNumber of evictions\t: %" PRIu64 "\n",
+		 number_of_evictions );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\t\tResident size\t\t: %" PRIu64 " bytes\n",
+		 resident_size );
+
+		fprintf(
+		 info_handle->notify_stream,
+		 "\t\t\tRead size\t\t: %" PRIu64 " bytes\n",
+		 read_size );
+	}
+	if( libfsapfs_volume_get_read_ahead_statistics(
+	     volume,
+	     &number_of_reads,
+	     &read_size,
+	     &used_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read-ahead statistics.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 info_handle->notify_stream,
+	 "\t\tRead-ahead:\n" );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\t\t\tNumber of reads\t\t: %" PRIu64 "\n",
+	 number_of_reads );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\t\t\tRead size\t\t: %" PRIu64 " bytes\n",
+	 read_size );
+
+	fprintf(
+	 info_handle->notify_stream,
+	 "\t\t\tUsed size\t\t: %" PRIu64 " bytes\n",
+	 used_size );
+
+	return( 1 );
+}
+
 /* Prints the volume information
  * Returns 1 if successful or -1 on error
  */
@@ -4241,6 +4378,20 @@ int info_handle_volume_fprint(
 			}
 		}
 	}
+	if( info_handle_volume_cache_statistics_fprint(
+	     info_handle,
+	     volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print volume cache statistics.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -233,6 +233,11 @@ int info_handle_file_entries_fprint(
      info_handle_t *info_handle,
      libcerror_error_t **error );
 
+int info_handle_volume_cache_statistics_fprint(
+     info_handle_t *info_handle,
+     libfsapfs_volume_t *volume,
+     libcerror_error_t **error );
+
 int info_handle_volume_fprint(
      info_handle_t *info_handle,
      int volume_index,
@@ -1104,3 +1104,50 @@ int mount_file_entry_get_size(
 	return( 1 );
 }
 
+/* Retrieves the next range of stored data at or after a specific offset
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int mount_file_entry_get_next_data_range(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error )
+{
+	static char *function = "mount_file_entry_get_next_data_range";
+	int result            = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsapfs_file_entry_get_next_data_range(
+	          file_entry->fsapfs_file_entry,
+	          offset,
+	          range_offset,
+	          range_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next data range at offset: %" PRIi64 " (0x%08" PRIx64 ") from file entry.",
+		 function,
+		 offset,
+		 offset );
+
+		return( -1 );
+	}
+	return( result );
+}
+
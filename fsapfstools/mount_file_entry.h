@@ -136,6 +136,13 @@ int mount_file_entry_get_size(
      size64_t *size,
      libcerror_error_t **error );
 
+int mount_file_entry_get_next_data_range(
+     mount_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -525,6 +525,158 @@ on_error:
 	return( result );
 }
 
+#if defined( MOUNT_FUSE_HAVE_LSEEK )
+
+/* Seeks the next data or hole at or after the specified offset
+ * Returns the resulting offset if successful or a negative errno value otherwise
+ */
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "mount_fuse_lseek";
+	size64_t file_size       = 0;
+	size64_t range_size      = 0;
+	off64_t range_offset     = 0;
+	off_t result             = 0;
+	int get_result           = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: %s\n",
+		 function,
+		 path );
+	}
+#endif
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( ( whence != SEEK_DATA )
+	 && ( whence != SEEK_HOLE ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported whence.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info == NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file information.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( file_info->fh == (uint64_t) NULL )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file information - missing file handle.",
+		 function );
+
+		result = -EINVAL;
+
+		goto on_error;
+	}
+	if( mount_file_entry_get_size(
+	     (mount_file_entry_t *) file_info->fh,
+	     &file_size,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file entry size.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	if( ( offset < 0 )
+	 || ( (size64_t) offset >= file_size ) )
+	{
+		return( -ENXIO );
+	}
+	get_result = mount_file_entry_get_next_data_range(
+	              (mount_file_entry_t *) file_info->fh,
+	              (off64_t) offset,
+	              &range_offset,
+	              &range_size,
+	              &error );
+
+	if( get_result == -1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next data range.",
+		 function );
+
+		result = -EIO;
+
+		goto on_error;
+	}
+	if( whence == SEEK_DATA )
+	{
+		if( get_result == 0 )
+		{
+			return( -ENXIO );
+		}
+		return( (off_t) range_offset );
+	}
+	/* The end of the file is considered an implicit hole
+	 */
+	if( ( get_result != 0 )
+	 && ( range_offset == (off64_t) offset ) )
+	{
+		return( (off_t) ( range_offset + range_size ) );
+	}
+	return( offset );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+#endif /* defined( MOUNT_FUSE_HAVE_LSEEK ) */
+
 /* Releases a file entry
  * Returns 0 if successful or a negative errno value otherwise
  */
@@ -47,6 +47,14 @@
 #include <osxfuse/fuse.h>
 #endif
 
+/* The lseek operation, used for SEEK_DATA and SEEK_HOLE, was added in FUSE 3.8
+ */
+#if defined( HAVE_LIBFUSE3 ) && defined( SEEK_DATA ) && defined( SEEK_HOLE )
+#if FUSE_VERSION >= FUSE_MAKE_VERSION( 3, 8 )
+#define MOUNT_FUSE_HAVE_LSEEK
+#endif
+#endif
+
 #endif /* defined( HAVE_LIBFUSE ) || defined( HAVE_LIBFUSE3 ) || defined( HAVE_LIBOSXFUSE ) */
 
 #include "fsapfstools_libcerror.h"
@@ -102,6 +110,14 @@ int mount_fuse_read(
      off_t offset,
      struct fuse_file_info *file_info );
 
+#if defined( MOUNT_FUSE_HAVE_LSEEK )
+off_t mount_fuse_lseek(
+       const char *path,
+       off_t offset,
+       int whence,
+       struct fuse_file_info *file_info );
+#endif
+
 int mount_fuse_release(
      const char *path,
      struct fuse_file_info *file_info );
@@ -0,0 +1,449 @@
+/*
+ * Object identifier to physical address table functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_address_table.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+/* Determines the index of the first entry to probe for a specific object and transaction identifier
+ */
+#define libfsapfs_address_table_get_entry_index( address_table, object_identifier, transaction_identifier ) \
+	(int) ( ( ( ( object_identifier ^ ( transaction_identifier << 32 ) ^ ( transaction_identifier >> 32 ) ) * 0x9e3779b97f4a7c15UL ) >> 32 ) & (uint64_t) ( address_table->number_of_entries - 1 ) )
+
+/* Creates an address table
+ * The address table is an open addressing hash table with linear probing
+ * Make sure the value address_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_address_table_initialize(
+     libfsapfs_address_table_t **address_table,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_address_table_initialize";
+	size_t entries_size   = 0;
+
+	if( address_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid address table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *address_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid address table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries < 4 )
+	 || ( number_of_entries > ( 1 << 24 ) )
+	 || ( ( number_of_entries & ( number_of_entries - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	entries_size = sizeof( libfsapfs_address_table_entry_t ) * number_of_entries;
+
+	*address_table = memory_allocate_structure(
+	                  libfsapfs_address_table_t );
+
+	if( *address_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create address table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *address_table,
+	     0,
+	     sizeof( libfsapfs_address_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear address table.",
+		 function );
+
+		memory_free(
+		 *address_table );
+
+		*address_table = NULL;
+
+		return( -1 );
+	}
+	( *address_table )->entries = (libfsapfs_address_table_entry_t *) memory_allocate(
+	                                                                   entries_size );
+
+	if( ( *address_table )->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entries.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *address_table )->entries,
+	     0,
+	     entries_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entries.",
+		 function );
+
+		goto on_error;
+	}
+	( *address_table )->number_of_entries = number_of_entries;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *address_table )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *address_table != NULL )
+	{
+		if( ( *address_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *address_table )->entries );
+		}
+		memory_free(
+		 *address_table );
+
+		*address_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an address table
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_address_table_free(
+     libfsapfs_address_table_t **address_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_address_table_free";
+	int result            = 1;
+
+	if( address_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid address table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *address_table != NULL )
+	{
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *address_table )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 ( *address_table )->entries );
+
+		memory_free(
+		 *address_table );
+
+		*address_table = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the physical address of a specific object and transaction identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsapfs_address_table_get_physical_address(
+     libfsapfs_address_table_t *address_table,
+     uint64_t object_identifier,
+     uint64_t transaction_identifier,
+     uint64_t *physical_address,
+     libcerror_error_t **error )
+{
+	libfsapfs_address_table_entry_t *entry = NULL;
+	static char *function                  = "libfsapfs_address_table_get_physical_address";
+	int entry_index                        = 0;
+	int number_of_probes                   = 0;
+	int result                             = 0;
+
+	if( address_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid address table.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical address.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_identifier == 0 )
+	{
+		return( 0 );
+	}
+	entry_index = libfsapfs_address_table_get_entry_index(
+	               address_table,
+	               object_identifier,
+	               transaction_identifier );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     address_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( number_of_probes = 0;
+	     number_of_probes < address_table->number_of_entries;
+	     number_of_probes++ )
+	{
+		entry = &( address_table->entries[ entry_index ] );
+
+		if( entry->object_identifier == 0 )
+		{
+			break;
+		}
+		if( ( entry->object_identifier == object_identifier )
+		 && ( entry->transaction_identifier == transaction_identifier ) )
+		{
+			*physical_address = entry->physical_address;
+
+			result = 1;
+
+			break;
+		}
+		entry_index = ( entry_index + 1 ) & ( address_table->number_of_entries - 1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     address_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the physical address of a specific object and transaction identifier
+ * The table is emptied when it is three quarters full, to keep probe sequences short
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_address_table_set_physical_address(
+     libfsapfs_address_table_t *address_table,
+     uint64_t object_identifier,
+     uint64_t transaction_identifier,
+     uint64_t physical_address,
+     libcerror_error_t **error )
+{
+	libfsapfs_address_table_entry_t *entry = NULL;
+	static char *function                  = "libfsapfs_address_table_set_physical_address";
+	int entry_index                        = 0;
+	int result                             = 1;
+
+	if( address_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid address table.",
+		 function );
+
+		return( -1 );
+	}
+	if( object_identifier == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid object identifier value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = libfsapfs_address_table_get_entry_index(
+	               address_table,
+	               object_identifier,
+	               transaction_identifier );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     address_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( address_table->number_of_used_entries >= ( ( address_table->number_of_entries / 4 ) * 3 ) )
+	{
+		if( memory_set(
+		     address_table->entries,
+		     0,
+		     sizeof( libfsapfs_address_table_entry_t ) * address_table->number_of_entries ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			result = -1;
+		}
+		address_table->number_of_used_entries = 0;
+	}
+	if( result == 1 )
+	{
+		do
+		{
+			entry = &( address_table->entries[ entry_index ] );
+
+			if( entry->object_identifier == 0 )
+			{
+				entry->object_identifier      = object_identifier;
+				entry->transaction_identifier = transaction_identifier;
+
+				address_table->number_of_used_entries += 1;
+
+				break;
+			}
+			if( ( entry->object_identifier == object_identifier )
+			 && ( entry->transaction_identifier == transaction_identifier ) )
+			{
+				break;
+			}
+			entry_index = ( entry_index + 1 ) & ( address_table->number_of_entries - 1 );
+		}
+		while( 1 );
+
+		entry->physical_address = physical_address;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     address_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
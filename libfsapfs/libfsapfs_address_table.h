@@ -0,0 +1,102 @@
+/*
+ * Object identifier to physical address table functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_ADDRESS_TABLE_H )
+#define _LIBFSAPFS_ADDRESS_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_address_table_entry libfsapfs_address_table_entry_t;
+
+struct libfsapfs_address_table_entry
+{
+	/* The object identifier, where 0 represents an unused entry
+	 */
+	uint64_t object_identifier;
+
+	/* The transaction identifier
+	 */
+	uint64_t transaction_identifier;
+
+	/* The physical address
+	 */
+	uint64_t physical_address;
+};
+
+typedef struct libfsapfs_address_table libfsapfs_address_table_t;
+
+struct libfsapfs_address_table
+{
+	/* The entries
+	 */
+	libfsapfs_address_table_entry_t *entries;
+
+	/* The number of entries, which is a power of 2
+	 */
+	int number_of_entries;
+
+	/* The number of used entries
+	 */
+	int number_of_used_entries;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsapfs_address_table_initialize(
+     libfsapfs_address_table_t **address_table,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libfsapfs_address_table_free(
+     libfsapfs_address_table_t **address_table,
+     libcerror_error_t **error );
+
+int libfsapfs_address_table_get_physical_address(
+     libfsapfs_address_table_t *address_table,
+     uint64_t object_identifier,
+     uint64_t transaction_identifier,
+     uint64_t *physical_address,
+     libcerror_error_t **error );
+
+int libfsapfs_address_table_set_physical_address(
+     libfsapfs_address_table_t *address_table,
+     uint64_t object_identifier,
+     uint64_t transaction_identifier,
+     uint64_t physical_address,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_ADDRESS_TABLE_H ) */
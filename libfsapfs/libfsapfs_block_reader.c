@@ -0,0 +1,1366 @@
+/*
+ * Batched block reader functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_block_reader.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcnotify.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_profiler.h"
+
+/* Creates a block reader
+ * The block reader merges requests for adjacent data into a single read
+ * Make sure the value block_reader is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_initialize(
+     libfsapfs_block_reader_t **block_reader,
+     libfsapfs_io_handle_t *io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_reader_initialize";
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_reader != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid block reader value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*block_reader = memory_allocate_structure(
+	                 libfsapfs_block_reader_t );
+
+	if( *block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *block_reader,
+	     0,
+	     sizeof( libfsapfs_block_reader_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear block reader.",
+		 function );
+
+		goto on_error;
+	}
+	( *block_reader )->io_handle                          = io_handle;
+	( *block_reader )->encryption_context                 = encryption_context;
+	( *block_reader )->maximum_number_of_concurrent_reads = 1;
+
+	return( 1 );
+
+on_error:
+	if( *block_reader != NULL )
+	{
+		memory_free(
+		 *block_reader );
+
+		*block_reader = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a block reader
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_free(
+     libfsapfs_block_reader_t **block_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_reader_free";
+	int result            = 1;
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( *block_reader != NULL )
+	{
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libfsapfs_block_reader_free_workers(
+		     *block_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free workers.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *block_reader )->runs != NULL )
+		{
+			memory_free(
+			 ( *block_reader )->runs );
+		}
+		if( ( *block_reader )->run_data != NULL )
+		{
+			memory_free(
+			 ( *block_reader )->run_data );
+		}
+		if( ( *block_reader )->requests != NULL )
+		{
+			memory_free(
+			 ( *block_reader )->requests );
+		}
+		memory_free(
+		 *block_reader );
+
+		*block_reader = NULL;
+	}
+	return( result );
+}
+
+/* Clears the requests of a block reader without reading them
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_clear(
+     libfsapfs_block_reader_t *block_reader,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_reader_clear";
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	block_reader->number_of_requests = 0;
+
+	return( 1 );
+}
+
+/* Appends a request to read data at a specific offset
+ * The data is not read until libfsapfs_block_reader_read is called
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_append_request(
+     libfsapfs_block_reader_t *block_reader,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_block_reader_request_t *requests = NULL;
+	static char *function                      = "libfsapfs_block_reader_append_request";
+	size_t requests_size                       = 0;
+	int number_of_allocated_requests           = 0;
+	int request_index                          = 0;
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_reader->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block reader - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Encrypted data is decrypted per sector
+	 */
+	if( block_reader->encryption_context != NULL )
+	{
+		if( block_reader->io_handle->bytes_per_sector == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid block reader - invalid IO handle - missing bytes per sector.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( ( file_offset % block_reader->io_handle->bytes_per_sector ) != 0 )
+		 || ( ( data_size % block_reader->io_handle->bytes_per_sector ) != 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid encrypted request - not aligned to sector boundary.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( block_reader->number_of_requests >= block_reader->number_of_allocated_requests )
+	{
+		number_of_allocated_requests = block_reader->number_of_allocated_requests;
+
+		if( number_of_allocated_requests == 0 )
+		{
+			number_of_allocated_requests = 16;
+		}
+		else
+		{
+			if( number_of_allocated_requests >= ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of requests value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_requests *= 2;
+		}
+		requests_size = sizeof( libfsapfs_block_reader_request_t ) * number_of_allocated_requests;
+
+		requests = (libfsapfs_block_reader_request_t *) memory_reallocate(
+		                                                 block_reader->requests,
+		                                                 requests_size );
+
+		if( requests == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize requests.",
+			 function );
+
+			return( -1 );
+		}
+		block_reader->requests                     = requests;
+		block_reader->number_of_allocated_requests = number_of_allocated_requests;
+	}
+	/* Requests are commonly appended in order, hence the insertion position is searched from the end
+	 */
+	request_index = block_reader->number_of_requests;
+
+	while( ( request_index > 0 )
+	    && ( block_reader->requests[ request_index - 1 ].file_offset > file_offset ) )
+	{
+		block_reader->requests[ request_index ] = block_reader->requests[ request_index - 1 ];
+
+		request_index--;
+	}
+	block_reader->requests[ request_index ].file_offset = file_offset;
+	block_reader->requests[ request_index ].data        = data;
+	block_reader->requests[ request_index ].data_size   = data_size;
+
+	block_reader->number_of_requests += 1;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of concurrent reads
+ * Runs are read concurrently by worker threads, each with a clone of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_set_maximum_number_of_concurrent_reads(
+     libfsapfs_block_reader_t *block_reader,
+     int maximum_number_of_concurrent_reads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_reader_set_maximum_number_of_concurrent_reads";
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_concurrent_reads < 1 )
+	 || ( maximum_number_of_concurrent_reads > LIBFSAPFS_MAXIMUM_NUMBER_OF_CONCURRENT_READS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of concurrent reads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( maximum_number_of_concurrent_reads != block_reader->maximum_number_of_concurrent_reads )
+	{
+		if( libfsapfs_block_reader_free_workers(
+		     block_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free workers.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	block_reader->maximum_number_of_concurrent_reads = maximum_number_of_concurrent_reads;
+
+	return( 1 );
+}
+
+/* Appends a run
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_append_run(
+     libfsapfs_block_reader_t *block_reader,
+     off64_t file_offset,
+     size_t data_size,
+     uint8_t *data,
+     int first_request_index,
+     int number_of_requests,
+     libcerror_error_t **error )
+{
+	libfsapfs_block_reader_run_t *run  = NULL;
+	libfsapfs_block_reader_run_t *runs = NULL;
+	static char *function              = "libfsapfs_block_reader_append_run";
+	int number_of_allocated_runs       = 0;
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_reader->number_of_runs >= block_reader->number_of_allocated_runs )
+	{
+		number_of_allocated_runs = block_reader->number_of_allocated_runs;
+
+		if( number_of_allocated_runs == 0 )
+		{
+			number_of_allocated_runs = 16;
+		}
+		else
+		{
+			if( number_of_allocated_runs >= ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of runs value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_runs *= 2;
+		}
+		runs = (libfsapfs_block_reader_run_t *) memory_reallocate(
+		                                         block_reader->runs,
+		                                         sizeof( libfsapfs_block_reader_run_t ) * number_of_allocated_runs );
+
+		if( runs == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize runs.",
+			 function );
+
+			return( -1 );
+		}
+		block_reader->runs                     = runs;
+		block_reader->number_of_allocated_runs = number_of_allocated_runs;
+	}
+	run = &( block_reader->runs[ block_reader->number_of_runs ] );
+
+	run->file_offset         = file_offset;
+	run->data_size           = data_size;
+	run->data                = data;
+	run->first_request_index = first_request_index;
+	run->number_of_requests  = number_of_requests;
+
+	block_reader->number_of_runs += 1;
+
+	return( 1 );
+}
+
+/* Reads a run
+ * A run without data is read into the run data and copied or decrypted into the request data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_read_run(
+     libfsapfs_block_reader_t *block_reader,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_block_reader_run_t *run,
+     uint8_t **run_data,
+     size_t *run_data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_block_reader_request_t *request = NULL;
+	uint8_t *read_buffer                      = NULL;
+	static char *function                     = "libfsapfs_block_reader_read_run";
+	size_t run_data_offset                    = 0;
+	ssize_t read_count                        = 0;
+	int request_index                         = 0;
+
+#if defined( HAVE_PROFILER )
+	int64_t profiler_start_timestamp          = 0;
+#endif
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_reader->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block reader - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( run == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run data.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid run data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( run->data != NULL )
+	{
+		read_buffer = run->data;
+	}
+	else
+	{
+		if( run->data_size > *run_data_size )
+		{
+			read_buffer = (uint8_t *) memory_reallocate(
+			                           *run_data,
+			                           sizeof( uint8_t ) * run->data_size );
+
+			if( read_buffer == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize run data.",
+				 function );
+
+				return( -1 );
+			}
+			*run_data      = read_buffer;
+			*run_data_size = run->data_size;
+		}
+		read_buffer = *run_data;
+	}
+#if defined( HAVE_PROFILER )
+	if( block_reader->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_start_timing(
+		     block_reader->io_handle->profiler,
+		     &profiler_start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start timing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              read_buffer,
+	              run->data_size,
+	              run->file_offset,
+	              error );
+
+	if( read_count != (ssize_t) run->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read run of: %" PRIzd " bytes at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 run->data_size,
+		 run->file_offset,
+		 run->file_offset );
+
+		return( -1 );
+	}
+#if defined( HAVE_PROFILER )
+	if( block_reader->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_stop_timing(
+		     block_reader->io_handle->profiler,
+		     profiler_start_timestamp,
+		     function,
+		     run->file_offset,
+		     run->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop timing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
+	if( run->data != NULL )
+	{
+		return( 1 );
+	}
+	for( request_index = run->first_request_index;
+	     request_index < ( run->first_request_index + run->number_of_requests );
+	     request_index++ )
+	{
+		request         = &( block_reader->requests[ request_index ] );
+		run_data_offset = (size_t) ( request->file_offset - run->file_offset );
+
+		if( block_reader->encryption_context != NULL )
+		{
+			if( libfsapfs_encryption_context_crypt(
+			     block_reader->encryption_context,
+			     LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+			     &( read_buffer[ run_data_offset ] ),
+			     request->data_size,
+			     request->data,
+			     request->data_size,
+			     (uint64_t) request->file_offset / block_reader->io_handle->bytes_per_sector,
+			     block_reader->io_handle->bytes_per_sector,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+				 "%s: unable to decrypt data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 request->file_offset,
+				 request->file_offset );
+
+				return( -1 );
+			}
+		}
+		else if( memory_copy(
+		          request->data,
+		          &( read_buffer[ run_data_offset ] ),
+		          request->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 request->file_offset,
+			 request->file_offset );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads every run_index_step-th run starting with a specific run
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_read_runs(
+     libfsapfs_block_reader_t *block_reader,
+     libbfio_handle_t *file_io_handle,
+     int first_run_index,
+     int run_index_step,
+     uint8_t **run_data,
+     size_t *run_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_block_reader_read_runs";
+	int run_index         = 0;
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_run_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first run index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( run_index_step < 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid run index step value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( run_index = first_run_index;
+	     run_index < block_reader->number_of_runs;
+	     run_index += run_index_step )
+	{
+		if( libfsapfs_block_reader_read_run(
+		     block_reader,
+		     file_io_handle,
+		     &( block_reader->runs[ run_index ] ),
+		     run_data,
+		     run_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read run: %d.",
+			 function,
+			 run_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+/* Frees the workers and their file IO handles
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_free_workers(
+     libfsapfs_block_reader_t *block_reader,
+     libcerror_error_t **error )
+{
+	libfsapfs_block_reader_worker_t *worker = NULL;
+	static char *function                   = "libfsapfs_block_reader_free_workers";
+	int result                              = 1;
+	int worker_index                        = 0;
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_reader->workers != NULL )
+	{
+		for( worker_index = 0;
+		     worker_index < block_reader->number_of_workers;
+		     worker_index++ )
+		{
+			worker = &( block_reader->workers[ worker_index ] );
+
+			if( worker->file_io_handle != NULL )
+			{
+				if( libbfio_handle_free(
+				     &( worker->file_io_handle ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free worker: %d file IO handle.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			if( worker->run_data != NULL )
+			{
+				memory_free(
+				 worker->run_data );
+			}
+		}
+		memory_free(
+		 block_reader->workers );
+
+		block_reader->workers = NULL;
+	}
+	block_reader->number_of_workers      = 0;
+	block_reader->workers_file_io_handle = NULL;
+
+	return( result );
+}
+
+/* Retrieves a specific number of workers for reading from a file IO handle
+ * The workers and their clones of the file IO handle are retained for subsequent reads
+ * Returns 1 if successful, 0 if the file IO handle cannot be cloned or -1 on error
+ */
+int libfsapfs_block_reader_get_workers(
+     libfsapfs_block_reader_t *block_reader,
+     libbfio_handle_t *file_io_handle,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	libfsapfs_block_reader_worker_t *worker = NULL;
+	static char *function                   = "libfsapfs_block_reader_get_workers";
+	int file_io_handle_is_open              = 0;
+	int worker_index                        = 0;
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers >= block_reader->maximum_number_of_concurrent_reads ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_reader->workers != NULL )
+	 && ( block_reader->workers_file_io_handle != file_io_handle ) )
+	{
+		if( libfsapfs_block_reader_free_workers(
+		     block_reader,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free workers.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( block_reader->workers == NULL )
+	{
+		block_reader->workers = (libfsapfs_block_reader_worker_t *) memory_allocate(
+		                                                             sizeof( libfsapfs_block_reader_worker_t ) * ( block_reader->maximum_number_of_concurrent_reads - 1 ) );
+
+		if( block_reader->workers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create workers.",
+			 function );
+
+			return( -1 );
+		}
+		block_reader->workers_file_io_handle = file_io_handle;
+	}
+	/* Each worker reads using its own clone of the file IO handle since reads
+	 * on a single file IO handle are serialized
+	 */
+	while( block_reader->number_of_workers < number_of_workers )
+	{
+		worker_index = block_reader->number_of_workers;
+		worker       = &( block_reader->workers[ worker_index ] );
+
+		if( memory_set(
+		     worker,
+		     0,
+		     sizeof( libfsapfs_block_reader_worker_t ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear worker: %d.",
+			 function,
+			 worker_index );
+
+			return( -1 );
+		}
+		worker->block_reader = block_reader;
+
+		if( libbfio_handle_clone(
+		     &( worker->file_io_handle ),
+		     file_io_handle,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		block_reader->number_of_workers += 1;
+
+		file_io_handle_is_open = libbfio_handle_is_open(
+		                          worker->file_io_handle,
+		                          error );
+
+		if( file_io_handle_is_open == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if worker: %d file IO handle is open.",
+			 function,
+			 worker_index );
+
+			return( -1 );
+		}
+		else if( file_io_handle_is_open == 0 )
+		{
+			if( libbfio_handle_open(
+			     worker->file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open worker: %d file IO handle.",
+				 function,
+				 worker_index );
+
+				return( -1 );
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the runs of a worker
+ * This function is the callback of the worker thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_worker_read_runs(
+     libfsapfs_block_reader_worker_t *worker )
+{
+	libcerror_error_t *error = NULL;
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	worker->result = libfsapfs_block_reader_read_runs(
+	                  worker->block_reader,
+	                  worker->file_io_handle,
+	                  worker->first_run_index,
+	                  worker->run_index_step,
+	                  &( worker->run_data ),
+	                  &( worker->run_data_size ),
+	                  &error );
+
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( worker->result );
+}
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+/* Reads the data of the requests
+ * Requests of adjacent or overlapping data are merged into runs that are read at once.
+ * A run is read directly into the request data if the request data is contiguous in memory,
+ * otherwise the run is read into the run data and copied or decrypted into the request data.
+ * If concurrent reads are enabled, runs that are read directly are split into parts and
+ * the runs are distributed over worker threads.
+ * The requests are cleared afterwards
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_block_reader_read(
+     libfsapfs_block_reader_t *block_reader,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsapfs_block_reader_request_t *request          = NULL;
+	libfsapfs_block_reader_request_t *previous_request = NULL;
+	static char *function                              = "libfsapfs_block_reader_read";
+	size_t maximum_run_size                            = 0;
+	size_t run_size                                    = 0;
+	off64_t request_end_offset                         = 0;
+	off64_t run_end_offset                             = 0;
+	off64_t run_offset                                 = 0;
+	uint8_t read_directly                              = 0;
+	int first_request_index                            = 0;
+	int number_of_workers                              = 0;
+	int request_index                                  = 0;
+	int result                                         = 1;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libfsapfs_block_reader_worker_t *worker            = NULL;
+	int worker_index                                   = 0;
+#endif
+
+	if( block_reader == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid block reader.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_reader->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid block reader - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	block_reader->number_of_runs = 0;
+
+	maximum_run_size = (size_t) LIBFSAPFS_BLOCK_READER_MAXIMUM_RUN_SIZE;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( block_reader->maximum_number_of_concurrent_reads > 1 )
+	{
+		maximum_run_size = (size_t) LIBFSAPFS_BLOCK_READER_CONCURRENT_READ_SIZE;
+	}
+#endif
+	request_index = 0;
+
+	while( request_index < block_reader->number_of_requests )
+	{
+		first_request_index = request_index;
+		request             = &( block_reader->requests[ request_index ] );
+		run_offset          = request->file_offset;
+		run_end_offset      = request->file_offset + request->data_size;
+		read_directly       = (uint8_t) ( block_reader->encryption_context == NULL );
+
+		for( request_index = first_request_index + 1;
+		     request_index < block_reader->number_of_requests;
+		     request_index++ )
+		{
+			previous_request = request;
+			request          = &( block_reader->requests[ request_index ] );
+
+			if( request->file_offset > run_end_offset )
+			{
+				break;
+			}
+			request_end_offset = request->file_offset + request->data_size;
+
+			if( request_end_offset < run_end_offset )
+			{
+				request_end_offset = run_end_offset;
+			}
+			if( (size64_t) ( request_end_offset - run_offset ) > (size64_t) LIBFSAPFS_BLOCK_READER_MAXIMUM_RUN_SIZE )
+			{
+				break;
+			}
+			if( ( request->file_offset != ( previous_request->file_offset + (off64_t) previous_request->data_size ) )
+			 || ( request->data != &( previous_request->data[ previous_request->data_size ] ) ) )
+			{
+				read_directly = 0;
+			}
+			run_end_offset = request_end_offset;
+		}
+		run_size = (size_t) ( run_end_offset - run_offset );
+
+		if( read_directly == 0 )
+		{
+			if( libfsapfs_block_reader_append_run(
+			     block_reader,
+			     run_offset,
+			     run_size,
+			     NULL,
+			     first_request_index,
+			     request_index - first_request_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append run.",
+				 function );
+
+				goto on_error;
+			}
+			continue;
+		}
+		/* A run that is read directly can be split at any offset
+		 */
+		request = &( block_reader->requests[ first_request_index ] );
+
+		while( run_size > 0 )
+		{
+			if( libfsapfs_block_reader_append_run(
+			     block_reader,
+			     run_offset,
+			     ( run_size < maximum_run_size ) ? run_size : maximum_run_size,
+			     &( request->data[ run_offset - request->file_offset ] ),
+			     first_request_index,
+			     request_index - first_request_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append run.",
+				 function );
+
+				goto on_error;
+			}
+			run_size   -= block_reader->runs[ block_reader->number_of_runs - 1 ].data_size;
+			run_offset += block_reader->runs[ block_reader->number_of_runs - 1 ].data_size;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( block_reader->maximum_number_of_concurrent_reads > 1 )
+	{
+		number_of_workers = block_reader->maximum_number_of_concurrent_reads;
+
+		if( number_of_workers > block_reader->number_of_runs )
+		{
+			number_of_workers = block_reader->number_of_runs;
+		}
+		number_of_workers -= 1;
+	}
+	if( number_of_workers > 0 )
+	{
+		result = libfsapfs_block_reader_get_workers(
+		          block_reader,
+		          file_io_handle,
+		          number_of_workers,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve workers.",
+			 function );
+
+			goto on_error;
+		}
+		/* If the file IO handle cannot be cloned fewer workers are used
+		 */
+		if( number_of_workers > block_reader->number_of_workers )
+		{
+			number_of_workers = block_reader->number_of_workers;
+		}
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( block_reader->workers[ worker_index ] );
+
+		worker->first_run_index = worker_index + 1;
+		worker->run_index_step  = number_of_workers + 1;
+		worker->result          = 0;
+
+		if( libcthreads_thread_create(
+		     &( worker->thread ),
+		     NULL,
+		     (int (*)(void *)) &libfsapfs_block_reader_worker_read_runs,
+		     (void *) worker,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create worker: %d thread.",
+			 function,
+			 worker_index );
+
+			number_of_workers = worker_index;
+			result            = -1;
+
+			break;
+		}
+	}
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+	if( result == 1 )
+	{
+		result = libfsapfs_block_reader_read_runs(
+		          block_reader,
+		          file_io_handle,
+		          0,
+		          number_of_workers + 1,
+		          &( block_reader->run_data ),
+		          &( block_reader->run_data_size ),
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read runs.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The worker threads are joined, also on error, since they reference the request data
+	 */
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		worker = &( block_reader->workers[ worker_index ] );
+
+		if( libcthreads_thread_join(
+		     &( worker->thread ),
+		     ( result == 1 ) ? error : NULL ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join worker: %d thread.",
+				 function,
+				 worker_index );
+			}
+			result = -1;
+		}
+		else if( ( worker->result != 1 )
+		      && ( result == 1 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read runs of worker: %d.",
+			 function,
+			 worker_index );
+
+			result = -1;
+		}
+	}
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+	block_reader->number_of_requests = 0;
+	block_reader->number_of_runs     = 0;
+
+	return( result );
+
+on_error:
+	block_reader->number_of_requests = 0;
+	block_reader->number_of_runs     = 0;
+
+	return( -1 );
+}
@@ -0,0 +1,263 @@
+/*
+ * Batched block reader functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_BLOCK_READER_H )
+#define _LIBFSAPFS_BLOCK_READER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_block_reader_request libfsapfs_block_reader_request_t;
+
+struct libfsapfs_block_reader_request
+{
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+};
+
+typedef struct libfsapfs_block_reader_run libfsapfs_block_reader_run_t;
+
+struct libfsapfs_block_reader_run
+{
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The data, set if the run is read directly into the request data
+	 */
+	uint8_t *data;
+
+	/* The index of the first request of the run
+	 */
+	int first_request_index;
+
+	/* The number of requests of the run
+	 */
+	int number_of_requests;
+};
+
+typedef struct libfsapfs_block_reader libfsapfs_block_reader_t;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+typedef struct libfsapfs_block_reader_worker libfsapfs_block_reader_worker_t;
+
+struct libfsapfs_block_reader_worker
+{
+	/* The block reader
+	 */
+	libfsapfs_block_reader_t *block_reader;
+
+	/* The file IO handle, a clone of the file IO handle of the block reader
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The run data
+	 */
+	uint8_t *run_data;
+
+	/* The run data size
+	 */
+	size_t run_data_size;
+
+	/* The index of the first run read by the worker
+	 */
+	int first_run_index;
+
+	/* The run index step
+	 */
+	int run_index_step;
+
+	/* The result of the worker
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+struct libfsapfs_block_reader
+{
+	/* The IO handle
+	 */
+	libfsapfs_io_handle_t *io_handle;
+
+	/* The encryption context
+	 */
+	libfsapfs_encryption_context_t *encryption_context;
+
+	/* The requests, sorted by file offset
+	 */
+	libfsapfs_block_reader_request_t *requests;
+
+	/* The number of requests
+	 */
+	int number_of_requests;
+
+	/* The number of allocated requests
+	 */
+	int number_of_allocated_requests;
+
+	/* The run data, used to read runs that cannot be read directly into the request data
+	 */
+	uint8_t *run_data;
+
+	/* The run data size
+	 */
+	size_t run_data_size;
+
+	/* The runs
+	 */
+	libfsapfs_block_reader_run_t *runs;
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The number of allocated runs
+	 */
+	int number_of_allocated_runs;
+
+	/* The maximum number of concurrent reads
+	 */
+	int maximum_number_of_concurrent_reads;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The workers
+	 */
+	libfsapfs_block_reader_worker_t *workers;
+
+	/* The number of workers
+	 */
+	int number_of_workers;
+
+	/* The file IO handle the workers were cloned from
+	 */
+	libbfio_handle_t *workers_file_io_handle;
+#endif
+};
+
+int libfsapfs_block_reader_initialize(
+     libfsapfs_block_reader_t **block_reader,
+     libfsapfs_io_handle_t *io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libcerror_error_t **error );
+
+int libfsapfs_block_reader_free(
+     libfsapfs_block_reader_t **block_reader,
+     libcerror_error_t **error );
+
+int libfsapfs_block_reader_clear(
+     libfsapfs_block_reader_t *block_reader,
+     libcerror_error_t **error );
+
+int libfsapfs_block_reader_append_request(
+     libfsapfs_block_reader_t *block_reader,
+     off64_t file_offset,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_block_reader_set_maximum_number_of_concurrent_reads(
+     libfsapfs_block_reader_t *block_reader,
+     int maximum_number_of_concurrent_reads,
+     libcerror_error_t **error );
+
+int libfsapfs_block_reader_append_run(
+     libfsapfs_block_reader_t *block_reader,
+     off64_t file_offset,
+     size_t data_size,
+     uint8_t *data,
+     int first_request_index,
+     int number_of_requests,
+     libcerror_error_t **error );
+
+int libfsapfs_block_reader_read_run(
+     libfsapfs_block_reader_t *block_reader,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_block_reader_run_t *run,
+     uint8_t **run_data,
+     size_t *run_data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_block_reader_read_runs(
+     libfsapfs_block_reader_t *block_reader,
+     libbfio_handle_t *file_io_handle,
+     int first_run_index,
+     int run_index_step,
+     uint8_t **run_data,
+     size_t *run_data_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+int libfsapfs_block_reader_free_workers(
+     libfsapfs_block_reader_t *block_reader,
+     libcerror_error_t **error );
+
+int libfsapfs_block_reader_get_workers(
+     libfsapfs_block_reader_t *block_reader,
+     libbfio_handle_t *file_io_handle,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libfsapfs_block_reader_worker_read_runs(
+     libfsapfs_block_reader_worker_t *worker );
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+int libfsapfs_block_reader_read(
+     libfsapfs_block_reader_t *block_reader,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_BLOCK_READER_H ) */
+
@@ -28,9 +28,14 @@
 #include "libfsapfs_btree_footer.h"
 #include "libfsapfs_btree_node_header.h"
 #include "libfsapfs_btree_node.h"
-#include "libfsapfs_libcdata.h"
+#include "libfsapfs_data_block.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
+#include "libfsapfs_mapped_file.h"
 
 #include "fsapfs_btree.h"
 #include "fsapfs_object.h"
@@ -101,20 +106,6 @@ int libfsapfs_btree_node_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
-	     &( ( *btree_node )->entries_array ),
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create entries array.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
@@ -183,19 +174,10 @@ int libfsapfs_btree_node_free(
 				result = -1;
 			}
 		}
-		if( libcdata_array_free(
-		     &( ( *btree_node )->entries_array ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_entry_free,
-		     error ) != 1 )
+		if( ( *btree_node )->data != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free entries array.",
-			 function );
-
-			result = -1;
+			memory_free(
+			 ( *btree_node )->data );
 		}
 		memory_free(
 		 *btree_node );
@@ -205,6 +187,196 @@ int libfsapfs_btree_node_free(
 	return( result );
 }
 
+/* Reads the B-tree node from a specific block
+ * The block number is a 64-bit physical block number relative to the start of the container
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_btree_node_read_file_io_handle(
+     libfsapfs_btree_node_t *btree_node,
+     libfsapfs_io_handle_t *io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libbfio_handle_t *file_io_handle,
+     uint64_t block_number,
+     libcerror_error_t **error )
+{
+	libfsapfs_data_block_t *data_block = NULL;
+	const uint8_t *mapped_data         = NULL;
+	static char *function              = "libfsapfs_btree_node_read_file_io_handle";
+	off64_t file_offset                = 0;
+	int result                         = 0;
+
+	if( btree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	if( block_number >= (uint64_t) ( io_handle->container_size / io_handle->block_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_offset = (off64_t) ( block_number * io_handle->block_size );
+
+	/* If the container is memory mapped and not encrypted the node references the mapped data
+	 * and the kernel page cache is used instead of a copy of the node data
+	 */
+	if( ( io_handle->mapped_file != NULL )
+	 && ( encryption_context == NULL ) )
+	{
+		result = libfsapfs_mapped_file_get_data(
+		          io_handle->mapped_file,
+		          file_offset,
+		          (size_t) io_handle->block_size,
+		          &mapped_data,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve mapped data of block: %" PRIu64 ".",
+			 function,
+			 block_number );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( libfsapfs_btree_node_read_data_with_flags(
+			     btree_node,
+			     mapped_data,
+			     (size_t) io_handle->block_size,
+			     LIBFSAPFS_BTREE_NODE_READ_FLAG_REFERENCE_DATA,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read B-tree node.",
+				 function );
+
+				goto on_error;
+			}
+			btree_node->block_number = block_number;
+
+			return( 1 );
+		}
+	}
+	if( libfsapfs_data_block_initialize_with_buffer_pool(
+	     &data_block,
+	     io_handle->buffer_pool,
+	     (size_t) io_handle->block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block.",
+		 function );
+
+		goto on_error;
+	}
+	/* The encryption identifier of a metadata block is its physical block number
+	 */
+	if( libfsapfs_data_block_read(
+	     data_block,
+	     io_handle,
+	     encryption_context,
+	     file_io_handle,
+	     file_offset,
+	     block_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data block: %" PRIu64 ".",
+		 function,
+		 block_number );
+
+		goto on_error;
+	}
+	if( libfsapfs_btree_node_read_data(
+	     btree_node,
+	     data_block->data,
+	     data_block->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read B-tree node.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_data_block_free(
+	     &data_block,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free data block.",
+		 function );
+
+		goto on_error;
+	}
+	btree_node->block_number = block_number;
+
+	return( 1 );
+
+on_error:
+	if( data_block != NULL )
+	{
+		libfsapfs_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Reads the B-tree node
  * Returns 1 if successful or -1 on error
  */
@@ -213,12 +385,48 @@ int libfsapfs_btree_node_read_data(
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_btree_node_read_data";
+
+	if( libfsapfs_btree_node_read_data_with_flags(
+	     btree_node,
+	     data,
+	     data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the B-tree node using specific read flags
+ * If LIBFSAPFS_BTREE_NODE_READ_FLAG_REFERENCE_DATA is set the node data is not copied
+ * and must remain valid for the lifetime of the B-tree node
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_btree_node_read_data_with_flags(
+     libfsapfs_btree_node_t *btree_node,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t read_flags,
+     libcerror_error_t **error )
 {
 	libfsapfs_btree_entry_t *btree_entry = NULL;
 	const uint8_t *btree_node_entry      = NULL;
-	static char *function                = "libfsapfs_btree_node_read_data";
+	const uint8_t *node_data             = NULL;
+	static char *function                = "libfsapfs_btree_node_read_data_with_flags";
+	size_t allocation_size               = 0;
 	size_t btree_entry_data_size         = 0;
 	size_t data_offset                   = 0;
+	size_t entries_table_size            = 0;
 	size_t minimum_data_size             = 0;
 	size_t remaining_data_size           = 0;
 	uint16_t entries_data_offset         = 0;
@@ -228,7 +436,6 @@ int libfsapfs_btree_node_read_data(
 	uint16_t map_entry_index             = 0;
 	uint16_t value_data_offset           = 0;
 	uint16_t value_data_size             = 0;
-	int entry_index                      = 0;
 
 	if( btree_node == NULL )
 	{
@@ -252,6 +459,17 @@ int libfsapfs_btree_node_read_data(
 
 		return( -1 );
 	}
+	if( btree_node->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid B-tree node - data value already set.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -446,6 +664,63 @@ int libfsapfs_btree_node_read_data(
 
 		goto on_error;
 	}
+	/* The entries table and a copy of the node data are stored in a single allocation
+	 * the key and value data of the entries reference the copy of the node data
+	 * so that the entries remain valid after the data block has been evicted from the cache
+	 * If the data is referenced only the entries table is allocated
+	 */
+	entries_table_size = sizeof( libfsapfs_btree_entry_t ) * (size_t) btree_node->node_header->number_of_keys;
+
+	if( ( read_flags & LIBFSAPFS_BTREE_NODE_READ_FLAG_REFERENCE_DATA ) != 0 )
+	{
+		allocation_size = entries_table_size;
+	}
+	else
+	{
+		allocation_size = entries_table_size + data_size;
+	}
+	if( allocation_size > 0 )
+	{
+		btree_node->data = (uint8_t *) memory_allocate(
+		                                sizeof( uint8_t ) * allocation_size );
+
+		if( btree_node->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	btree_node->data_size = data_size;
+	btree_node->entries   = (libfsapfs_btree_entry_t *) btree_node->data;
+
+	if( ( read_flags & LIBFSAPFS_BTREE_NODE_READ_FLAG_REFERENCE_DATA ) != 0 )
+	{
+		node_data = data;
+	}
+	else
+	{
+		if( memory_copy(
+		     &( btree_node->data[ entries_table_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			goto on_error;
+		}
+		node_data = &( btree_node->data[ entries_table_size ] );
+	}
 	data_offset += btree_node->node_header->entries_data_offset;
 
 	entries_data_offset = btree_node->node_header->entries_data_offset + (uint16_t) ( sizeof( fsapfs_object_t ) + sizeof( fsapfs_btree_node_header_t ) );
@@ -597,76 +872,28 @@ int libfsapfs_btree_node_read_data(
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
 #endif
-		if( libfsapfs_btree_entry_initialize(
-		     &btree_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create B-tree entry.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfsapfs_btree_entry_set_key_data(
-		     btree_entry,
-		     &( data[ key_data_offset ] ),
-		     (size_t) key_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set key data in B-tree entry.",
-			 function );
+		btree_entry = &( btree_node->entries[ map_entry_index ] );
 
-			goto on_error;
-		}
-		if( libfsapfs_btree_entry_set_value_data(
-		     btree_entry,
-		     &( data[ value_data_offset ] ),
-		     (size_t) value_data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value data in B-tree entry.",
-			 function );
-
-			goto on_error;
-		}
-		if( libcdata_array_append_entry(
-		     btree_node->entries_array,
-		     &entry_index,
-		     (intptr_t *) btree_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append B-tree entry: %" PRIu32 " to array.",
-			 function,
-			 map_entry_index );
-
-			goto on_error;
-		}
-		btree_entry = NULL;
+		btree_entry->key_data        = &( node_data[ key_data_offset ] );
+		btree_entry->key_data_size   = (size_t) key_data_size;
+		btree_entry->value_data      = &( node_data[ value_data_offset ] );
+		btree_entry->value_data_size = (size_t) value_data_size;
 	}
+	btree_node->number_of_entries = (int) btree_node->node_header->number_of_keys;
+
 	return( 1 );
 
 on_error:
-	if( btree_entry != NULL )
+	if( btree_node->data != NULL )
 	{
-		libfsapfs_btree_entry_free(
-		 &btree_entry,
-		 NULL );
+		memory_free(
+		 btree_node->data );
+
+		btree_node->data = NULL;
 	}
+	btree_node->data_size = 0;
+	btree_node->entries   = NULL;
+
 	if( btree_node->footer != NULL )
 	{
 		libfsapfs_btree_footer_free(
@@ -868,20 +1095,19 @@ int libfsapfs_btree_node_get_number_of_entries(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     btree_node->entries_array,
-	     number_of_entries,
-	     error ) != 1 )
+	if( number_of_entries == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from array.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
 		 function );
 
 		return( -1 );
 	}
+	*number_of_entries = btree_node->number_of_entries;
+
 	return( 1 );
 }
 
@@ -907,22 +1133,132 @@ int libfsapfs_btree_node_get_entry_by_index(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     btree_node->entries_array,
-	     entry_index,
-	     (intptr_t **) btree_entry,
-	     error ) != 1 )
+	if( ( entry_index < 0 )
+	 || ( entry_index >= btree_node->number_of_entries ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve entry: %d from array.",
-		 function,
-		 entry_index );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree entry.",
+		 function );
 
 		return( -1 );
 	}
+	*btree_entry = &( btree_node->entries[ entry_index ] );
+
 	return( 1 );
 }
 
+/* Searches the B-tree entries for a specific key
+ * The entries are stored in ascending key order hence a binary search is used
+ * The entry index is set to the index of the first entry with a key that is greater than or equal
+ * to the key value or to the number of entries if no such entry exists
+ * Returns 1 if an entry with an equal key was found, 0 if not or -1 on error
+ */
+int libfsapfs_btree_node_search_entry_by_key(
+     libfsapfs_btree_node_t *btree_node,
+     intptr_t *key_value,
+     int (*key_compare_function)(
+            intptr_t *key_value,
+            const uint8_t *key_data,
+            size_t key_data_size,
+            libcerror_error_t **error ),
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *btree_entry = NULL;
+	static char *function                = "libfsapfs_btree_node_search_entry_by_key";
+	int compare_result                   = 0;
+	int lower_entry_index                = 0;
+	int middle_entry_index               = 0;
+	int result                           = 0;
+	int upper_entry_index                = 0;
+
+	if( btree_node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_compare_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key compare function.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	upper_entry_index = btree_node->number_of_entries;
+
+	while( lower_entry_index < upper_entry_index )
+	{
+		middle_entry_index = lower_entry_index + ( ( upper_entry_index - lower_entry_index ) / 2 );
+
+		btree_entry = &( btree_node->entries[ middle_entry_index ] );
+
+		compare_result = key_compare_function(
+		                  key_value,
+		                  btree_entry->key_data,
+		                  btree_entry->key_data_size,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare key value with key of entry: %d.",
+			 function,
+			 middle_entry_index );
+
+			return( -1 );
+		}
+		if( compare_result == LIBFSAPFS_COMPARE_GREATER )
+		{
+			lower_entry_index = middle_entry_index + 1;
+		}
+		else
+		{
+			upper_entry_index = middle_entry_index;
+
+			/* The last entry that narrows the upper bound is the resulting entry
+			 */
+			result = ( compare_result == LIBFSAPFS_COMPARE_EQUAL ) ? 1 : 0;
+		}
+	}
+	*entry_index = lower_entry_index;
+
+	return( result );
+}
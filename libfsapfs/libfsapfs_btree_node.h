@@ -28,7 +28,9 @@
 #include "libfsapfs_btree_entry.h"
 #include "libfsapfs_btree_footer.h"
 #include "libfsapfs_btree_node_header.h"
-#include "libfsapfs_libcdata.h"
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_io_handle.h"
+#include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
 
 #if defined( __cplusplus )
@@ -55,9 +57,35 @@ struct libfsapfs_btree_node
 	 */
 	libfsapfs_btree_footer_t *footer;
 
-	/* The B-tree entries array
+	/* The data, contains the entries table followed by a copy of the node data
+	 * or only the entries table if the node data is referenced
 	 */
-	libcdata_array_t *entries_array;
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The B-tree entries table, the key and value data of the entries
+	 * reference the copy of the node data
+	 */
+	libfsapfs_btree_entry_t *entries;
+
+	/* The number of B-tree entries
+	 */
+	int number_of_entries;
+
+	/* The physical block number the node was read from
+	 */
+	uint64_t block_number;
+
+	/* The number of references to the node held by node cache users
+	 */
+	int reference_count;
+
+	/* Value to indicate the node is stored in a node cache
+	 */
+	uint8_t is_cached;
 };
 
 int libfsapfs_btree_node_initialize(
@@ -68,12 +96,27 @@ int libfsapfs_btree_node_free(
      libfsapfs_btree_node_t **btree_node,
      libcerror_error_t **error );
 
+int libfsapfs_btree_node_read_file_io_handle(
+     libfsapfs_btree_node_t *btree_node,
+     libfsapfs_io_handle_t *io_handle,
+     libfsapfs_encryption_context_t *encryption_context,
+     libbfio_handle_t *file_io_handle,
+     uint64_t block_number,
+     libcerror_error_t **error );
+
 int libfsapfs_btree_node_read_data(
      libfsapfs_btree_node_t *btree_node,
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsapfs_btree_node_read_data_with_flags(
+     libfsapfs_btree_node_t *btree_node,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 int libfsapfs_btree_node_read_object_data(
      libfsapfs_btree_node_t *btree_node,
      const uint8_t *data,
@@ -95,6 +138,17 @@ int libfsapfs_btree_node_get_entry_by_index(
      libfsapfs_btree_entry_t **btree_entry,
      libcerror_error_t **error );
 
+int libfsapfs_btree_node_search_entry_by_key(
+     libfsapfs_btree_node_t *btree_node,
+     intptr_t *key_value,
+     int (*key_compare_function)(
+            intptr_t *key_value,
+            const uint8_t *key_data,
+            size_t key_data_size,
+            libcerror_error_t **error ),
+     int *entry_index,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
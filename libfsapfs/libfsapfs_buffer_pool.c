@@ -0,0 +1,537 @@
+/*
+ * Data block buffer pool functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_buffer_pool.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+/* Creates a buffer pool
+ * The pool keeps released buffers of 1 up to LIBFSAPFS_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES
+ * times the buffer size for reuse
+ * Make sure the value buffer_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_buffer_pool_initialize(
+     libfsapfs_buffer_pool_t **buffer_pool,
+     size_t buffer_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_buffer_pool_initialize";
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid buffer pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( buffer_size == 0 )
+	 || ( buffer_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / LIBFSAPFS_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid buffer size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer_pool = memory_allocate_structure(
+	                libfsapfs_buffer_pool_t );
+
+	if( *buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *buffer_pool,
+	     0,
+	     sizeof( libfsapfs_buffer_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer pool.",
+		 function );
+
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *buffer_pool )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *buffer_pool )->buffer_size = buffer_size;
+
+	return( 1 );
+
+on_error:
+	if( *buffer_pool != NULL )
+	{
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a buffer pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_buffer_pool_free(
+     libfsapfs_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_buffer_pool_free";
+	int buffer_index      = 0;
+	int result            = 1;
+	int size_class        = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer_pool != NULL )
+	{
+		for( size_class = 0;
+		     size_class < LIBFSAPFS_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES;
+		     size_class++ )
+		{
+			for( buffer_index = 0;
+			     buffer_index < ( *buffer_pool )->number_of_buffers[ size_class ];
+			     buffer_index++ )
+			{
+				memory_free(
+				 ( *buffer_pool )->buffers[ size_class ][ buffer_index ] );
+			}
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *buffer_pool )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *buffer_pool );
+
+		*buffer_pool = NULL;
+	}
+	return( result );
+}
+
+/* Determines the size class of a buffer size
+ * Returns 1 if successful, 0 if the size is not kept by the pool or -1 on error
+ */
+int libfsapfs_buffer_pool_get_size_class(
+     libfsapfs_buffer_pool_t *buffer_pool,
+     size_t size,
+     int *size_class,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfsapfs_buffer_pool_get_size_class";
+	size_t number_of_units = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_pool->buffer_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid buffer pool - missing buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( size_class == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size class.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( ( size % buffer_pool->buffer_size ) != 0 ) )
+	{
+		return( 0 );
+	}
+	number_of_units = size / buffer_pool->buffer_size;
+
+	if( number_of_units > LIBFSAPFS_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES )
+	{
+		return( 0 );
+	}
+	*size_class = (int) number_of_units - 1;
+
+	return( 1 );
+}
+
+/* Retrieves a buffer of a specific size
+ * A previously released buffer is reused if available, otherwise a new buffer is allocated
+ * The contents of the buffer are undefined
+ * The buffer must be returned with libfsapfs_buffer_pool_release_buffer using the same size
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_buffer_pool_get_buffer(
+     libfsapfs_buffer_pool_t *buffer_pool,
+     size_t size,
+     uint8_t **buffer,
+     libcerror_error_t **error )
+{
+	uint8_t *pooled_buffer = NULL;
+	static char *function  = "libfsapfs_buffer_pool_get_buffer";
+	int result             = 0;
+	int size_class         = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsapfs_buffer_pool_get_size_class(
+	          buffer_pool,
+	          size,
+	          &size_class,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size class.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     buffer_pool->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( buffer_pool->number_of_buffers[ size_class ] > 0 )
+		{
+			buffer_pool->number_of_buffers[ size_class ] -= 1;
+
+			pooled_buffer = buffer_pool->buffers[ size_class ][ buffer_pool->number_of_buffers[ size_class ] ];
+
+			buffer_pool->buffers[ size_class ][ buffer_pool->number_of_buffers[ size_class ] ] = NULL;
+
+			buffer_pool->number_of_reuses += 1;
+		}
+		else
+		{
+			buffer_pool->number_of_allocations += 1;
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     buffer_pool->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			if( pooled_buffer != NULL )
+			{
+				memory_free(
+				 pooled_buffer );
+			}
+			return( -1 );
+		}
+#endif
+	}
+	if( pooled_buffer == NULL )
+	{
+		pooled_buffer = (uint8_t *) memory_allocate(
+		                             sizeof( uint8_t ) * size );
+
+		if( pooled_buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*buffer = pooled_buffer;
+
+	return( 1 );
+}
+
+/* Releases a buffer retrieved with libfsapfs_buffer_pool_get_buffer
+ * The buffer is cleared and kept for reuse if the pool has room for it, otherwise it is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_buffer_pool_release_buffer(
+     libfsapfs_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_buffer_pool_release_buffer";
+	int result            = 0;
+	int size_class        = 0;
+
+	if( buffer_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( *buffer == NULL )
+	{
+		return( 1 );
+	}
+	/* Clear the buffer so that no data, such as decrypted data, outlives its use
+	 */
+	if( memory_set(
+	     *buffer,
+	     0,
+	     size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buffer.",
+		 function );
+
+		goto on_error;
+	}
+	result = libfsapfs_buffer_pool_get_size_class(
+	          buffer_pool,
+	          size,
+	          &size_class,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size class.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     buffer_pool->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( buffer_pool->number_of_buffers[ size_class ] < LIBFSAPFS_BUFFER_POOL_MAXIMUM_NUMBER_OF_BUFFERS )
+		{
+			buffer_pool->buffers[ size_class ][ buffer_pool->number_of_buffers[ size_class ] ] = *buffer;
+
+			buffer_pool->number_of_buffers[ size_class ] += 1;
+
+			*buffer = NULL;
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     buffer_pool->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( *buffer != NULL )
+	{
+		memory_free(
+		 *buffer );
+
+		*buffer = NULL;
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,99 @@
+/*
+ * Data block buffer pool functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_BUFFER_POOL_H )
+#define _LIBFSAPFS_BUFFER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_buffer_pool libfsapfs_buffer_pool_t;
+
+struct libfsapfs_buffer_pool
+{
+	/* The buffer size of the smallest size class, the buffer size of size class N is N + 1 times this size
+	 */
+	size_t buffer_size;
+
+	/* The free buffers per size class
+	 */
+	uint8_t *buffers[ LIBFSAPFS_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES ][ LIBFSAPFS_BUFFER_POOL_MAXIMUM_NUMBER_OF_BUFFERS ];
+
+	/* The number of free buffers per size class
+	 */
+	int number_of_buffers[ LIBFSAPFS_BUFFER_POOL_NUMBER_OF_SIZE_CLASSES ];
+
+	/* The number of buffers that were allocated
+	 */
+	uint64_t number_of_allocations;
+
+	/* The number of buffers that were reused
+	 */
+	uint64_t number_of_reuses;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsapfs_buffer_pool_initialize(
+     libfsapfs_buffer_pool_t **buffer_pool,
+     size_t buffer_size,
+     libcerror_error_t **error );
+
+int libfsapfs_buffer_pool_free(
+     libfsapfs_buffer_pool_t **buffer_pool,
+     libcerror_error_t **error );
+
+int libfsapfs_buffer_pool_get_size_class(
+     libfsapfs_buffer_pool_t *buffer_pool,
+     size_t size,
+     int *size_class,
+     libcerror_error_t **error );
+
+int libfsapfs_buffer_pool_get_buffer(
+     libfsapfs_buffer_pool_t *buffer_pool,
+     size_t size,
+     uint8_t **buffer,
+     libcerror_error_t **error );
+
+int libfsapfs_buffer_pool_release_buffer(
+     libfsapfs_buffer_pool_t *buffer_pool,
+     uint8_t **buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_BUFFER_POOL_H ) */
+
@@ -0,0 +1,602 @@
+/*
+ * Cache statistics functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_cache_statistics.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_libfcache.h"
+
+/* Creates cache statistics
+ * Make sure the value cache_statistics is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_statistics_initialize(
+     libfsapfs_cache_statistics_t **cache_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_cache_statistics_initialize";
+
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_statistics != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid cache statistics value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_statistics = memory_allocate_structure(
+	                     libfsapfs_cache_statistics_t );
+
+	if( *cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create cache statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *cache_statistics,
+	     0,
+	     sizeof( libfsapfs_cache_statistics_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear cache statistics.",
+		 function );
+
+		memory_free(
+		 *cache_statistics );
+
+		*cache_statistics = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *cache_statistics )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *cache_statistics != NULL )
+	{
+		memory_free(
+		 *cache_statistics );
+
+		*cache_statistics = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_statistics_free(
+     libfsapfs_cache_statistics_t **cache_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_cache_statistics_free";
+	int result            = 1;
+
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( *cache_statistics != NULL )
+	{
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *cache_statistics )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *cache_statistics );
+
+		*cache_statistics = NULL;
+	}
+	return( result );
+}
+
+/* Clears the cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_statistics_clear(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_cache_statistics_clear";
+
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     cache_statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_statistics->number_of_lookups   = 0;
+	cache_statistics->number_of_misses    = 0;
+	cache_statistics->number_of_evictions = 0;
+	cache_statistics->resident_size       = 0;
+	cache_statistics->read_size           = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     cache_statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds lookups to the cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_statistics_add_lookups(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     uint64_t number_of_lookups,
+     uint64_t number_of_misses,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_cache_statistics_add_lookups";
+
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     cache_statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_statistics->number_of_lookups += number_of_lookups;
+	cache_statistics->number_of_misses  += number_of_misses;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     cache_statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Updates the cache statistics after values were added to or removed from the cache
+ * The resident size is not reduced below 0
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_statistics_update(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     uint64_t number_of_evictions,
+     size64_t added_size,
+     size64_t removed_size,
+     size64_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_cache_statistics_update";
+
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     cache_statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cache_statistics->number_of_evictions += number_of_evictions;
+	cache_statistics->resident_size       += added_size;
+	cache_statistics->read_size           += read_size;
+
+	if( removed_size > cache_statistics->resident_size )
+	{
+		cache_statistics->resident_size = 0;
+	}
+	else
+	{
+		cache_statistics->resident_size -= removed_size;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     cache_statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Updates the cache statistics after a value was added to the cache
+ * The previous number of cache values is the number before the value was added,
+ * if it did not change an existing value was evicted
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_statistics_add_value(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     libfcache_cache_t *cache,
+     int previous_number_of_cache_values,
+     size64_t value_size,
+     size64_t read_size,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfsapfs_cache_statistics_add_value";
+	uint64_t number_of_evictions = 0;
+	int number_of_cache_values   = 0;
+
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_cache_values(
+	     cache,
+	     &number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache values.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_cache_values > previous_number_of_cache_values )
+	{
+		number_of_evictions = 0;
+	}
+	else
+	{
+		number_of_evictions = 1;
+		value_size          = 0;
+	}
+	if( libfsapfs_cache_statistics_update(
+	     cache_statistics,
+	     number_of_evictions,
+	     value_size,
+	     0,
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Updates the cache statistics before the cache is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_statistics_release_cache(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     libfcache_cache_t *cache,
+     size64_t value_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsapfs_cache_statistics_release_cache";
+	int number_of_cache_values = 0;
+
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfcache_cache_get_number_of_cache_values(
+	     cache,
+	     &number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_cache_statistics_update(
+	     cache_statistics,
+	     0,
+	     0,
+	     (size64_t) number_of_cache_values * value_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the cache statistics values
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_cache_statistics_get_values(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     uint64_t *number_of_lookups,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     size64_t *resident_size,
+     size64_t *read_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_cache_statistics_get_values";
+
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lookups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of lookups.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+	if( resident_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resident size.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     cache_statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_lookups   = cache_statistics->number_of_lookups;
+	*number_of_misses    = cache_statistics->number_of_misses;
+	*number_of_evictions = cache_statistics->number_of_evictions;
+	*resident_size       = cache_statistics->resident_size;
+	*read_size           = cache_statistics->read_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     cache_statistics->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
@@ -0,0 +1,121 @@
+/*
+ * Cache statistics functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_CACHE_STATISTICS_H )
+#define _LIBFSAPFS_CACHE_STATISTICS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_libfcache.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_cache_statistics libfsapfs_cache_statistics_t;
+
+struct libfsapfs_cache_statistics
+{
+	/* The number of lookups
+	 */
+	uint64_t number_of_lookups;
+
+	/* The number of lookups that did not find a cached value
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of cached values that were replaced by another value
+	 */
+	uint64_t number_of_evictions;
+
+	/* The size of the cached values in bytes
+	 */
+	size64_t resident_size;
+
+	/* The number of bytes read to fill the cache
+	 */
+	size64_t read_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsapfs_cache_statistics_initialize(
+     libfsapfs_cache_statistics_t **cache_statistics,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_statistics_free(
+     libfsapfs_cache_statistics_t **cache_statistics,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_statistics_clear(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_statistics_add_lookups(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     uint64_t number_of_lookups,
+     uint64_t number_of_misses,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_statistics_update(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     uint64_t number_of_evictions,
+     size64_t added_size,
+     size64_t removed_size,
+     size64_t read_size,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_statistics_add_value(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     libfcache_cache_t *cache,
+     int previous_number_of_cache_values,
+     size64_t value_size,
+     size64_t read_size,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_statistics_release_cache(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     libfcache_cache_t *cache,
+     size64_t value_size,
+     libcerror_error_t **error );
+
+int libfsapfs_cache_statistics_get_values(
+     libfsapfs_cache_statistics_t *cache_statistics,
+     uint64_t *number_of_lookups,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     size64_t *resident_size,
+     size64_t *read_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_CACHE_STATISTICS_H ) */
+
@@ -26,6 +26,8 @@
 
 #include "libfsapfs_compressed_data_handle.h"
 #include "libfsapfs_compression.h"
+#include "libfsapfs_decompressed_data_cache.h"
+#include "libfsapfs_decompression_pool.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
@@ -81,6 +83,7 @@ int libfsapfs_compressed_data_handle_initialize(
 		return( -1 );
 	}
 	if( ( compression_method != LIBFSAPFS_COMPRESSION_METHOD_DEFLATE )
+	 && ( compression_method != LIBFSAPFS_COMPRESSION_METHOD_LZFSE )
 	 && ( compression_method != LIBFSAPFS_COMPRESSION_METHOD_LZVN )
 	 && ( compression_method != LIBFSAPFS_COMPRESSION_METHOD_UNKNOWN5 ) )
 	{
@@ -222,6 +225,21 @@ int libfsapfs_compressed_data_handle_free(
 			memory_free(
 			 ( *data_handle )->compressed_block_offsets );
 		}
+		if( ( *data_handle )->decompressed_blocks_compressed_data != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->decompressed_blocks_compressed_data );
+		}
+		if( ( *data_handle )->decompressed_blocks_data != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->decompressed_blocks_data );
+		}
+		if( ( *data_handle )->decompressed_blocks_data_sizes != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->decompressed_blocks_data_sizes );
+		}
 		memory_free(
 		 *data_handle );
 
@@ -230,6 +248,97 @@ int libfsapfs_compressed_data_handle_free(
 	return( 1 );
 }
 
+/* Sets the decompressed data cache
+ * The compressed blocks of the data are cached by file system and transaction identifier
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_compressed_data_handle_set_decompressed_data_cache(
+     libfsapfs_compressed_data_handle_t *data_handle,
+     libfsapfs_decompressed_data_cache_t *decompressed_data_cache,
+     uint64_t identifier,
+     uint64_t transaction_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_compressed_data_handle_set_decompressed_data_cache";
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->decompressed_data_cache = decompressed_data_cache;
+	data_handle->identifier              = identifier;
+	data_handle->transaction_identifier  = transaction_identifier;
+
+	return( 1 );
+}
+
+/* Sets the decompression pool
+ * Reads that span multiple compressed blocks and sequential reads are decompressed
+ * concurrently by the decompression pool, where sequential reads are decompressed
+ * up to the maximum read-ahead size ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_compressed_data_handle_set_decompression_pool(
+     libfsapfs_compressed_data_handle_t *data_handle,
+     libfsapfs_decompression_pool_t *decompression_pool,
+     size64_t maximum_read_ahead_size,
+     libcerror_error_t **error )
+{
+	static char *function                          = "libfsapfs_compressed_data_handle_set_decompression_pool";
+	uint32_t maximum_number_of_decompressed_blocks = 0;
+	uint32_t maximum_number_of_read_ahead_blocks   = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->decompressed_blocks_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data handle - decompressed blocks data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( decompression_pool != NULL )
+	{
+		maximum_number_of_read_ahead_blocks = (uint32_t) ( maximum_read_ahead_size / LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE );
+
+		if( maximum_number_of_read_ahead_blocks > LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSED_BLOCKS )
+		{
+			maximum_number_of_read_ahead_blocks = LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSED_BLOCKS;
+		}
+		maximum_number_of_decompressed_blocks = (uint32_t) decompression_pool->number_of_workers;
+
+		if( maximum_number_of_decompressed_blocks < maximum_number_of_read_ahead_blocks )
+		{
+			maximum_number_of_decompressed_blocks = maximum_number_of_read_ahead_blocks;
+		}
+	}
+	data_handle->decompression_pool                    = decompression_pool;
+	data_handle->maximum_number_of_decompressed_blocks = maximum_number_of_decompressed_blocks;
+	data_handle->maximum_number_of_read_ahead_blocks   = maximum_number_of_read_ahead_blocks;
+
+	return( 1 );
+}
+
 /* Determines the compressed block offsets
  * Returns 1 if successful or -1 on error
  */
@@ -459,7 +568,8 @@ int libfsapfs_compressed_data_handle_get_compressed_block_offsets(
 		compressed_descriptors_offset   += 4;
 		compressed_block_descriptor_size = 8;
 	}
-	else if( data_handle->compression_method == LIBFSAPFS_COMPRESSION_METHOD_LZVN )
+	else if( ( data_handle->compression_method == LIBFSAPFS_COMPRESSION_METHOD_LZFSE )
+	      || ( data_handle->compression_method == LIBFSAPFS_COMPRESSION_METHOD_LZVN ) )
 	{
 		segment_data_offset = 0;
 
@@ -800,6 +910,394 @@ on_error:
 	return( -1 );
 }
 
+/* Reads and decompresses a specific compressed block
+ * The uncompressed data size contains the available size of the uncompressed data
+ * and is set to the size of the uncompressed block
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_compressed_data_handle_read_compressed_block(
+     libfsapfs_compressed_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t compressed_block_index,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function             = "libfsapfs_compressed_data_handle_read_compressed_block";
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	off64_t data_stream_offset        = 0;
+	off64_t uncompressed_block_offset = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->compressed_block_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing compressed block offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block_index >= data_handle->number_of_compressed_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size < LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid uncompressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	data_stream_offset = data_handle->compressed_block_offsets[ compressed_block_index ];
+	read_size          = (size_t) ( data_handle->compressed_block_offsets[ compressed_block_index + 1 ] - data_stream_offset );
+
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              data_handle->compressed_data_stream,
+	              (intptr_t *) file_io_handle,
+	              (uint8_t *) data_handle->compressed_segment_data,
+	              read_size,
+	              data_stream_offset,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x08%" PRIx64 ") from data stream.",
+		 function,
+		 data_stream_offset,
+		 data_stream_offset );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: compressed block data:\n",
+		 function );
+		libcnotify_print_data(
+		 data_handle->compressed_segment_data,
+		 read_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	*uncompressed_data_size = LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE;
+
+	if( libfsapfs_decompress_data(
+	     data_handle->compressed_segment_data,
+	     (size_t) read_count,
+	     data_handle->compression_method,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: uncompressed block data:\n",
+		 function );
+		libcnotify_print_data(
+		 uncompressed_data,
+		 *uncompressed_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	uncompressed_block_offset = ( compressed_block_index + 1 ) * LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE;
+
+	if( ( (size64_t) uncompressed_block_offset < data_handle->uncompressed_data_size )
+	 && ( *uncompressed_data_size != LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed segment data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads and decompresses consecutive compressed blocks
+ * The compressed data of the blocks is read at once and the blocks are decompressed
+ * concurrently by the decompression pool, where every block is decompressed into
+ * its own block size part of the uncompressed data
+ * The uncompressed sizes of the blocks are stored in the decompressed blocks data sizes
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_compressed_data_handle_read_compressed_blocks(
+     libfsapfs_compressed_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t compressed_block_index,
+     uint32_t number_of_blocks,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *compressed_data          = NULL;
+	static char *function             = "libfsapfs_compressed_data_handle_read_compressed_blocks";
+	size_t read_size                  = 0;
+	ssize_t read_count                = 0;
+	off64_t data_stream_offset        = 0;
+	off64_t uncompressed_block_offset = 0;
+	uint32_t block_index              = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->compressed_block_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing compressed block offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->decompression_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing decompression pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block_index >= data_handle->number_of_compressed_blocks )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed block index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_blocks == 0 )
+	 || ( number_of_blocks > data_handle->maximum_number_of_decompressed_blocks )
+	 || ( number_of_blocks > ( data_handle->number_of_compressed_blocks - compressed_block_index ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of blocks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( uncompressed_data_size > (size_t) SSIZE_MAX )
+	 || ( ( uncompressed_data_size / LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE ) < (size_t) number_of_blocks ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid uncompressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The decompressed blocks data sizes are reused hence the decompressed blocks
+	 * no longer contain valid data
+	 */
+	data_handle->number_of_decompressed_blocks = 0;
+
+	if( data_handle->decompressed_blocks_data_sizes == NULL )
+	{
+		data_handle->decompressed_blocks_data_sizes = (size_t *) memory_allocate(
+		                                                          sizeof( size_t ) * data_handle->maximum_number_of_decompressed_blocks );
+
+		if( data_handle->decompressed_blocks_data_sizes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create decompressed blocks data sizes.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The compressed blocks are stored consecutively hence their data is read at once
+	 */
+	data_stream_offset = data_handle->compressed_block_offsets[ compressed_block_index ];
+	read_size          = (size_t) ( data_handle->compressed_block_offsets[ compressed_block_index + number_of_blocks ] - data_stream_offset );
+
+	if( read_size > data_handle->decompressed_blocks_compressed_data_size )
+	{
+		compressed_data = (uint8_t *) memory_reallocate(
+		                               data_handle->decompressed_blocks_compressed_data,
+		                               sizeof( uint8_t ) * read_size );
+
+		if( compressed_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize decompressed blocks compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		data_handle->decompressed_blocks_compressed_data      = compressed_data;
+		data_handle->decompressed_blocks_compressed_data_size = read_size;
+	}
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              data_handle->compressed_data_stream,
+	              (intptr_t *) file_io_handle,
+	              data_handle->decompressed_blocks_compressed_data,
+	              read_size,
+	              data_stream_offset,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset: %" PRIi64 " (0x08%" PRIx64 ") from data stream.",
+		 function,
+		 data_stream_offset,
+		 data_stream_offset );
+
+		return( -1 );
+	}
+	if( libfsapfs_decompression_pool_decompress(
+	     data_handle->decompression_pool,
+	     data_handle->compression_method,
+	     data_handle->decompressed_blocks_compressed_data,
+	     read_size,
+	     &( data_handle->compressed_block_offsets[ compressed_block_index ] ),
+	     (int) number_of_blocks,
+	     uncompressed_data,
+	     uncompressed_data_size,
+	     LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE,
+	     data_handle->decompressed_blocks_data_sizes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		uncompressed_block_offset = ( compressed_block_index + block_index + 1 ) * LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE;
+
+		if( ( (size64_t) uncompressed_block_offset < data_handle->uncompressed_data_size )
+		 && ( data_handle->decompressed_blocks_data_sizes[ block_index ] != LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid uncompressed block: %" PRIu32 " data size value out of bounds.",
+			 function,
+			 compressed_block_index + block_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
 /* Reads data from the current offset into a compressed
  * Callback for the data stream
  * Returns the number of bytes read or -1 on error
@@ -819,10 +1317,15 @@ ssize_t libfsapfs_compressed_data_handle_read_segment_data(
 	size_t data_offset                = 0;
 	size_t read_size                  = 0;
 	size_t segment_data_offset        = 0;
-	ssize_t read_count                = 0;
-	off64_t data_stream_offset        = 0;
-	off64_t uncompressed_block_offset = 0;
+	off64_t read_end_offset           = 0;
 	uint32_t compressed_block_index   = 0;
+	uint32_t decompressed_block       = 0;
+	uint32_t number_of_blocks         = 0;
+	uint32_t number_of_direct_blocks  = 0;
+	uint32_t number_of_spanned_blocks = 0;
+	uint8_t in_decompressed_blocks    = 0;
+	uint8_t insert_into_cache         = 0;
+	int result                        = 0;
 
 	LIBFSAPFS_UNREFERENCED_PARAMETER( file_io_handle )
 	LIBFSAPFS_UNREFERENCED_PARAMETER( segment_file_index )
@@ -922,6 +1425,23 @@ ssize_t libfsapfs_compressed_data_handle_read_segment_data(
 
 		return( (ssize_t) read_size );
 	}
+	if( data_handle->current_segment_offset == data_handle->next_read_offset )
+	{
+		if( data_handle->number_of_sequential_reads < LIBFSAPFS_READ_AHEAD_MINIMUM_NUMBER_OF_SEQUENTIAL_READS )
+		{
+			data_handle->number_of_sequential_reads += 1;
+		}
+	}
+	else
+	{
+		data_handle->number_of_sequential_reads = 0;
+	}
+	read_end_offset = data_handle->current_segment_offset + segment_data_size;
+
+	if( (size64_t) read_end_offset > data_handle->uncompressed_data_size )
+	{
+		read_end_offset = (off64_t) data_handle->uncompressed_data_size;
+	}
 	compressed_block_index = (uint32_t) ( data_handle->current_segment_offset / LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE );
 	segment_data_offset    = 0;
 	data_offset            = (size_t) ( data_handle->current_segment_offset % LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE );
@@ -941,87 +1461,325 @@ ssize_t libfsapfs_compressed_data_handle_read_segment_data(
 		}
 		if( data_handle->current_compressed_block_index != compressed_block_index )
 		{
-			data_stream_offset = data_handle->compressed_block_offsets[ compressed_block_index ];
-			read_size          = (size_t) ( data_handle->compressed_block_offsets[ compressed_block_index + 1 ] - data_stream_offset );
-
-			read_count = libfdata_stream_read_buffer_at_offset(
-			              data_handle->compressed_data_stream,
-			              (intptr_t *) file_io_handle,
-			              (uint8_t *) data_handle->compressed_segment_data,
-			              read_size,
-			              data_stream_offset,
-			              0,
-			              error );
-
-			if( read_count != (ssize_t) read_size )
+			in_decompressed_blocks = 0;
+
+			if( ( data_handle->number_of_decompressed_blocks > 0 )
+			 && ( compressed_block_index >= data_handle->decompressed_blocks_index )
+			 && ( ( compressed_block_index - data_handle->decompressed_blocks_index ) < data_handle->number_of_decompressed_blocks ) )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read buffer at offset: %" PRIi64 " (0x08%" PRIx64 ") from data stream.",
-				 function,
-				 data_stream_offset,
-				 data_stream_offset );
+				in_decompressed_blocks = 1;
+			}
+			/* Determine the number of compressed blocks to decompress, which are the compressed blocks
+			 * spanned by the read, or when reading sequentially the maximum number of read-ahead blocks
+			 */
+			number_of_spanned_blocks = (uint32_t) ( ( read_end_offset - 1 ) / LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE ) - compressed_block_index + 1;
+			number_of_blocks         = 1;
+
+			if( data_handle->decompression_pool != NULL )
+			{
+				number_of_blocks = number_of_spanned_blocks;
 
-				return( -1 );
+				if( ( data_handle->number_of_sequential_reads >= LIBFSAPFS_READ_AHEAD_MINIMUM_NUMBER_OF_SEQUENTIAL_READS )
+				 && ( number_of_blocks < data_handle->maximum_number_of_read_ahead_blocks ) )
+				{
+					number_of_blocks = data_handle->maximum_number_of_read_ahead_blocks;
+				}
+				if( number_of_blocks > data_handle->maximum_number_of_decompressed_blocks )
+				{
+					number_of_blocks = data_handle->maximum_number_of_decompressed_blocks;
+				}
+				if( number_of_blocks > ( data_handle->number_of_compressed_blocks - compressed_block_index ) )
+				{
+					number_of_blocks = data_handle->number_of_compressed_blocks - compressed_block_index;
+				}
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			/* Whole compressed blocks that are not read ahead are decompressed directly into the segment data
+			 */
+			number_of_direct_blocks = 0;
+
+			if( ( in_decompressed_blocks == 0 )
+			 && ( data_offset == 0 )
+			 && ( number_of_blocks <= number_of_spanned_blocks ) )
 			{
-				libcnotify_printf(
-				 "%s: compressed block data:\n",
-				 function );
-				libcnotify_print_data(
-				 data_handle->compressed_segment_data,
-				 read_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+				number_of_direct_blocks = (uint32_t) ( ( read_end_offset - ( (off64_t) compressed_block_index * LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE ) ) / LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE );
+
+				if( number_of_direct_blocks > number_of_blocks )
+				{
+					number_of_direct_blocks = number_of_blocks;
+				}
 			}
-#endif
-			data_handle->segment_data_size = LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE;
-
-			if( libfsapfs_decompress_data(
-			     data_handle->compressed_segment_data,
-			     (size_t) read_count,
-			     data_handle->compression_method,
-			     data_handle->segment_data,
-			     &( data_handle->segment_data_size ),
-			     error ) != 1 )
+			if( number_of_direct_blocks > 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-				 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-				 "%s: unable to decompress data.",
-				 function );
+				read_size = LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE;
+				result    = 0;
 
-				return( -1 );
+				if( data_handle->decompressed_data_cache != NULL )
+				{
+					result = libfsapfs_decompressed_data_cache_get_data(
+					          data_handle->decompressed_data_cache,
+					          data_handle->identifier,
+					          data_handle->transaction_identifier,
+					          compressed_block_index,
+					          &( segment_data[ segment_data_offset ] ),
+					          LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE,
+					          &read_size,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve compressed block: %" PRIu32 " from decompressed data cache.",
+						 function,
+						 compressed_block_index );
+
+						return( -1 );
+					}
+					else if( result != 0 )
+					{
+						number_of_direct_blocks = 1;
+					}
+				}
+				if( result == 0 )
+				{
+					if( number_of_direct_blocks > 1 )
+					{
+						if( libfsapfs_compressed_data_handle_read_compressed_blocks(
+						     data_handle,
+						     (libbfio_handle_t *) file_io_handle,
+						     compressed_block_index,
+						     number_of_direct_blocks,
+						     &( segment_data[ segment_data_offset ] ),
+						     segment_data_size,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_READ_FAILED,
+							 "%s: unable to read compressed blocks: %" PRIu32 " - %" PRIu32 ".",
+							 function,
+							 compressed_block_index,
+							 compressed_block_index + number_of_direct_blocks - 1 );
+
+							return( -1 );
+						}
+					}
+					else
+					{
+						if( libfsapfs_compressed_data_handle_read_compressed_block(
+						     data_handle,
+						     (libbfio_handle_t *) file_io_handle,
+						     compressed_block_index,
+						     &( segment_data[ segment_data_offset ] ),
+						     &read_size,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_IO,
+							 LIBCERROR_IO_ERROR_READ_FAILED,
+							 "%s: unable to read compressed block: %" PRIu32 ".",
+							 function,
+							 compressed_block_index );
+
+							return( -1 );
+						}
+					}
+				}
+				for( decompressed_block = 0;
+				     decompressed_block < number_of_direct_blocks;
+				     decompressed_block++ )
+				{
+					if( number_of_direct_blocks > 1 )
+					{
+						read_size = data_handle->decompressed_blocks_data_sizes[ decompressed_block ];
+					}
+					if( ( read_size == 0 )
+					 || ( read_size > segment_data_size ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid compressed block: %" PRIu32 " uncompressed data size value out of bounds.",
+						 function,
+						 compressed_block_index );
+
+						return( -1 );
+					}
+					if( ( result == 0 )
+					 && ( data_handle->decompressed_data_cache != NULL ) )
+					{
+						if( libfsapfs_decompressed_data_cache_insert_data(
+						     data_handle->decompressed_data_cache,
+						     data_handle->identifier,
+						     data_handle->transaction_identifier,
+						     compressed_block_index,
+						     &( segment_data[ segment_data_offset ] ),
+						     read_size,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+							 "%s: unable to insert compressed block: %" PRIu32 " into decompressed data cache.",
+							 function,
+							 compressed_block_index );
+
+							return( -1 );
+						}
+					}
+					segment_data_size   -= read_size;
+					segment_data_offset += read_size;
+
+					compressed_block_index++;
+				}
+				continue;
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			/* The segment data no longer contains the current compressed block if any of the following fails
+			 */
+			data_handle->current_compressed_block_index = (uint32_t) -1;
+
+			insert_into_cache = 0;
+			result            = 0;
+
+			if( in_decompressed_blocks != 0 )
 			{
-				libcnotify_printf(
-				 "%s: uncompressed block data:\n",
-				 function );
-				libcnotify_print_data(
-				 data_handle->segment_data,
-				 data_handle->segment_data_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+				decompressed_block = compressed_block_index - data_handle->decompressed_blocks_index;
+
+				data_handle->current_block_data = &( data_handle->decompressed_blocks_data[ decompressed_block * LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE ] );
+				data_handle->segment_data_size  = data_handle->decompressed_blocks_data_sizes[ decompressed_block ];
+
+				insert_into_cache = 1;
+				result            = 1;
 			}
-#endif
-			uncompressed_block_offset = ( compressed_block_index + 1 ) * LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE;
+			else if( data_handle->decompressed_data_cache != NULL )
+			{
+				data_handle->current_block_data = data_handle->segment_data;
+
+				result = libfsapfs_decompressed_data_cache_get_data(
+				          data_handle->decompressed_data_cache,
+				          data_handle->identifier,
+				          data_handle->transaction_identifier,
+				          compressed_block_index,
+				          data_handle->segment_data,
+				          LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE,
+				          &( data_handle->segment_data_size ),
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve compressed block: %" PRIu32 " from decompressed data cache.",
+					 function,
+					 compressed_block_index );
 
-			if( ( (size64_t) uncompressed_block_offset < data_handle->uncompressed_data_size )
-			 && ( data_handle->segment_data_size != LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE ) )
+					return( -1 );
+				}
+			}
+			if( result == 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid uncompressed segment data size value out of bounds.",
-				 function );
+				if( number_of_blocks > 1 )
+				{
+					if( data_handle->decompressed_blocks_data == NULL )
+					{
+						data_handle->decompressed_blocks_data = (uint8_t *) memory_allocate(
+						                                                     sizeof( uint8_t ) * LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE * data_handle->maximum_number_of_decompressed_blocks );
+
+						if( data_handle->decompressed_blocks_data == NULL )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_MEMORY,
+							 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+							 "%s: unable to create decompressed blocks data.",
+							 function );
+
+							return( -1 );
+						}
+					}
+					if( libfsapfs_compressed_data_handle_read_compressed_blocks(
+					     data_handle,
+					     (libbfio_handle_t *) file_io_handle,
+					     compressed_block_index,
+					     number_of_blocks,
+					     data_handle->decompressed_blocks_data,
+					     LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE * data_handle->maximum_number_of_decompressed_blocks,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read compressed blocks: %" PRIu32 " - %" PRIu32 ".",
+						 function,
+						 compressed_block_index,
+						 compressed_block_index + number_of_blocks - 1 );
+
+						return( -1 );
+					}
+					data_handle->decompressed_blocks_index     = compressed_block_index;
+					data_handle->number_of_decompressed_blocks = number_of_blocks;
+
+					data_handle->current_block_data = data_handle->decompressed_blocks_data;
+					data_handle->segment_data_size  = data_handle->decompressed_blocks_data_sizes[ 0 ];
+				}
+				else
+				{
+					data_handle->segment_data_size = LIBFSAPFS_COMPRESSED_DATA_HANDLE_BLOCK_SIZE;
+
+					if( libfsapfs_compressed_data_handle_read_compressed_block(
+					     data_handle,
+					     (libbfio_handle_t *) file_io_handle,
+					     compressed_block_index,
+					     data_handle->segment_data,
+					     &( data_handle->segment_data_size ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read compressed block: %" PRIu32 ".",
+						 function,
+						 compressed_block_index );
+
+						return( -1 );
+					}
+					data_handle->current_block_data = data_handle->segment_data;
+				}
+				insert_into_cache = 1;
+			}
+			if( ( insert_into_cache != 0 )
+			 && ( data_handle->decompressed_data_cache != NULL )
+			 && ( data_handle->segment_data_size > 0 ) )
+			{
+				if( libfsapfs_decompressed_data_cache_insert_data(
+				     data_handle->decompressed_data_cache,
+				     data_handle->identifier,
+				     data_handle->transaction_identifier,
+				     compressed_block_index,
+				     data_handle->current_block_data,
+				     data_handle->segment_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to insert compressed block: %" PRIu32 " into decompressed data cache.",
+					 function,
+					 compressed_block_index );
 
-				return( -1 );
+					return( -1 );
+				}
 			}
 			data_handle->current_compressed_block_index = compressed_block_index;
 		}
@@ -1044,7 +1802,7 @@ ssize_t libfsapfs_compressed_data_handle_read_segment_data(
 		}
 		if( memory_copy(
 		     &( segment_data[ segment_data_offset ] ),
-		     &( data_handle->segment_data[ data_offset ] ),
+		     &( data_handle->current_block_data[ data_offset ] ),
 		     read_size ) == NULL )
 		{
 			libcerror_error_set(
@@ -1063,6 +1821,7 @@ ssize_t libfsapfs_compressed_data_handle_read_segment_data(
 		compressed_block_index++;
 	}
 	data_handle->current_segment_offset += segment_data_offset;
+	data_handle->next_read_offset        = data_handle->current_segment_offset;
 
 	return( (ssize_t) segment_data_offset );
 }
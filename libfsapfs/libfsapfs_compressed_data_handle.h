@@ -25,6 +25,8 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsapfs_decompressed_data_cache.h"
+#include "libfsapfs_decompression_pool.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libfdata.h"
@@ -69,6 +71,11 @@ struct libfsapfs_compressed_data_handle
 	 */
 	size_t segment_data_size;
 
+	/* The (uncompressed) data of the current compressed block, which is either
+	 * the segment data or part of the decompressed blocks data
+	 */
+	uint8_t *current_block_data;
+
 	/* The number of compressed blocks
 	 */
 	uint32_t number_of_compressed_blocks;
@@ -76,6 +83,62 @@ struct libfsapfs_compressed_data_handle
 	/* The compressed block offsets
 	 */
 	uint32_t *compressed_block_offsets;
+
+	/* The decompressed data cache, which is shared with the other compressed data handles of the volume
+	 */
+	libfsapfs_decompressed_data_cache_t *decompressed_data_cache;
+
+	/* The file system identifier, used to identify the data in the decompressed data cache
+	 */
+	uint64_t identifier;
+
+	/* The transaction identifier, used to identify the data in the decompressed data cache
+	 */
+	uint64_t transaction_identifier;
+
+	/* The decompression pool, which is shared with the other compressed data handles of the volume
+	 */
+	libfsapfs_decompression_pool_t *decompression_pool;
+
+	/* The maximum number of compressed blocks that are decompressed at once
+	 */
+	uint32_t maximum_number_of_decompressed_blocks;
+
+	/* The maximum number of compressed blocks that are decompressed ahead of sequential reads
+	 */
+	uint32_t maximum_number_of_read_ahead_blocks;
+
+	/* The offset directly after the previous read, used to detect sequential reads
+	 */
+	off64_t next_read_offset;
+
+	/* The number of consecutive sequential reads
+	 */
+	int number_of_sequential_reads;
+
+	/* The compressed data of the decompressed blocks
+	 */
+	uint8_t *decompressed_blocks_compressed_data;
+
+	/* The allocated size of the compressed data of the decompressed blocks
+	 */
+	size_t decompressed_blocks_compressed_data_size;
+
+	/* The (uncompressed) data of the decompressed blocks
+	 */
+	uint8_t *decompressed_blocks_data;
+
+	/* The (uncompressed) data sizes of the decompressed blocks
+	 */
+	size_t *decompressed_blocks_data_sizes;
+
+	/* The compressed block index of the first decompressed block
+	 */
+	uint32_t decompressed_blocks_index;
+
+	/* The number of decompressed blocks
+	 */
+	uint32_t number_of_decompressed_blocks;
 };
 
 int libfsapfs_compressed_data_handle_initialize(
@@ -89,11 +152,41 @@ int libfsapfs_compressed_data_handle_free(
      libfsapfs_compressed_data_handle_t **data_handle,
      libcerror_error_t **error );
 
+int libfsapfs_compressed_data_handle_set_decompressed_data_cache(
+     libfsapfs_compressed_data_handle_t *data_handle,
+     libfsapfs_decompressed_data_cache_t *decompressed_data_cache,
+     uint64_t identifier,
+     uint64_t transaction_identifier,
+     libcerror_error_t **error );
+
+int libfsapfs_compressed_data_handle_set_decompression_pool(
+     libfsapfs_compressed_data_handle_t *data_handle,
+     libfsapfs_decompression_pool_t *decompression_pool,
+     size64_t maximum_read_ahead_size,
+     libcerror_error_t **error );
+
 int libfsapfs_compressed_data_handle_get_compressed_block_offsets(
      libfsapfs_compressed_data_handle_t *data_handle,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libfsapfs_compressed_data_handle_read_compressed_block(
+     libfsapfs_compressed_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t compressed_block_index,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_compressed_data_handle_read_compressed_blocks(
+     libfsapfs_compressed_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     uint32_t compressed_block_index,
+     uint32_t number_of_blocks,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     libcerror_error_t **error );
+
 ssize_t libfsapfs_compressed_data_handle_read_segment_data(
          libfsapfs_compressed_data_handle_t *data_handle,
          intptr_t *file_io_handle,
@@ -38,6 +38,105 @@
 #include "libfsapfs_libcnotify.h"
 #include "libfsapfs_libfmos.h"
 
+/* Decompresses data that is stored without compression
+ * The compressed data consists of a single marker byte followed by the uncompressed data
+ * Returns 1 on success or -1 on error
+ */
+int libfsapfs_decompress_raw_data(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_decompress_raw_data";
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size < 1 )
+	 || ( compressed_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid compressed data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( *uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( compressed_data_size - 1 ) > *uncompressed_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: compressed data size value exceeds uncompressed data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     uncompressed_data,
+	     &( compressed_data[ 1 ] ),
+	     compressed_data_size - 1 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy compressed to uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	*uncompressed_data_size = compressed_data_size - 1;
+
+	return( 1 );
+}
+
 /* Decompresses data using the compression method
  * Returns 1 on success, 0 on failure or -1 on error
  */
@@ -105,51 +204,18 @@ int libfsapfs_decompress_data(
 		if( ( compressed_data_size >= 1 )
 		 && ( compressed_data[ 0 ] == 0xff ) )
 		{
-			if( compressed_data_size > (size_t) SSIZE_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-				 "%s: invalid compressed data size value exceeds maximum.",
-				 function );
-
-				return( -1 );
-			}
-			if( *uncompressed_data_size > (size_t) SSIZE_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-				 "%s: invalid uncompressed data size value exceeds maximum.",
-				 function );
-
-				return( -1 );
-			}
-			if( ( compressed_data_size - 1 ) > *uncompressed_data_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compressed data size value exceeds uncompressed data size.",
-				 function );
-
-				return( -1 );
-			}
-			*uncompressed_data_size = compressed_data_size - 1;
-
-			if( memory_copy(
+			if( libfsapfs_decompress_raw_data(
+			     compressed_data,
+			     compressed_data_size,
 			     uncompressed_data,
-			     &( compressed_data[ 1 ] ),
-			     *uncompressed_data_size ) == NULL )
+			     uncompressed_data_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to compressed to uncompressed data.",
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress raw data.",
 				 function );
 
 				return( -1 );
@@ -274,80 +340,68 @@ int libfsapfs_decompress_data(
 #endif /* ( defined( HAVE_ZLIB ) && defined( HAVE_ZLIB_UNCOMPRESS ) ) || defined( ZLIB_DLL ) */
 		}
 	}
-#ifdef TODO
-/* TODO need sample data */
 	else if( compression_method == LIBFSAPFS_COMPRESSION_METHOD_LZFSE )
-	{
-		result = libfmos_lzfse_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
-			 LIBCERROR_ENCRYPTION_ERROR_GENERIC,
-			 "%s: unable to decompress LZFSE compressed data.",
-			 function );
-
-			return( -1 );
-		}
-	}
-#endif /* TODO */
-	else if( compression_method == LIBFSAPFS_COMPRESSION_METHOD_LZVN )
 	{
 		if( ( compressed_data_size >= 1 )
-		 && ( compressed_data[ 0 ] == 0x06 ) )
+		 && ( compressed_data[ 0 ] == 0xff ) )
 		{
-			if( compressed_data_size > (size_t) SSIZE_MAX )
+			if( libfsapfs_decompress_raw_data(
+			     compressed_data,
+			     compressed_data_size,
+			     uncompressed_data,
+			     uncompressed_data_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-				 "%s: invalid compressed data size value exceeds maximum.",
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress raw data.",
 				 function );
 
 				return( -1 );
 			}
-			if( *uncompressed_data_size > (size_t) SSIZE_MAX )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-				 "%s: invalid uncompressed data size value exceeds maximum.",
-				 function );
+			result = 1;
+		}
+		else
+		{
+			result = libfmos_lzfse_decompress(
+			          compressed_data,
+			          compressed_data_size,
+			          uncompressed_data,
+			          uncompressed_data_size,
+			          error );
 
-				return( -1 );
-			}
-			if( ( compressed_data_size - 1 ) > *uncompressed_data_size )
+			if( result != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: compressed data size value exceeds uncompressed data size.",
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress LZFSE compressed data.",
 				 function );
 
 				return( -1 );
 			}
-			*uncompressed_data_size = compressed_data_size - 1;
-
-			if( memory_copy(
+		}
+	}
+	else if( compression_method == LIBFSAPFS_COMPRESSION_METHOD_LZVN )
+	{
+		if( ( compressed_data_size >= 1 )
+		 && ( compressed_data[ 0 ] == 0x06 ) )
+		{
+			if( libfsapfs_decompress_raw_data(
+			     compressed_data,
+			     compressed_data_size,
 			     uncompressed_data,
-			     &( compressed_data[ 1 ] ),
-			     *uncompressed_data_size ) == NULL )
+			     uncompressed_data_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-				 "%s: unable to compressed to uncompressed data.",
+				 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+				 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+				 "%s: unable to decompress raw data.",
 				 function );
 
 				return( -1 );
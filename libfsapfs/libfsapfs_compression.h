@@ -31,6 +31,13 @@
 extern "C" {
 #endif
 
+int libfsapfs_decompress_raw_data(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *uncompressed_data,
+     size_t *uncompressed_data_size,
+     libcerror_error_t **error );
+
 int libfsapfs_decompress_data(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
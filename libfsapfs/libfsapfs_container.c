@@ -27,7 +27,6 @@
 
 #include "libfsapfs_checkpoint_map.h"
 #include "libfsapfs_container.h"
-#include "libfsapfs_container_data_handle.h"
 #include "libfsapfs_container_key_bag.h"
 #include "libfsapfs_container_reaper.h"
 #include "libfsapfs_space_manager.h"
@@ -40,7 +39,7 @@
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
 #include "libfsapfs_libcthreads.h"
-#include "libfsapfs_libfdata.h"
+#include "libfsapfs_mapped_file.h"
 #include "libfsapfs_object.h"
 #include "libfsapfs_object_map.h"
 #include "libfsapfs_object_map_btree.h"
@@ -277,6 +276,7 @@ int libfsapfs_container_open(
 {
 	libbfio_handle_t *file_io_handle                   = NULL;
 	libfsapfs_internal_container_t *internal_container = NULL;
+	libfsapfs_mapped_file_t *mapped_file               = NULL;
 	static char *function                              = "libfsapfs_container_open";
 	size_t filename_length                             = 0;
 
@@ -327,57 +327,148 @@ int libfsapfs_container_open(
 
 		return( -1 );
 	}
-	if( libbfio_file_initialize(
-	     &file_io_handle,
-	     error ) != 1 )
+	if( internal_container->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - file IO handle already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libbfio_handle_set_track_offsets_read(
-	     file_io_handle,
-	     1,
-	     error ) != 1 )
+	if( internal_container->mapped_file != NULL )
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set track offsets read in file IO handle.",
-                 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid container - mapped file already set.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#endif
-	filename_length = narrow_string_length(
-	                   filename );
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		if( libfsapfs_mapped_file_initialize(
+		     &mapped_file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mapped file.",
+			 function );
 
-	if( libbfio_file_set_name(
-	     file_io_handle,
-	     filename,
-	     filename_length + 1,
-	     error ) != 1 )
+			goto on_error;
+		}
+		if( libfsapfs_mapped_file_open(
+		     mapped_file,
+		     filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open mapped file: %s.",
+			 function,
+			 filename );
+
+			goto on_error;
+		}
+		/* The mapped data is read through a memory range so that the data is not copied
+		 * by the file IO handle and B-tree nodes can reference the mapped data directly
+		 */
+		if( libbfio_memory_range_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( libbfio_memory_range_set(
+		     file_io_handle,
+		     mapped_file->data,
+		     (size_t) mapped_file->data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set memory range in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		/* The mapped file is set after the container was checked not to be open
+		 * since the B-tree nodes are read from the mapped data while opening
+		 */
+		internal_container->io_handle->mapped_file = mapped_file;
+	}
+	else
 	{
-                libcerror_error_set(
-                 error,
-                 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-                 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-                 "%s: unable to set filename in file IO handle.",
-                 function );
+		if( libbfio_file_initialize(
+		     &file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create file IO handle.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libbfio_handle_set_track_offsets_read(
+		     file_io_handle,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set track offsets read in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		filename_length = narrow_string_length(
+		                   filename );
+
+		if( libbfio_file_set_name(
+		     file_io_handle,
+		     filename,
+		     filename_length + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filename in file IO handle.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( libfsapfs_container_open_file_io_handle(
 	     container,
 	     file_io_handle,
-	     access_flags,
+	     access_flags & ~( LIBFSAPFS_ACCESS_FLAG_MEMORY_MAPPED ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -406,6 +497,7 @@ int libfsapfs_container_open(
 	}
 #endif
 	internal_container->file_io_handle_created_in_library = 1;
+	internal_container->mapped_file                       = mapped_file;
 
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -420,6 +512,7 @@ int libfsapfs_container_open(
 		 function );
 
 		internal_container->file_io_handle_created_in_library = 0;
+		internal_container->mapped_file                       = NULL;
 
 		goto on_error;
 	}
@@ -433,6 +526,17 @@ on_error:
 		 &file_io_handle,
 		 NULL );
 	}
+	if( mapped_file != NULL )
+	{
+		if( internal_container->io_handle->mapped_file == mapped_file )
+		{
+			internal_container->io_handle->mapped_file = NULL;
+		}
+
+		libfsapfs_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
         return( -1 );
 }
 
@@ -499,6 +603,17 @@ int libfsapfs_container_open_wide(
 
 		return( -1 );
 	}
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapped access currently not supported.",
+		 function );
+
+		return( -1 );
+	}
 	if( libbfio_file_initialize(
 	     &file_io_handle,
 	     error ) != 1 )
@@ -683,6 +798,17 @@ int libfsapfs_container_open_file_io_handle(
 
 		return( -1 );
 	}
+	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_MEMORY_MAPPED ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: memory mapped access only supported when opening a file by name.",
+		 function );
+
+		return( -1 );
+	}
 	if( ( access_flags & LIBFSAPFS_ACCESS_FLAG_READ ) != 0 )
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
@@ -890,6 +1016,23 @@ int libfsapfs_container_close(
 	}
 	internal_container->file_io_handle = NULL;
 
+	if( internal_container->mapped_file != NULL )
+	{
+		if( libfsapfs_mapped_file_free(
+		     &( internal_container->mapped_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mapped file.",
+			 function );
+
+			result = -1;
+		}
+	}
+
 	if( libfsapfs_io_handle_clear(
 	     internal_container->io_handle,
 	     error ) != 1 )
@@ -951,19 +1094,6 @@ int libfsapfs_container_close(
 			result = -1;
 		}
 	}
-	if( libfdata_vector_free(
-	     &( internal_container->data_block_vector ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free data block vector.",
-		 function );
-
-		result = -1;
-	}
 	if( internal_container->object_map_btree != NULL )
 	{
 		if( libfsapfs_object_map_btree_free(
@@ -1023,7 +1153,6 @@ int libfsapfs_internal_container_open_read(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	libfsapfs_container_data_handle_t *container_data_handle    = NULL;
 	libfsapfs_container_superblock_t *container_superblock      = NULL;
 	libfsapfs_container_superblock_t *container_superblock_swap = NULL;
 	libfsapfs_object_t *object                                  = NULL;
@@ -1032,7 +1161,6 @@ int libfsapfs_internal_container_open_read(
 	uint64_t checkpoint_map_block_number                        = 0;
 	uint64_t checkpoint_map_transaction_identifier              = 0;
 	uint64_t metadata_block_index                               = 0;
-	int element_index                                           = 0;
 	int result                                                  = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1098,17 +1226,6 @@ int libfsapfs_internal_container_open_read(
 
 		return( -1 );
 	}
-	if( internal_container->data_block_vector != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid container - data block vector already set.",
-		 function );
-
-		return( -1 );
-	}
 	if( internal_container->object_map_btree != NULL )
 	{
 		libcerror_error_set(
@@ -1593,61 +1710,6 @@ int libfsapfs_internal_container_open_read(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( libfsapfs_container_data_handle_initialize(
-	     &container_data_handle,
-	     internal_container->io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create container data handle.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_initialize(
-	     &( internal_container->data_block_vector ),
-	     (size64_t) internal_container->io_handle->block_size,
-	     (intptr_t *) container_data_handle,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_container_data_handle_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsapfs_container_data_handle_read_data_block,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data block vector.",
-		 function );
-
-		goto on_error;
-	}
-	internal_container->container_data_handle = container_data_handle;
-	container_data_handle                     = NULL;
-
-	if( libfdata_vector_append_segment(
-	     internal_container->data_block_vector,
-	     &element_index,
-	     0,
-	     0,
-	     internal_container->io_handle->container_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to data block vector.",
-		 function );
-
-		goto on_error;
-	}
 /* TODO refactor into function to read object map */
 	if( internal_container->superblock->object_map_block_number == 0 )
 	{
@@ -1720,7 +1782,6 @@ int libfsapfs_internal_container_open_read(
 	if( libfsapfs_object_map_btree_initialize(
 	     &( internal_container->object_map_btree ),
 	     internal_container->io_handle,
-	     internal_container->data_block_vector,
 	     object_map->btree_block_number,
 	     error ) != 1 )
 	{
@@ -1812,18 +1873,6 @@ on_error:
 		 &object_map,
 		 NULL );
 	}
-	if( internal_container->data_block_vector != NULL )
-	{
-		libfdata_vector_free(
-		 &( internal_container->data_block_vector ),
-		 NULL );
-	}
-	if( container_data_handle != NULL )
-	{
-		libfsapfs_container_data_handle_free(
-		 &container_data_handle,
-		 NULL );
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( container_reaper != NULL )
 	{
@@ -2107,6 +2156,185 @@ int libfsapfs_container_is_locked(
 	return( is_locked );
 }
 
+/* Sets the maximum cache size
+ * The maximum cache size is in bytes, a value of 0 represents the default
+ * Every cache type that has no maximum cache size set gets a fixed share of the maximum cache size:
+ * 2/16 for object map nodes, 1/16 for snapshot metadata nodes, 10/16 for file system nodes,
+ * 1/16 for data blocks and 2/16 for decompressed data
+ * The maximum cache size of a cache type is shared by all the caches of that type of the container
+ * Volumes retrieved after the call start with these cache sizes, but their caches do not share them
+ * The cache sizes only apply to caches that are created after the call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_set_maximum_cache_size(
+     libfsapfs_container_t *container,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_set_maximum_cache_size";
+	int result                                         = 1;
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( internal_container->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_set_maximum_cache_size(
+	     internal_container->io_handle,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum cache size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum cache size of a specific cache type
+ * The maximum cache size is in bytes, a value of 0 represents not set
+ * The maximum cache size is shared by all the caches of the cache type of the container
+ * Volumes retrieved after the call start with these cache sizes, but their caches do not share them
+ * The cache sizes only apply to caches that are created after the call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_container_set_maximum_cache_size_by_type(
+     libfsapfs_container_t *container,
+     int cache_type,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_container_t *internal_container = NULL;
+	static char *function                              = "libfsapfs_container_set_maximum_cache_size_by_type";
+	int result                                         = 1;
+
+	if( container == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid container.",
+		 function );
+
+		return( -1 );
+	}
+	internal_container = (libfsapfs_internal_container_t *) container;
+
+	if( internal_container->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid container - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_set_maximum_cache_size_by_type(
+	     internal_container->io_handle,
+	     cache_type,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum cache size by type.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_container->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the number of volumes
  * Returns 1 if successful or -1 on error
  */
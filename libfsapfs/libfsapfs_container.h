@@ -26,7 +26,6 @@
 #include <types.h>
 
 #include "libfsapfs_checkpoint_map.h"
-#include "libfsapfs_container_data_handle.h"
 #include "libfsapfs_container_key_bag.h"
 #include "libfsapfs_container_superblock.h"
 #include "libfsapfs_extern.h"
@@ -35,7 +34,7 @@
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcthreads.h"
-#include "libfsapfs_libfdata.h"
+#include "libfsapfs_mapped_file.h"
 #include "libfsapfs_object_map_btree.h"
 #include "libfsapfs_types.h"
 
@@ -59,14 +58,6 @@ struct libfsapfs_internal_container
 	 */
 	libfsapfs_checkpoint_map_t *checkpoint_map;
 
-	/* The container data handle
-	 */
-	libfsapfs_container_data_handle_t *container_data_handle;
-
-	/* The data block vector
-	 */
-	libfdata_vector_t *data_block_vector;
-
 	/* The object map B-tree
 	 */
 	libfsapfs_object_map_btree_t *object_map_btree;
@@ -91,6 +82,10 @@ struct libfsapfs_internal_container
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The mapped file, set if the container was opened memory mapped
+	 */
+	libfsapfs_mapped_file_t *mapped_file;
+
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -167,6 +162,19 @@ int libfsapfs_container_is_locked(
      libfsapfs_container_t *container,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_set_maximum_cache_size(
+     libfsapfs_container_t *container,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_container_set_maximum_cache_size_by_type(
+     libfsapfs_container_t *container,
+     int cache_type,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_container_get_number_of_volumes(
      libfsapfs_container_t *container,
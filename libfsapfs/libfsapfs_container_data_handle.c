@@ -211,8 +211,9 @@ int libfsapfs_container_data_handle_read_data_block(
 
 		return( -1 );
 	}
-	if( libfsapfs_data_block_initialize(
+	if( libfsapfs_data_block_initialize_with_buffer_pool(
 	     &data_block,
+	     container_data_handle->io_handle->buffer_pool,
 	     (size_t) element_data_size,
 	     error ) != 1 )
 	{
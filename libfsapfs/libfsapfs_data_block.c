@@ -24,6 +24,7 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsapfs_buffer_pool.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_io_handle.h"
@@ -43,6 +44,37 @@ int libfsapfs_data_block_initialize(
 {
 	static char *function = "libfsapfs_data_block_initialize";
 
+	if( libfsapfs_data_block_initialize_with_buffer_pool(
+	     data_block,
+	     NULL,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data block.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates data block where the data is retrieved from a buffer pool
+ * The data is returned to the buffer pool when the data block is freed
+ * Make sure the value data_block is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_data_block_initialize_with_buffer_pool(
+     libfsapfs_data_block_t **data_block,
+     libfsapfs_buffer_pool_t *buffer_pool,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_data_block_initialize_with_buffer_pool";
+
 	if( data_block == NULL )
 	{
 		libcerror_error_set(
@@ -109,7 +141,28 @@ int libfsapfs_data_block_initialize(
 
 		return( -1 );
 	}
-	if( data_size > 0 )
+	if( ( data_size > 0 )
+	 && ( buffer_pool != NULL ) )
+	{
+		if( libfsapfs_buffer_pool_get_buffer(
+		     buffer_pool,
+		     data_size,
+		     &( ( *data_block )->data ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data from buffer pool.",
+			 function );
+
+			goto on_error;
+		}
+		( *data_block )->data_size   = data_size;
+		( *data_block )->buffer_pool = buffer_pool;
+	}
+	else if( data_size > 0 )
 	{
 		( *data_block )->data = (uint8_t *) memory_allocate(
 		                                      sizeof( uint8_t ) * data_size );
@@ -163,7 +216,25 @@ int libfsapfs_data_block_free(
 	}
 	if( *data_block != NULL )
 	{
-		if( ( *data_block )->data != NULL )
+		if( ( *data_block )->buffer_pool != NULL )
+		{
+			if( libfsapfs_buffer_pool_release_buffer(
+			     ( *data_block )->buffer_pool,
+			     &( ( *data_block )->data ),
+			     ( *data_block )->data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release data to buffer pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else if( ( *data_block )->data != NULL )
 		{
 			if( memory_set(
 			     ( *data_block )->data,
@@ -261,7 +332,6 @@ int libfsapfs_data_block_read(
      uint64_t encryption_identifier,
      libcerror_error_t **error )
 {
-	uint8_t *read_buffer  = NULL;
 	static char *function = "libfsapfs_data_block_read";
 	ssize_t read_count    = 0;
 
@@ -320,27 +390,6 @@ int libfsapfs_data_block_read(
 
 		return( -1 );
 	}
-	if( encryption_context == NULL )
-	{
-		read_buffer = data_block->data;
-	}
-	else
-	{
-		read_buffer = (uint8_t *) memory_allocate(
-		                           sizeof( uint8_t ) * data_block->data_size );
-
-		if( read_buffer == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create read buffer.",
-			 function );
-
-			goto on_error;
-		}
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -353,7 +402,7 @@ int libfsapfs_data_block_read(
 #endif
 	read_count = libbfio_handle_read_buffer_at_offset(
 	              file_io_handle,
-	              read_buffer,
+	              data_block->data,
 	              data_block->data_size,
 	              file_offset,
 	              error );
@@ -369,7 +418,7 @@ int libfsapfs_data_block_read(
 		 file_offset,
 		 file_offset );
 
-		goto on_error;
+		return( -1 );
 	}
 	if( encryption_context != NULL )
 	{
@@ -380,7 +429,7 @@ int libfsapfs_data_block_read(
 			 "%s: encrypted data block:\n",
 			 function );
 			libcnotify_print_data(
-			 read_buffer,
+			 data_block->data,
 			 data_block->data_size,
 			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 		}
@@ -388,10 +437,12 @@ int libfsapfs_data_block_read(
 		encryption_identifier *= data_block->data_size;
 		encryption_identifier /= io_handle->bytes_per_sector;
 
+		/* The data is decrypted in-place
+		 */
 		if( libfsapfs_encryption_context_crypt(
 		     encryption_context,
 		     LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
-		     read_buffer,
+		     data_block->data,
 		     data_block->data_size,
 		     data_block->data,
 		     data_block->data_size,
@@ -406,12 +457,8 @@ int libfsapfs_data_block_read(
 			 "%s: unable to decrypt data block.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		memory_free(
-		 read_buffer );
-
-		read_buffer = NULL;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -426,14 +473,5 @@ int libfsapfs_data_block_read(
 	}
 #endif
 	return( 1 );
-
-on_error:
-	if( ( read_buffer != NULL )
-	 && ( read_buffer != data_block->data ) )
-	{
-		memory_free(
-		 read_buffer );
-	}
-	return( -1 );
 }
 
@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsapfs_buffer_pool.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
@@ -45,6 +46,10 @@ struct libfsapfs_data_block
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The buffer pool the data was retrieved from
+	 */
+	libfsapfs_buffer_pool_t *buffer_pool;
 };
 
 int libfsapfs_data_block_initialize(
@@ -52,6 +57,12 @@ int libfsapfs_data_block_initialize(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfsapfs_data_block_initialize_with_buffer_pool(
+     libfsapfs_data_block_t **data_block,
+     libfsapfs_buffer_pool_t *buffer_pool,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfsapfs_data_block_free(
      libfsapfs_data_block_t **data_block,
      libcerror_error_t **error );
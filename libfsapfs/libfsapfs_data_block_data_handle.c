@@ -23,12 +23,15 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsapfs_block_reader.h"
+#include "libfsapfs_cache_statistics.h"
 #include "libfsapfs_data_block.h"
 #include "libfsapfs_data_block_data_handle.h"
 #include "libfsapfs_data_block_vector.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_file_system_data_handle.h"
+#include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libcerror.h"
@@ -121,6 +124,7 @@ int libfsapfs_data_block_data_handle_initialize(
 	     io_handle,
 	     encryption_context,
 	     file_extents,
+	     is_sparse,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -132,6 +136,38 @@ int libfsapfs_data_block_data_handle_initialize(
 
 		goto on_error;
 	}
+	if( libfsapfs_block_reader_initialize(
+	     &( ( *data_handle )->block_reader ),
+	     io_handle,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block reader.",
+		 function );
+
+		goto on_error;
+	}
+	if( io_handle->maximum_number_of_concurrent_reads > 1 )
+	{
+		if( libfsapfs_block_reader_set_maximum_number_of_concurrent_reads(
+		     ( *data_handle )->block_reader,
+		     io_handle->maximum_number_of_concurrent_reads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set maximum number of concurrent reads of block reader.",
+			 function );
+
+			goto on_error;
+		}
+	}
 	if( libfsapfs_data_block_vector_initialize(
 	     &( ( *data_handle )->data_block_vector ),
 	     io_handle,
@@ -163,9 +199,24 @@ int libfsapfs_data_block_data_handle_initialize(
 
 		goto on_error;
 	}
+	if( libfsapfs_io_handle_reserve_cache_entries(
+	     io_handle,
+	     LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+	     &( ( *data_handle )->number_of_cache_entries ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to reserve data block cache entries.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfcache_cache_initialize(
 	     &( ( *data_handle )->data_block_cache ),
-	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS,
+	     ( *data_handle )->number_of_cache_entries,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -182,12 +233,26 @@ int libfsapfs_data_block_data_handle_initialize(
 on_error:
 	if( *data_handle != NULL )
 	{
+		if( ( *data_handle )->number_of_cache_entries > 0 )
+		{
+			libfsapfs_io_handle_release_cache_entries(
+			 io_handle,
+			 LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+			 ( *data_handle )->number_of_cache_entries,
+			 NULL );
+		}
 		if( ( *data_handle )->data_block_vector != NULL )
 		{
 			libfdata_vector_free(
 			 &( ( *data_handle )->data_block_vector ),
 			 NULL );
 		}
+		if( ( *data_handle )->block_reader != NULL )
+		{
+			libfsapfs_block_reader_free(
+			 &( ( *data_handle )->block_reader ),
+			 NULL );
+		}
 		if( ( *data_handle )->file_system_data_handle != NULL )
 		{
 			libfsapfs_file_system_data_handle_free(
@@ -225,6 +290,25 @@ int libfsapfs_data_block_data_handle_free(
 	}
 	if( *data_handle != NULL )
 	{
+		if( ( ( *data_handle )->file_system_data_handle != NULL )
+		 && ( ( *data_handle )->data_block_cache != NULL ) )
+		{
+			if( libfsapfs_cache_statistics_release_cache(
+			     ( *data_handle )->file_system_data_handle->io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS - 1 ],
+			     ( *data_handle )->data_block_cache,
+			     (size64_t) ( *data_handle )->file_system_data_handle->io_handle->block_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update cache statistics.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libfcache_cache_free(
 		     &( ( *data_handle )->data_block_cache ),
 		     error ) != 1 )
@@ -238,6 +322,25 @@ int libfsapfs_data_block_data_handle_free(
 
 			result = -1;
 		}
+		if( ( ( *data_handle )->file_system_data_handle != NULL )
+		 && ( ( *data_handle )->number_of_cache_entries > 0 ) )
+		{
+			if( libfsapfs_io_handle_release_cache_entries(
+			     ( *data_handle )->file_system_data_handle->io_handle,
+			     LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+			     ( *data_handle )->number_of_cache_entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release data block cache entries.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( libfdata_vector_free(
 		     &( ( *data_handle )->data_block_vector ),
 		     error ) != 1 )
@@ -264,6 +367,24 @@ int libfsapfs_data_block_data_handle_free(
 
 			result = -1;
 		}
+		if( libfsapfs_block_reader_free(
+		     &( ( *data_handle )->block_reader ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free block reader.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *data_handle )->read_ahead_data != NULL )
+		{
+			memory_free(
+			 ( *data_handle )->read_ahead_data );
+		}
 		memory_free(
 		 *data_handle );
 
@@ -272,6 +393,316 @@ int libfsapfs_data_block_data_handle_free(
 	return( result );
 }
 
+/* Reads data ahead of the current offset into the read-ahead data
+ * The read-ahead window is doubled on every consecutive read-ahead up to the maximum read-ahead size
+ * Returns 1 if successful, 0 if no data was read ahead or -1 on error
+ */
+int libfsapfs_data_block_data_handle_read_ahead(
+     libfsapfs_data_block_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libfsapfs_io_handle_t *io_handle = NULL;
+	uint8_t *read_ahead_data         = NULL;
+	static char *function            = "libfsapfs_data_block_data_handle_read_ahead";
+	size_t window_size               = 0;
+	ssize_t read_count               = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->file_system_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing file system data handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle = data_handle->file_system_data_handle->io_handle;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* Memory mapped data is not copied into the read-ahead data
+	 */
+	if( ( io_handle->mapped_file != NULL )
+	 && ( data_handle->file_system_data_handle->encryption_context == NULL ) )
+	{
+		return( 0 );
+	}
+	if( ( io_handle->maximum_read_ahead_size < (size64_t) io_handle->block_size )
+	 || ( data_handle->number_of_sequential_reads < LIBFSAPFS_READ_AHEAD_MINIMUM_NUMBER_OF_SEQUENTIAL_READS )
+	 || ( (size64_t) data_handle->current_offset >= data_handle->data_size ) )
+	{
+		return( 0 );
+	}
+	if( data_handle->read_ahead_window_size == 0 )
+	{
+		window_size = (size_t) io_handle->block_size * 2;
+	}
+	else
+	{
+		window_size = data_handle->read_ahead_window_size * 2;
+	}
+	if( (size64_t) window_size > io_handle->maximum_read_ahead_size )
+	{
+		window_size = (size_t) io_handle->maximum_read_ahead_size;
+	}
+	if( (size64_t) window_size > ( data_handle->data_size - data_handle->current_offset ) )
+	{
+		window_size = (size_t) ( data_handle->data_size - data_handle->current_offset );
+	}
+	if( window_size > data_handle->read_ahead_data_size )
+	{
+		read_ahead_data = (uint8_t *) memory_reallocate(
+		                               data_handle->read_ahead_data,
+		                               sizeof( uint8_t ) * window_size );
+
+		if( read_ahead_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize read-ahead data.",
+			 function );
+
+			return( -1 );
+		}
+		data_handle->read_ahead_data      = read_ahead_data;
+		data_handle->read_ahead_data_size = window_size;
+	}
+	data_handle->read_ahead_size = 0;
+
+	/* The read-ahead is read through the block reader together with the pending direct reads
+	 */
+	read_count = libfsapfs_file_system_data_handle_read_extent_data(
+	              data_handle->file_system_data_handle,
+	              file_io_handle,
+	              data_handle->block_reader,
+	              &( data_handle->current_extent_index ),
+	              data_handle->current_offset,
+	              data_handle->read_ahead_data,
+	              window_size,
+	              1,
+	              error );
+
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read ahead at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_handle->current_offset,
+		 data_handle->current_offset );
+
+		return( -1 );
+	}
+	else if( read_count == 0 )
+	{
+		return( 0 );
+	}
+	if( libfsapfs_block_reader_read(
+	     data_handle->block_reader,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read ahead at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 data_handle->current_offset,
+		 data_handle->current_offset );
+
+		return( -1 );
+	}
+	data_handle->read_ahead_offset      = data_handle->current_offset;
+	data_handle->read_ahead_size        = (size_t) read_count;
+	data_handle->read_ahead_window_size = window_size;
+
+	if( libfsapfs_io_handle_add_read_ahead_statistics(
+	     io_handle,
+	     1,
+	     (size64_t) read_count,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update read-ahead statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Advises the kernel to read ahead the memory mapped data following the current offset
+ * The read-ahead window is doubled on every consecutive read-ahead up to the maximum read-ahead size
+ * Returns 1 if successful, 0 if no read-ahead was advised or -1 on error
+ */
+int libfsapfs_data_block_data_handle_advise_read_ahead(
+     libfsapfs_data_block_data_handle_t *data_handle,
+     libcerror_error_t **error )
+{
+	libfsapfs_io_handle_t *io_handle = NULL;
+	static char *function            = "libfsapfs_data_block_data_handle_advise_read_ahead";
+	size_t window_size               = 0;
+	off64_t advise_offset            = 0;
+	int extent_index                 = 0;
+	int result                       = 0;
+
+	if( data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_handle->file_system_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing file system data handle.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle = data_handle->file_system_data_handle->io_handle;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( io_handle->mapped_file == NULL )
+	 || ( io_handle->maximum_read_ahead_size < (size64_t) io_handle->block_size )
+	 || ( data_handle->number_of_sequential_reads < LIBFSAPFS_READ_AHEAD_MINIMUM_NUMBER_OF_SEQUENTIAL_READS )
+	 || ( (size64_t) data_handle->current_offset >= data_handle->data_size ) )
+	{
+		return( 0 );
+	}
+	advise_offset = data_handle->current_offset;
+
+	if( data_handle->read_ahead_window_size == 0 )
+	{
+		window_size = (size_t) io_handle->block_size * 2;
+	}
+	else
+	{
+		/* The next window is advised once the current offset passes half of the previous window
+		 */
+		if( ( data_handle->current_offset + (off64_t) ( data_handle->read_ahead_window_size / 2 ) ) < data_handle->read_ahead_advised_offset )
+		{
+			return( 0 );
+		}
+		if( data_handle->read_ahead_advised_offset > advise_offset )
+		{
+			advise_offset = data_handle->read_ahead_advised_offset;
+		}
+		window_size = data_handle->read_ahead_window_size * 2;
+	}
+	if( (size64_t) window_size > io_handle->maximum_read_ahead_size )
+	{
+		window_size = (size_t) io_handle->maximum_read_ahead_size;
+	}
+	if( (size64_t) advise_offset >= data_handle->data_size )
+	{
+		return( 0 );
+	}
+	if( (size64_t) window_size > ( data_handle->data_size - advise_offset ) )
+	{
+		window_size = (size_t) ( data_handle->data_size - advise_offset );
+	}
+	extent_index = data_handle->current_extent_index;
+
+	/* Only the window is advised, the access pattern of the whole mapping is left unchanged
+	 * since the mapping is shared with the metadata and other data streams
+	 */
+	result = libfsapfs_file_system_data_handle_advise_extent_data(
+	          data_handle->file_system_data_handle,
+	          &extent_index,
+	          advise_offset,
+	          (size64_t) window_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to advise read-ahead at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 advise_offset,
+		 advise_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	data_handle->read_ahead_advised_offset = advise_offset + (off64_t) window_size;
+	data_handle->read_ahead_window_size    = window_size;
+
+	if( libfsapfs_io_handle_add_read_ahead_statistics(
+	     io_handle,
+	     1,
+	     0,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update read-ahead statistics.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Reads data from the current offset into a buffer
  * Callback for the data stream
  * Returns the number of bytes read or -1 on error
@@ -289,9 +720,13 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 {
 	libfsapfs_data_block_t *data_block = NULL;
 	static char *function              = "libfsapfs_data_block_data_handle_read_segment_data";
+	size_t minimum_direct_read_size    = 0;
+	size_t read_ahead_data_offset      = 0;
 	size_t read_size                   = 0;
 	size_t segment_data_offset         = 0;
+	ssize_t read_count                 = 0;
 	off64_t data_block_offset          = 0;
+	int result                         = 0;
 
 	LIBFSAPFS_UNREFERENCED_PARAMETER( segment_file_index )
 	LIBFSAPFS_UNREFERENCED_PARAMETER( segment_flags )
@@ -356,8 +791,183 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 	{
 		return( 0 );
 	}
+	if( data_handle->current_offset == data_handle->next_read_offset )
+	{
+		if( data_handle->number_of_sequential_reads < LIBFSAPFS_READ_AHEAD_MINIMUM_NUMBER_OF_SEQUENTIAL_READS )
+		{
+			data_handle->number_of_sequential_reads += 1;
+		}
+	}
+	else
+	{
+		data_handle->number_of_sequential_reads = 0;
+		data_handle->read_ahead_window_size     = 0;
+	}
+	minimum_direct_read_size = (size_t) data_handle->file_system_data_handle->io_handle->block_size * LIBFSAPFS_DIRECT_READ_MINIMUM_NUMBER_OF_BLOCKS;
+
+	if( ( data_handle->file_system_data_handle->io_handle->mapped_file != NULL )
+	 && ( data_handle->file_system_data_handle->encryption_context == NULL ) )
+	{
+		/* Memory mapped data is read directly from the mapping and read-ahead
+		 * is left to the kernel page cache
+		 */
+		minimum_direct_read_size = 1;
+
+		if( libfsapfs_data_block_data_handle_advise_read_ahead(
+		     data_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to advise read-ahead.",
+			 function );
+
+			goto on_error;
+		}
+	}
+
 	while( segment_data_size > 0 )
 	{
+		if( ( data_handle->read_ahead_size > 0 )
+		 && ( data_handle->current_offset >= data_handle->read_ahead_offset )
+		 && ( (size64_t) ( data_handle->current_offset - data_handle->read_ahead_offset ) < (size64_t) data_handle->read_ahead_size ) )
+		{
+			read_ahead_data_offset = (size_t) ( data_handle->current_offset - data_handle->read_ahead_offset );
+			read_size              = data_handle->read_ahead_size - read_ahead_data_offset;
+
+			if( read_size > segment_data_size )
+			{
+				read_size = segment_data_size;
+			}
+			if( memory_copy(
+			     &( segment_data[ segment_data_offset ] ),
+			     &( data_handle->read_ahead_data[ read_ahead_data_offset ] ),
+			     read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy read-ahead data.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfsapfs_io_handle_add_read_ahead_statistics(
+			     data_handle->file_system_data_handle->io_handle,
+			     0,
+			     0,
+			     (size64_t) read_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update read-ahead statistics.",
+				 function );
+
+				goto on_error;
+			}
+
+			segment_data_offset += read_size;
+			segment_data_size   -= read_size;
+
+			data_handle->current_offset += read_size;
+
+			if( (size64_t) data_handle->current_offset >= data_handle->data_size )
+			{
+				break;
+			}
+			continue;
+		}
+		/* Large reads are read directly from the file extent into the segment data
+		 */
+		read_size = segment_data_size;
+
+		if( (size64_t) read_size > ( data_handle->data_size - data_handle->current_offset ) )
+		{
+			read_size = (size_t) ( data_handle->data_size - data_handle->current_offset );
+		}
+		read_count = libfsapfs_file_system_data_handle_read_extent_data(
+		              data_handle->file_system_data_handle,
+		              file_io_handle,
+		              data_handle->block_reader,
+		              &( data_handle->current_extent_index ),
+		              data_handle->current_offset,
+		              &( segment_data[ segment_data_offset ] ),
+		              read_size,
+		              minimum_direct_read_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read extent data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_handle->current_offset,
+			 data_handle->current_offset );
+
+			goto on_error;
+		}
+		else if( read_count > 0 )
+		{
+			segment_data_offset += (size_t) read_count;
+			segment_data_size   -= (size_t) read_count;
+
+			data_handle->current_offset += read_count;
+
+			if( (size64_t) data_handle->current_offset >= data_handle->data_size )
+			{
+				break;
+			}
+			continue;
+		}
+		/* Sequential reads are read ahead into the read-ahead data
+		 */
+		result = libfsapfs_data_block_data_handle_read_ahead(
+		          data_handle,
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read ahead at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 data_handle->current_offset,
+			 data_handle->current_offset );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			continue;
+		}
+		if( libfsapfs_cache_statistics_add_lookups(
+		     data_handle->file_system_data_handle->io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS - 1 ],
+		     1,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update cache statistics.",
+			 function );
+
+			goto on_error;
+		}
+
 		if( libfdata_vector_get_element_value_at_offset(
 		     data_handle->data_block_vector,
 		     (intptr_t *) file_io_handle,
@@ -377,7 +987,7 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 			 data_handle->current_offset,
 			 data_handle->current_offset );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( data_block == NULL )
 		{
@@ -388,7 +998,7 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 			 "%s: invalid data block.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( data_block->data == NULL )
 		{
@@ -399,7 +1009,7 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 			 "%s: invalid data block - missing data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( ( data_block_offset < 0 )
 		 || ( (size64_t) data_block_offset >= data_block->data_size ) )
@@ -411,7 +1021,7 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 			 "%s: invalid data block offset value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		read_size = (size_t) ( data_block->data_size - data_block_offset );
 
@@ -431,7 +1041,7 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 			 "%s: unable to copy data block data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		segment_data_offset += read_size;
 		segment_data_size   -= read_size;
@@ -443,7 +1053,32 @@ ssize_t libfsapfs_data_block_data_handle_read_segment_data(
 			break;
 		}
 	}
+	/* Direct reads of adjacent file extents are merged by the block reader
+	 */
+	if( libfsapfs_block_reader_read(
+	     data_handle->block_reader,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read extent data.",
+		 function );
+
+		return( -1 );
+	}
+	data_handle->next_read_offset = data_handle->current_offset;
+
 	return( (ssize_t) segment_data_offset );
+
+on_error:
+	libfsapfs_block_reader_clear(
+	 data_handle->block_reader,
+	 NULL );
+
+	return( -1 );
 }
 
 /* Seeks a certain offset of the data
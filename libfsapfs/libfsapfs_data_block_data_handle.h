@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsapfs_block_reader.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_file_system_data_handle.h"
 #include "libfsapfs_io_handle.h"
@@ -61,6 +62,50 @@ struct libfsapfs_data_block_data_handle
 	/* The data block cache
 	 */
 	libfcache_cache_t *data_block_cache;
+
+	/* The number of data block cache entries reserved from the IO handle
+	 */
+	int number_of_cache_entries;
+
+	/* The block reader, used to merge direct reads of adjacent file extents
+	 */
+	libfsapfs_block_reader_t *block_reader;
+
+	/* The index of the file extent of the most recent direct read
+	 */
+	int current_extent_index;
+
+	/* The offset directly after the previous read, used to detect sequential reads
+	 */
+	off64_t next_read_offset;
+
+	/* The number of consecutive sequential reads
+	 */
+	int number_of_sequential_reads;
+
+	/* The read-ahead data
+	 */
+	uint8_t *read_ahead_data;
+
+	/* The allocated size of the read-ahead data
+	 */
+	size_t read_ahead_data_size;
+
+	/* The offset of the data in the read-ahead data
+	 */
+	off64_t read_ahead_offset;
+
+	/* The size of the data in the read-ahead data
+	 */
+	size_t read_ahead_size;
+
+	/* The current read-ahead window size
+	 */
+	size_t read_ahead_window_size;
+
+	/* The offset up to which read-ahead was advised, used if the data is memory mapped
+	 */
+	off64_t read_ahead_advised_offset;
 };
 
 int libfsapfs_data_block_data_handle_initialize(
@@ -75,6 +120,15 @@ int libfsapfs_data_block_data_handle_free(
      libfsapfs_data_block_data_handle_t **data_handle,
      libcerror_error_t **error );
 
+int libfsapfs_data_block_data_handle_read_ahead(
+     libfsapfs_data_block_data_handle_t *data_handle,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libfsapfs_data_block_data_handle_advise_read_ahead(
+     libfsapfs_data_block_data_handle_t *data_handle,
+     libcerror_error_t **error );
+
 ssize_t libfsapfs_data_block_data_handle_read_segment_data(
          libfsapfs_data_block_data_handle_t *data_handle,
          libbfio_handle_t *file_io_handle,
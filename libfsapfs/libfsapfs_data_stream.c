@@ -26,6 +26,8 @@
 #include "libfsapfs_compressed_data_handle.h"
 #include "libfsapfs_data_block_data_handle.h"
 #include "libfsapfs_data_stream.h"
+#include "libfsapfs_decompressed_data_cache.h"
+#include "libfsapfs_decompression_pool.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_file_extent.h"
 #include "libfsapfs_io_handle.h"
@@ -253,6 +255,9 @@ on_error:
 }
 
 /* Creates data stream from a compressed data stream
+ * The IO handle is optional and provides the decompressed data cache and decompression pool,
+ * which are shared between data streams, where the data in the decompressed data cache
+ * is identified by the file system and transaction identifier
  * Make sure the value data_stream is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
@@ -261,12 +266,18 @@ int libfsapfs_data_stream_initialize_from_compressed_data_stream(
      libfdata_stream_t *compressed_data_stream,
      size64_t uncompressed_data_size,
      int compression_method,
+     libfsapfs_io_handle_t *io_handle,
+     uint64_t identifier,
+     uint64_t transaction_identifier,
      libcerror_error_t **error )
 {
-	libfdata_stream_t *safe_data_stream             = NULL;
-	libfsapfs_compressed_data_handle_t *data_handle = NULL;
-	static char *function                           = "libfsapfs_data_stream_initialize_from_compressed_data_stream";
-	int segment_index                               = 0;
+	libfdata_stream_t *safe_data_stream                          = NULL;
+	libfsapfs_compressed_data_handle_t *data_handle              = NULL;
+	libfsapfs_decompressed_data_cache_t *decompressed_data_cache = NULL;
+	libfsapfs_decompression_pool_t *decompression_pool           = NULL;
+	static char *function                                        = "libfsapfs_data_stream_initialize_from_compressed_data_stream";
+	size64_t maximum_read_ahead_size                             = 0;
+	int segment_index                                            = 0;
 
 	if( data_stream == NULL )
 	{
@@ -279,6 +290,12 @@ int libfsapfs_data_stream_initialize_from_compressed_data_stream(
 
 		return( -1 );
 	}
+	if( io_handle != NULL )
+	{
+		decompressed_data_cache = io_handle->decompressed_data_cache;
+		decompression_pool      = io_handle->decompression_pool;
+		maximum_read_ahead_size = io_handle->maximum_read_ahead_size;
+	}
 	if( libfsapfs_compressed_data_handle_initialize(
 	     &data_handle,
 	     compressed_data_stream,
@@ -295,6 +312,37 @@ int libfsapfs_data_stream_initialize_from_compressed_data_stream(
 
 		goto on_error;
 	}
+	if( libfsapfs_compressed_data_handle_set_decompressed_data_cache(
+	     data_handle,
+	     decompressed_data_cache,
+	     identifier,
+	     transaction_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set decompressed data cache in compressed data handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_compressed_data_handle_set_decompression_pool(
+	     data_handle,
+	     decompression_pool,
+	     maximum_read_ahead_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set decompression pool in compressed data handle.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_stream_initialize(
 	     &safe_data_stream,
 	     (intptr_t *) data_handle,
@@ -55,6 +55,9 @@ int libfsapfs_data_stream_initialize_from_compressed_data_stream(
      libfdata_stream_t *compressed_data_stream,
      size64_t uncompressed_data_size,
      int compression_method,
+     libfsapfs_io_handle_t *io_handle,
+     uint64_t identifier,
+     uint64_t transaction_identifier,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
@@ -0,0 +1,867 @@
+/*
+ * Decompressed data cache functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_cache_statistics.h"
+#include "libfsapfs_decompressed_data_cache.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+/* The maximum number of hash buckets
+ */
+#define LIBFSAPFS_DECOMPRESSED_DATA_CACHE_MAXIMUM_NUMBER_OF_BUCKETS	65536
+
+/* Determines the hash bucket of a compressed block
+ */
+#define libfsapfs_decompressed_data_cache_get_bucket_index( decompressed_data_cache, identifier, transaction_identifier, compressed_block_index ) \
+	(uint32_t) ( ( ( ( (identifier) ^ ( (transaction_identifier) << 24 ) ) * 0x9e3779b97f4a7c15ULL ) + (compressed_block_index) ) \
+	& ( (uint64_t) (decompressed_data_cache)->number_of_buckets - 1 ) )
+
+/* Removes an entry from the list of recently used entries
+ */
+#define libfsapfs_decompressed_data_cache_unlink_entry( decompressed_data_cache, entry ) \
+	if( (entry)->previous_entry == NULL ) \
+	{ \
+		(decompressed_data_cache)->first_entry = (entry)->next_entry; \
+	} \
+	else \
+	{ \
+		(entry)->previous_entry->next_entry = (entry)->next_entry; \
+	} \
+	if( (entry)->next_entry == NULL ) \
+	{ \
+		(decompressed_data_cache)->last_entry = (entry)->previous_entry; \
+	} \
+	else \
+	{ \
+		(entry)->next_entry->previous_entry = (entry)->previous_entry; \
+	} \
+	(entry)->previous_entry = NULL; \
+	(entry)->next_entry     = NULL;
+
+/* Adds an entry as the most recently used entry
+ */
+#define libfsapfs_decompressed_data_cache_link_first_entry( decompressed_data_cache, entry ) \
+	(entry)->previous_entry = NULL; \
+	(entry)->next_entry     = (decompressed_data_cache)->first_entry; \
+	if( (decompressed_data_cache)->first_entry == NULL ) \
+	{ \
+		(decompressed_data_cache)->last_entry = (entry); \
+	} \
+	else \
+	{ \
+		(decompressed_data_cache)->first_entry->previous_entry = (entry); \
+	} \
+	(decompressed_data_cache)->first_entry = (entry);
+
+/* Creates a decompressed data cache
+ * The cache contains the decompressed data of compressed blocks of files, where the least
+ * recently used blocks are evicted when the size of the cached data exceeds the maximum cache size
+ * Make sure the value decompressed_data_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decompressed_data_cache_initialize(
+     libfsapfs_decompressed_data_cache_t **decompressed_data_cache,
+     size64_t maximum_cache_size,
+     libfsapfs_cache_statistics_t *cache_statistics,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsapfs_decompressed_data_cache_initialize";
+	size64_t number_of_entries = 0;
+	size_t buckets_size        = 0;
+	uint32_t number_of_buckets = 0;
+
+	if( decompressed_data_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompressed data cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decompressed_data_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decompressed data cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum cache size value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	/* Use about 1 hash bucket per entry that fits in the cache
+	 */
+	number_of_entries = maximum_cache_size / LIBFSAPFS_DECOMPRESSED_DATA_CACHE_ENTRY_SIZE;
+	number_of_buckets = 16;
+
+	while( ( number_of_buckets < (uint32_t) LIBFSAPFS_DECOMPRESSED_DATA_CACHE_MAXIMUM_NUMBER_OF_BUCKETS )
+	    && ( (size64_t) number_of_buckets < number_of_entries ) )
+	{
+		number_of_buckets *= 2;
+	}
+	buckets_size = sizeof( libfsapfs_decompressed_data_cache_entry_t * ) * number_of_buckets;
+
+	*decompressed_data_cache = memory_allocate_structure(
+	                            libfsapfs_decompressed_data_cache_t );
+
+	if( *decompressed_data_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decompressed data cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decompressed_data_cache,
+	     0,
+	     sizeof( libfsapfs_decompressed_data_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decompressed data cache.",
+		 function );
+
+		memory_free(
+		 *decompressed_data_cache );
+
+		*decompressed_data_cache = NULL;
+
+		return( -1 );
+	}
+	( *decompressed_data_cache )->buckets = (libfsapfs_decompressed_data_cache_entry_t **) memory_allocate(
+	                                                                                        buckets_size );
+
+	if( ( *decompressed_data_cache )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *decompressed_data_cache )->buckets,
+	     0,
+	     buckets_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *decompressed_data_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *decompressed_data_cache )->number_of_buckets  = number_of_buckets;
+	( *decompressed_data_cache )->maximum_cache_size = maximum_cache_size;
+	( *decompressed_data_cache )->cache_statistics   = cache_statistics;
+
+	return( 1 );
+
+on_error:
+	if( *decompressed_data_cache != NULL )
+	{
+		if( ( *decompressed_data_cache )->buckets != NULL )
+		{
+			memory_free(
+			 ( *decompressed_data_cache )->buckets );
+		}
+		memory_free(
+		 *decompressed_data_cache );
+
+		*decompressed_data_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a decompressed data cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decompressed_data_cache_free(
+     libfsapfs_decompressed_data_cache_t **decompressed_data_cache,
+     libcerror_error_t **error )
+{
+	libfsapfs_decompressed_data_cache_entry_t *entry      = NULL;
+	libfsapfs_decompressed_data_cache_entry_t *next_entry = NULL;
+	libfsapfs_cache_statistics_t *cache_statistics        = NULL;
+	static char *function                                 = "libfsapfs_decompressed_data_cache_free";
+	int result                                            = 1;
+
+	if( decompressed_data_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompressed data cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decompressed_data_cache != NULL )
+	{
+		entry = ( *decompressed_data_cache )->first_entry;
+
+		while( entry != NULL )
+		{
+			next_entry = entry->next_entry;
+
+			memory_free(
+			 entry->data );
+			memory_free(
+			 entry );
+
+			entry = next_entry;
+		}
+		cache_statistics = ( *decompressed_data_cache )->cache_statistics;
+
+		if( cache_statistics != NULL )
+		{
+			if( libfsapfs_cache_statistics_update(
+			     cache_statistics,
+			     0,
+			     0,
+			     ( *decompressed_data_cache )->cached_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update cache statistics.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( ( *decompressed_data_cache )->read_write_lock != NULL )
+		{
+			if( libcthreads_read_write_lock_free(
+			     &( ( *decompressed_data_cache )->read_write_lock ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free read/write lock.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 ( *decompressed_data_cache )->buckets );
+		memory_free(
+		 *decompressed_data_cache );
+
+		*decompressed_data_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the decompressed data of a specific compressed block from the cache
+ * The cached data is copied into data and the block becomes the most recently used block
+ * The entry is referenced while its data is copied so that the copy is made outside the lock
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsapfs_decompressed_data_cache_get_data(
+     libfsapfs_decompressed_data_cache_t *decompressed_data_cache,
+     uint64_t identifier,
+     uint64_t transaction_identifier,
+     uint32_t compressed_block_index,
+     uint8_t *data,
+     size_t data_size,
+     size_t *cached_data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_decompressed_data_cache_entry_t *entry          = NULL;
+	libfsapfs_decompressed_data_cache_entry_t *released_entry = NULL;
+	static char *function                                     = "libfsapfs_decompressed_data_cache_get_data";
+	uint32_t bucket_index                                     = 0;
+	int result                                                = 0;
+
+	if( decompressed_data_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompressed data cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( cached_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cached data size.",
+		 function );
+
+		return( -1 );
+	}
+	bucket_index = libfsapfs_decompressed_data_cache_get_bucket_index(
+	                decompressed_data_cache,
+	                identifier,
+	                transaction_identifier,
+	                compressed_block_index );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     decompressed_data_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	entry = decompressed_data_cache->buckets[ bucket_index ];
+
+	while( entry != NULL )
+	{
+		if( ( entry->identifier == identifier )
+		 && ( entry->transaction_identifier == transaction_identifier )
+		 && ( entry->compressed_block_index == compressed_block_index ) )
+		{
+			break;
+		}
+		entry = entry->next_bucket_entry;
+	}
+	if( entry != NULL )
+	{
+		if( entry->data_size > data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			if( entry != decompressed_data_cache->first_entry )
+			{
+				libfsapfs_decompressed_data_cache_unlink_entry(
+				 decompressed_data_cache,
+				 entry );
+
+				libfsapfs_decompressed_data_cache_link_first_entry(
+				 decompressed_data_cache,
+				 entry );
+			}
+			entry->number_of_references += 1;
+
+			result = 1;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     decompressed_data_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		if( memory_copy(
+		     data,
+		     entry->data,
+		     entry->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*cached_data_size = entry->data_size;
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     decompressed_data_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		entry->number_of_references -= 1;
+
+		/* An entry that was evicted while it was referenced is freed by its last reader
+		 */
+		if( ( entry->number_of_references == 0 )
+		 && ( entry->is_evicted != 0 ) )
+		{
+			released_entry = entry;
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     decompressed_data_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( released_entry != NULL )
+		{
+			memory_free(
+			 released_entry->data );
+			memory_free(
+			 released_entry );
+		}
+	}
+	if( result != -1 )
+	{
+		if( libfsapfs_cache_statistics_add_lookups(
+		     decompressed_data_cache->cache_statistics,
+		     1,
+		     ( result == 0 ) ? 1 : 0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update cache statistics.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Inserts the decompressed data of a specific compressed block into the cache
+ * The data is copied and the least recently used blocks are evicted to stay within the maximum cache size
+ * The data is copied and the evicted blocks are freed outside the lock
+ * Data that is larger than the maximum cache size is not cached
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decompressed_data_cache_insert_data(
+     libfsapfs_decompressed_data_cache_t *decompressed_data_cache,
+     uint64_t identifier,
+     uint64_t transaction_identifier,
+     uint32_t compressed_block_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_decompressed_data_cache_entry_t *bucket_entry     = NULL;
+	libfsapfs_decompressed_data_cache_entry_t *entry            = NULL;
+	libfsapfs_decompressed_data_cache_entry_t *evicted_entry    = NULL;
+	libfsapfs_decompressed_data_cache_entry_t *released_entries = NULL;
+	static char *function                                       = "libfsapfs_decompressed_data_cache_insert_data";
+	size64_t added_size                                         = 0;
+	size64_t evicted_size                                       = 0;
+	uint64_t number_of_evictions                                = 0;
+	uint32_t bucket_index                                       = 0;
+	int result                                                  = 1;
+
+	if( decompressed_data_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompressed data cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) data_size > decompressed_data_cache->maximum_cache_size )
+	{
+		return( 1 );
+	}
+	entry = memory_allocate_structure(
+	         libfsapfs_decompressed_data_cache_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( libfsapfs_decompressed_data_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 entry );
+
+		return( -1 );
+	}
+	entry->data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * data_size );
+
+	if( entry->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     entry->data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	entry->identifier             = identifier;
+	entry->transaction_identifier = transaction_identifier;
+	entry->compressed_block_index = compressed_block_index;
+	entry->data_size              = data_size;
+
+	bucket_index = libfsapfs_decompressed_data_cache_get_bucket_index(
+	                decompressed_data_cache,
+	                identifier,
+	                transaction_identifier,
+	                compressed_block_index );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     decompressed_data_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	bucket_entry = decompressed_data_cache->buckets[ bucket_index ];
+
+	while( bucket_entry != NULL )
+	{
+		if( ( bucket_entry->identifier == identifier )
+		 && ( bucket_entry->transaction_identifier == transaction_identifier )
+		 && ( bucket_entry->compressed_block_index == compressed_block_index ) )
+		{
+			break;
+		}
+		bucket_entry = bucket_entry->next_bucket_entry;
+	}
+	/* Another reader could have inserted the same block in the meantime
+	 */
+	if( bucket_entry != NULL )
+	{
+		entry->next_entry = released_entries;
+		released_entries  = entry;
+
+		goto on_exit;
+	}
+	/* Evict the least recently used entries, an evicted entry that is still
+	 * referenced is freed by its last reader
+	 */
+	while( ( decompressed_data_cache->last_entry != NULL )
+	    && ( ( decompressed_data_cache->cached_size + data_size ) > decompressed_data_cache->maximum_cache_size ) )
+	{
+		evicted_entry = decompressed_data_cache->last_entry;
+
+		libfsapfs_decompressed_data_cache_unlink_entry(
+		 decompressed_data_cache,
+		 evicted_entry );
+
+		bucket_index = libfsapfs_decompressed_data_cache_get_bucket_index(
+		                decompressed_data_cache,
+		                evicted_entry->identifier,
+		                evicted_entry->transaction_identifier,
+		                evicted_entry->compressed_block_index );
+
+		if( decompressed_data_cache->buckets[ bucket_index ] == evicted_entry )
+		{
+			decompressed_data_cache->buckets[ bucket_index ] = evicted_entry->next_bucket_entry;
+		}
+		else
+		{
+			bucket_entry = decompressed_data_cache->buckets[ bucket_index ];
+
+			while( bucket_entry->next_bucket_entry != evicted_entry )
+			{
+				bucket_entry = bucket_entry->next_bucket_entry;
+			}
+			bucket_entry->next_bucket_entry = evicted_entry->next_bucket_entry;
+		}
+		decompressed_data_cache->cached_size -= evicted_entry->data_size;
+
+		evicted_size        += evicted_entry->data_size;
+		number_of_evictions += 1;
+
+		if( evicted_entry->number_of_references > 0 )
+		{
+			evicted_entry->is_evicted = 1;
+		}
+		else
+		{
+			evicted_entry->next_entry = released_entries;
+			released_entries          = evicted_entry;
+		}
+	}
+	bucket_index = libfsapfs_decompressed_data_cache_get_bucket_index(
+	                decompressed_data_cache,
+	                identifier,
+	                transaction_identifier,
+	                compressed_block_index );
+
+	entry->next_bucket_entry                         = decompressed_data_cache->buckets[ bucket_index ];
+	decompressed_data_cache->buckets[ bucket_index ] = entry;
+
+	libfsapfs_decompressed_data_cache_link_first_entry(
+	 decompressed_data_cache,
+	 entry );
+
+	decompressed_data_cache->cached_size += data_size;
+
+	added_size = (size64_t) data_size;
+
+on_exit:
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     decompressed_data_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	while( released_entries != NULL )
+	{
+		evicted_entry    = released_entries;
+		released_entries = evicted_entry->next_entry;
+
+		memory_free(
+		 evicted_entry->data );
+		memory_free(
+		 evicted_entry );
+	}
+	if( ( number_of_evictions > 0 )
+	 || ( added_size > 0 ) )
+	{
+		if( libfsapfs_cache_statistics_update(
+		     decompressed_data_cache->cache_statistics,
+		     number_of_evictions,
+		     added_size,
+		     evicted_size,
+		     added_size,
+		     ( result == 1 ) ? error : NULL ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update cache statistics.",
+				 function );
+			}
+			result = -1;
+		}
+	}
+	return( result );
+
+on_error:
+	if( entry != NULL )
+	{
+		if( entry->data != NULL )
+		{
+			memory_free(
+			 entry->data );
+		}
+		memory_free(
+		 entry );
+	}
+	return( -1 );
+}
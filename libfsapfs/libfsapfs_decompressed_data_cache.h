@@ -0,0 +1,154 @@
+/*
+ * Decompressed data cache functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_DECOMPRESSED_DATA_CACHE_H )
+#define _LIBFSAPFS_DECOMPRESSED_DATA_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_cache_statistics.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_decompressed_data_cache_entry libfsapfs_decompressed_data_cache_entry_t;
+
+struct libfsapfs_decompressed_data_cache_entry
+{
+	/* The file system identifier
+	 */
+	uint64_t identifier;
+
+	/* The transaction identifier
+	 */
+	uint64_t transaction_identifier;
+
+	/* The compressed block index
+	 */
+	uint32_t compressed_block_index;
+
+	/* The (decompressed) data
+	 */
+	uint8_t *data;
+
+	/* The (decompressed) data size
+	 */
+	size_t data_size;
+
+	/* The number of readers copying the data outside the lock
+	 */
+	int number_of_references;
+
+	/* Value to indicate the entry was evicted while it was referenced
+	 */
+	uint8_t is_evicted;
+
+	/* The previous (more recently used) entry
+	 */
+	libfsapfs_decompressed_data_cache_entry_t *previous_entry;
+
+	/* The next (less recently used) entry
+	 */
+	libfsapfs_decompressed_data_cache_entry_t *next_entry;
+
+	/* The next entry in the same hash bucket
+	 */
+	libfsapfs_decompressed_data_cache_entry_t *next_bucket_entry;
+};
+
+typedef struct libfsapfs_decompressed_data_cache libfsapfs_decompressed_data_cache_t;
+
+struct libfsapfs_decompressed_data_cache
+{
+	/* The hash buckets
+	 */
+	libfsapfs_decompressed_data_cache_entry_t **buckets;
+
+	/* The number of hash buckets, which is a power of 2
+	 */
+	uint32_t number_of_buckets;
+
+	/* The most recently used entry
+	 */
+	libfsapfs_decompressed_data_cache_entry_t *first_entry;
+
+	/* The least recently used entry
+	 */
+	libfsapfs_decompressed_data_cache_entry_t *last_entry;
+
+	/* The maximum cache size in bytes
+	 */
+	size64_t maximum_cache_size;
+
+	/* The size of the cached data in bytes
+	 */
+	size64_t cached_size;
+
+	/* The cache statistics
+	 */
+	libfsapfs_cache_statistics_t *cache_statistics;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libfsapfs_decompressed_data_cache_initialize(
+     libfsapfs_decompressed_data_cache_t **decompressed_data_cache,
+     size64_t maximum_cache_size,
+     libfsapfs_cache_statistics_t *cache_statistics,
+     libcerror_error_t **error );
+
+int libfsapfs_decompressed_data_cache_free(
+     libfsapfs_decompressed_data_cache_t **decompressed_data_cache,
+     libcerror_error_t **error );
+
+int libfsapfs_decompressed_data_cache_get_data(
+     libfsapfs_decompressed_data_cache_t *decompressed_data_cache,
+     uint64_t identifier,
+     uint64_t transaction_identifier,
+     uint32_t compressed_block_index,
+     uint8_t *data,
+     size_t data_size,
+     size_t *cached_data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_decompressed_data_cache_insert_data(
+     libfsapfs_decompressed_data_cache_t *decompressed_data_cache,
+     uint64_t identifier,
+     uint64_t transaction_identifier,
+     uint32_t compressed_block_index,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_DECOMPRESSED_DATA_CACHE_H ) */
+
@@ -0,0 +1,485 @@
+/*
+ * Decompression pool functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_compression.h"
+#include "libfsapfs_decompression_pool.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcnotify.h"
+#include "libfsapfs_unused.h"
+#include "libfsapfs_worker_pool.h"
+
+/* Creates a decompression pool
+ * Make sure the value decompression_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decompression_pool_initialize(
+     libfsapfs_decompression_pool_t **decompression_pool,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_decompression_pool_initialize";
+
+	if( decompression_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decompression_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decompression pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSION_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*decompression_pool = memory_allocate_structure(
+	                       libfsapfs_decompression_pool_t );
+
+	if( *decompression_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decompression pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decompression_pool,
+	     0,
+	     sizeof( libfsapfs_decompression_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decompression pool.",
+		 function );
+
+		memory_free(
+		 *decompression_pool );
+
+		*decompression_pool = NULL;
+
+		return( -1 );
+	}
+	( *decompression_pool )->number_of_workers = number_of_workers;
+
+	if( libfsapfs_worker_pool_initialize(
+	     &( ( *decompression_pool )->worker_pool ),
+	     number_of_workers,
+	     LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSION_THREADS,
+	     (int (*)(intptr_t *, void *)) &libfsapfs_decompression_pool_worker_decompress,
+	     (void *) *decompression_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create worker pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decompression_pool != NULL )
+	{
+		libfsapfs_decompression_pool_free(
+		 decompression_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a decompression pool
+ * The threads are joined after they have processed the queued workers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decompression_pool_free(
+     libfsapfs_decompression_pool_t **decompression_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_decompression_pool_free";
+	int result            = 1;
+
+	if( decompression_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decompression_pool != NULL )
+	{
+		if( ( *decompression_pool )->worker_pool != NULL )
+		{
+			if( libfsapfs_worker_pool_free(
+			     &( ( *decompression_pool )->worker_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free worker pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *decompression_pool );
+
+		*decompression_pool = NULL;
+	}
+	return( result );
+}
+
+/* Decompresses the blocks of a worker
+ * This function is the job function of the worker pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decompression_pool_worker_decompress(
+     libfsapfs_decompression_pool_worker_t *worker,
+     libfsapfs_decompression_pool_t *decompression_pool LIBFSAPFS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	size_t compressed_offset = 0;
+	size_t compressed_size   = 0;
+	int block_index          = 0;
+	int result               = 1;
+
+	LIBFSAPFS_UNREFERENCED_PARAMETER( decompression_pool )
+
+	if( worker == NULL )
+	{
+		return( -1 );
+	}
+	for( block_index = 0;
+	     block_index < worker->number_of_blocks;
+	     block_index++ )
+	{
+		compressed_offset = (size_t) ( worker->compressed_block_offsets[ block_index ] - worker->compressed_block_offsets[ 0 ] );
+		compressed_size   = (size_t) ( worker->compressed_block_offsets[ block_index + 1 ] - worker->compressed_block_offsets[ block_index ] );
+
+		worker->uncompressed_block_sizes[ block_index ] = worker->block_size;
+
+		if( libfsapfs_decompress_data(
+		     &( worker->compressed_data[ compressed_offset ] ),
+		     compressed_size,
+		     worker->compression_method,
+		     &( worker->uncompressed_data[ block_index * worker->block_size ] ),
+		     &( worker->uncompressed_block_sizes[ block_index ] ),
+		     &error ) != 1 )
+		{
+			result = -1;
+
+			break;
+		}
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Decompresses consecutive compressed blocks
+ * The compressed data contains the compressed blocks, where compressed_block_offsets contains
+ * the number of blocks + 1 offsets of the blocks and the compressed data starts at the first offset
+ * The blocks are divided into ranges that are decompressed concurrently by the worker pool,
+ * which is possible since every compressed block is compressed independently.
+ * The worker descriptors are local to the call, so that multiple threads can decompress
+ * concurrently using the same pool
+ * Every block is decompressed into its own block size part of the uncompressed data
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decompression_pool_decompress(
+     libfsapfs_decompression_pool_t *decompression_pool,
+     int compression_method,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint32_t *compressed_block_offsets,
+     int number_of_blocks,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t block_size,
+     size_t *uncompressed_block_sizes,
+     libcerror_error_t **error )
+{
+	libfsapfs_decompression_pool_worker_t workers[ LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSION_THREADS ];
+	libfsapfs_worker_pool_job_t jobs[ LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSION_THREADS ];
+
+	libfsapfs_decompression_pool_worker_t *worker = NULL;
+	static char *function                         = "libfsapfs_decompression_pool_decompress";
+	int block_index                               = 0;
+	int blocks_per_worker                         = 0;
+	int number_of_workers                         = 0;
+	int worker_index                              = 0;
+
+	if( decompression_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decompression pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( decompression_pool->number_of_workers < 1 )
+	 || ( decompression_pool->number_of_workers > LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSION_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid decompression pool - number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_block_offsets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed block offsets.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_blocks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of blocks value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size == 0 )
+	 || ( (size_t) number_of_blocks > ( uncompressed_data_size / block_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_block_sizes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed block sizes.",
+		 function );
+
+		return( -1 );
+	}
+	for( block_index = 0;
+	     block_index < number_of_blocks;
+	     block_index++ )
+	{
+		if( ( compressed_block_offsets[ block_index + 1 ] < compressed_block_offsets[ block_index ] )
+		 || ( (size_t) ( compressed_block_offsets[ block_index + 1 ] - compressed_block_offsets[ 0 ] ) > compressed_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid compressed block: %d offset value out of bounds.",
+			 function,
+			 block_index + 1 );
+
+			return( -1 );
+		}
+	}
+	if( number_of_blocks == 0 )
+	{
+		return( 1 );
+	}
+	if( libfsapfs_worker_pool_get_number_of_workers(
+	     decompression_pool->worker_pool,
+	     &number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of workers of worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_workers > number_of_blocks )
+	{
+		number_of_workers = number_of_blocks;
+	}
+	blocks_per_worker = number_of_blocks / number_of_workers;
+
+	if( ( number_of_blocks % number_of_workers ) != 0 )
+	{
+		blocks_per_worker += 1;
+	}
+	block_index = 0;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( block_index >= number_of_blocks )
+		{
+			number_of_workers = worker_index;
+
+			break;
+		}
+		worker = &( workers[ worker_index ] );
+
+		worker->compression_method       = compression_method;
+		worker->compressed_data          = &( compressed_data[ compressed_block_offsets[ block_index ] - compressed_block_offsets[ 0 ] ] );
+		worker->compressed_block_offsets = &( compressed_block_offsets[ block_index ] );
+		worker->number_of_blocks         = blocks_per_worker;
+		worker->uncompressed_data        = &( uncompressed_data[ block_index * block_size ] );
+		worker->block_size               = block_size;
+		worker->uncompressed_block_sizes = &( uncompressed_block_sizes[ block_index ] );
+
+		if( worker->number_of_blocks > ( number_of_blocks - block_index ) )
+		{
+			worker->number_of_blocks = number_of_blocks - block_index;
+		}
+		block_index += worker->number_of_blocks;
+
+		jobs[ worker_index ].value = (intptr_t *) worker;
+	}
+	if( libfsapfs_worker_pool_run_jobs(
+	     decompression_pool->worker_pool,
+	     jobs,
+	     number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+		 "%s: unable to decompress data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
@@ -0,0 +1,113 @@
+/*
+ * Decompression pool functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_DECOMPRESSION_POOL_H )
+#define _LIBFSAPFS_DECOMPRESSION_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_worker_pool.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_decompression_pool libfsapfs_decompression_pool_t;
+
+typedef struct libfsapfs_decompression_pool_worker libfsapfs_decompression_pool_worker_t;
+
+struct libfsapfs_decompression_pool_worker
+{
+	/* The compression method
+	 */
+	int compression_method;
+
+	/* The compressed data
+	 */
+	const uint8_t *compressed_data;
+
+	/* The compressed block offsets, which contains the number of blocks + 1 offsets
+	 * The compressed data starts at the first offset
+	 */
+	const uint32_t *compressed_block_offsets;
+
+	/* The number of blocks
+	 */
+	int number_of_blocks;
+
+	/* The uncompressed data
+	 */
+	uint8_t *uncompressed_data;
+
+	/* The (maximum) uncompressed block size
+	 */
+	size_t block_size;
+
+	/* The uncompressed block sizes
+	 */
+	size_t *uncompressed_block_sizes;
+};
+
+struct libfsapfs_decompression_pool
+{
+	/* The number of workers, which includes the calling thread
+	 */
+	int number_of_workers;
+
+	/* The worker pool
+	 */
+	libfsapfs_worker_pool_t *worker_pool;
+};
+
+int libfsapfs_decompression_pool_initialize(
+     libfsapfs_decompression_pool_t **decompression_pool,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libfsapfs_decompression_pool_free(
+     libfsapfs_decompression_pool_t **decompression_pool,
+     libcerror_error_t **error );
+
+int libfsapfs_decompression_pool_worker_decompress(
+     libfsapfs_decompression_pool_worker_t *worker,
+     libfsapfs_decompression_pool_t *decompression_pool );
+
+int libfsapfs_decompression_pool_decompress(
+     libfsapfs_decompression_pool_t *decompression_pool,
+     int compression_method,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     const uint32_t *compressed_block_offsets,
+     int number_of_blocks,
+     uint8_t *uncompressed_data,
+     size_t uncompressed_data_size,
+     size_t block_size,
+     size_t *uncompressed_block_sizes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_DECOMPRESSION_POOL_H ) */
+
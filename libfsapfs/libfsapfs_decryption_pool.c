@@ -0,0 +1,843 @@
+/*
+ * Decryption pool functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_decryption_pool.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcnotify.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_worker_pool.h"
+
+/* Creates a decryption pool
+ * Every worker has its own encryption context, since an encryption context cannot be used
+ * by multiple threads at the same time
+ * Make sure the value decryption_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decryption_pool_initialize(
+     libfsapfs_decryption_pool_t **decryption_pool,
+     uint32_t method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     int number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsapfs_decryption_pool_initialize";
+	size_t encryption_contexts_size = 0;
+	int worker_index                = 0;
+
+	if( decryption_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decryption_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid decryption pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > LIBFSAPFS_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	encryption_contexts_size = sizeof( libfsapfs_encryption_context_t * ) * number_of_workers;
+
+	*decryption_pool = memory_allocate_structure(
+	                    libfsapfs_decryption_pool_t );
+
+	if( *decryption_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create decryption pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *decryption_pool,
+	     0,
+	     sizeof( libfsapfs_decryption_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear decryption pool.",
+		 function );
+
+		memory_free(
+		 *decryption_pool );
+
+		*decryption_pool = NULL;
+
+		return( -1 );
+	}
+	( *decryption_pool )->encryption_contexts = (libfsapfs_encryption_context_t **) memory_allocate(
+	                                                                                 encryption_contexts_size );
+
+	if( ( *decryption_pool )->encryption_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create encryption contexts.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *decryption_pool )->encryption_contexts,
+	     0,
+	     encryption_contexts_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear encryption contexts.",
+		 function );
+
+		goto on_error;
+	}
+	( *decryption_pool )->number_of_workers = number_of_workers;
+
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( libfsapfs_encryption_context_initialize(
+		     &( ( *decryption_pool )->encryption_contexts[ worker_index ] ),
+		     method,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create encryption context: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+		if( libfsapfs_encryption_context_set_keys(
+		     ( *decryption_pool )->encryption_contexts[ worker_index ],
+		     key,
+		     key_size,
+		     tweak_key,
+		     tweak_key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys in encryption context: %d.",
+			 function,
+			 worker_index );
+
+			goto on_error;
+		}
+	}
+	( *decryption_pool )->number_of_available_encryption_contexts = number_of_workers;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The mutex and condition are also needed by a single worker, since multiple
+	 * threads can decrypt concurrently using the same pool
+	 */
+	if( libcthreads_mutex_initialize(
+	     &( ( *decryption_pool )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *decryption_pool )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libfsapfs_worker_pool_initialize(
+	     &( ( *decryption_pool )->worker_pool ),
+	     number_of_workers,
+	     LIBFSAPFS_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS,
+	     (int (*)(intptr_t *, void *)) &libfsapfs_decryption_pool_worker_decrypt,
+	     (void *) *decryption_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create worker pool.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *decryption_pool != NULL )
+	{
+		libfsapfs_decryption_pool_free(
+		 decryption_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a decryption pool
+ * The threads are joined after they have processed the queued workers
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decryption_pool_free(
+     libfsapfs_decryption_pool_t **decryption_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_decryption_pool_free";
+	int result            = 1;
+	int worker_index      = 0;
+
+	if( decryption_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *decryption_pool != NULL )
+	{
+		if( ( *decryption_pool )->worker_pool != NULL )
+		{
+			if( libfsapfs_worker_pool_free(
+			     &( ( *decryption_pool )->worker_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free worker pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( ( *decryption_pool )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *decryption_pool )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *decryption_pool )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *decryption_pool )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *decryption_pool )->encryption_contexts != NULL )
+		{
+			for( worker_index = 0;
+			     worker_index < ( *decryption_pool )->number_of_workers;
+			     worker_index++ )
+			{
+				if( ( *decryption_pool )->encryption_contexts[ worker_index ] == NULL )
+				{
+					continue;
+				}
+				if( libfsapfs_encryption_context_free(
+				     &( ( *decryption_pool )->encryption_contexts[ worker_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free encryption context: %d.",
+					 function,
+					 worker_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *decryption_pool )->encryption_contexts );
+		}
+		memory_free(
+		 *decryption_pool );
+
+		*decryption_pool = NULL;
+	}
+	return( result );
+}
+
+/* Grabs an available encryption context for the exclusive use of the calling thread
+ * Waits until an encryption context is released if none is available
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decryption_pool_grab_encryption_context(
+     libfsapfs_decryption_pool_t *decryption_pool,
+     libfsapfs_encryption_context_t **encryption_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_decryption_pool_grab_encryption_context";
+	int result            = 1;
+
+	if( decryption_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( decryption_pool->encryption_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decryption pool - missing encryption contexts.",
+		 function );
+
+		return( -1 );
+	}
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decryption_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( decryption_pool->number_of_available_encryption_contexts == 0 )
+	{
+		if( libcthreads_condition_wait(
+		     decryption_pool->condition,
+		     decryption_pool->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+#endif
+	if( result == 1 )
+	{
+		if( decryption_pool->number_of_available_encryption_contexts <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid decryption pool - number of available encryption contexts value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			decryption_pool->number_of_available_encryption_contexts -= 1;
+
+			*encryption_context = decryption_pool->encryption_contexts[ decryption_pool->number_of_available_encryption_contexts ];
+
+			decryption_pool->encryption_contexts[ decryption_pool->number_of_available_encryption_contexts ] = NULL;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     decryption_pool->mutex,
+	     ( result == 1 ) ? error : NULL ) != 1 )
+	{
+		if( result == 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases an encryption context that was grabbed from the decryption pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decryption_pool_release_encryption_context(
+     libfsapfs_decryption_pool_t *decryption_pool,
+     libfsapfs_encryption_context_t *encryption_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_decryption_pool_release_encryption_context";
+	int result            = 1;
+
+	if( decryption_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( decryption_pool->encryption_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decryption pool - missing encryption contexts.",
+		 function );
+
+		return( -1 );
+	}
+	if( encryption_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encryption context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     decryption_pool->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( decryption_pool->number_of_available_encryption_contexts >= decryption_pool->number_of_workers )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid decryption pool - number of available encryption contexts value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		decryption_pool->encryption_contexts[ decryption_pool->number_of_available_encryption_contexts ] = encryption_context;
+
+		decryption_pool->number_of_available_encryption_contexts += 1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( result == 1 )
+	{
+		if( libcthreads_condition_broadcast(
+		     decryption_pool->condition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to broadcast condition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libcthreads_mutex_release(
+	     decryption_pool->mutex,
+	     ( result == 1 ) ? error : NULL ) != 1 )
+	{
+		if( result == 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+		}
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Decrypts the data of a worker in-place
+ * This function is the job function of the worker pool
+ * The worker grabs an encryption context of the pool for the duration of the decryption
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decryption_pool_worker_decrypt(
+     libfsapfs_decryption_pool_worker_t *worker,
+     libfsapfs_decryption_pool_t *decryption_pool )
+{
+	libfsapfs_encryption_context_t *encryption_context = NULL;
+	libcerror_error_t *error                           = NULL;
+	int result                                         = 0;
+
+	if( ( worker == NULL )
+	 || ( decryption_pool == NULL ) )
+	{
+		return( -1 );
+	}
+	if( libfsapfs_decryption_pool_grab_encryption_context(
+	     decryption_pool,
+	     &encryption_context,
+	     &error ) != 1 )
+	{
+		result = -1;
+	}
+	else
+	{
+		result = libfsapfs_encryption_context_crypt(
+		          encryption_context,
+		          LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		          worker->data,
+		          worker->data_size,
+		          worker->data,
+		          worker->data_size,
+		          worker->sector_number,
+		          worker->bytes_per_sector,
+		          &error );
+
+		if( libfsapfs_decryption_pool_release_encryption_context(
+		     decryption_pool,
+		     encryption_context,
+		     ( result == 1 ) ? &error : NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( result );
+}
+
+/* Decrypts consecutive sectors in-place
+ * The sectors are divided into ranges that are decrypted concurrently by the calling thread
+ * and the threads of the pool, which is possible since the tweak of every sector only depends
+ * on its sector number. The worker descriptors are local to the call and every range grabs
+ * an encryption context of the pool, so that multiple threads can decrypt concurrently
+ * using the same pool
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_decryption_pool_decrypt(
+     libfsapfs_decryption_pool_t *decryption_pool,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t sector_number,
+     uint16_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	libfsapfs_decryption_pool_worker_t workers[ LIBFSAPFS_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS ];
+	libfsapfs_worker_pool_job_t jobs[ LIBFSAPFS_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS ];
+
+	libfsapfs_decryption_pool_worker_t *worker = NULL;
+	static char *function                      = "libfsapfs_decryption_pool_decrypt";
+	size_t data_offset                         = 0;
+	size_t number_of_sectors                   = 0;
+	size_t sectors_per_worker                  = 0;
+	size_t maximum_number_of_workers           = 0;
+	int number_of_workers                      = 0;
+	int worker_index                           = 0;
+
+	if( decryption_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid decryption pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( decryption_pool->encryption_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid decryption pool - missing encryption contexts.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( decryption_pool->number_of_workers < 1 )
+	 || ( decryption_pool->number_of_workers > LIBFSAPFS_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid decryption pool - number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( bytes_per_sector == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bytes per sector value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size % bytes_per_sector ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( libfsapfs_worker_pool_get_number_of_workers(
+	     decryption_pool->worker_pool,
+	     &number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of workers of worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	/* Small amounts of data are not divided over all the workers
+	 */
+	maximum_number_of_workers = data_size / LIBFSAPFS_DECRYPTION_POOL_MINIMUM_WORKER_DATA_SIZE;
+
+	if( maximum_number_of_workers < 1 )
+	{
+		maximum_number_of_workers = 1;
+	}
+	if( (size_t) number_of_workers > maximum_number_of_workers )
+	{
+		number_of_workers = (int) maximum_number_of_workers;
+	}
+	number_of_sectors = data_size / bytes_per_sector;
+	sectors_per_worker = number_of_sectors / number_of_workers;
+
+	if( ( number_of_sectors % number_of_workers ) != 0 )
+	{
+		sectors_per_worker += 1;
+	}
+	for( worker_index = 0;
+	     worker_index < number_of_workers;
+	     worker_index++ )
+	{
+		if( data_offset >= data_size )
+		{
+			number_of_workers = worker_index;
+
+			break;
+		}
+		worker = &( workers[ worker_index ] );
+
+		worker->data             = &( data[ data_offset ] );
+		worker->data_size        = sectors_per_worker * bytes_per_sector;
+		worker->sector_number    = sector_number + ( data_offset / bytes_per_sector );
+		worker->bytes_per_sector = bytes_per_sector;
+
+		if( worker->data_size > ( data_size - data_offset ) )
+		{
+			worker->data_size = data_size - data_offset;
+		}
+		data_offset += worker->data_size;
+
+		jobs[ worker_index ].value = (intptr_t *) worker;
+	}
+	if( libfsapfs_worker_pool_run_jobs(
+	     decryption_pool->worker_pool,
+	     jobs,
+	     number_of_workers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+		 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+		 "%s: unable to decrypt data.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
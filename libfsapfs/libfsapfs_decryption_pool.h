@@ -0,0 +1,130 @@
+/*
+ * Decryption pool functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_DECRYPTION_POOL_H )
+#define _LIBFSAPFS_DECRYPTION_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_encryption_context.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_worker_pool.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_decryption_pool libfsapfs_decryption_pool_t;
+
+typedef struct libfsapfs_decryption_pool_worker libfsapfs_decryption_pool_worker_t;
+
+struct libfsapfs_decryption_pool_worker
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The sector number of the start of the data
+	 */
+	uint64_t sector_number;
+
+	/* The number of bytes per sector
+	 */
+	uint16_t bytes_per_sector;
+};
+
+struct libfsapfs_decryption_pool
+{
+	/* The number of workers, which includes the calling thread
+	 */
+	int number_of_workers;
+
+	/* The encryption contexts, which contains the number of workers encryption contexts
+	 */
+	libfsapfs_encryption_context_t **encryption_contexts;
+
+	/* The number of available encryption contexts, which are stored at the start of the encryption contexts
+	 */
+	int number_of_available_encryption_contexts;
+
+	/* The worker pool
+	 */
+	libfsapfs_worker_pool_t *worker_pool;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The mutex, which protects the available encryption contexts
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition, which is signalled when an encryption context is released
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+int libfsapfs_decryption_pool_initialize(
+     libfsapfs_decryption_pool_t **decryption_pool,
+     uint32_t method,
+     const uint8_t *key,
+     size_t key_size,
+     const uint8_t *tweak_key,
+     size_t tweak_key_size,
+     int number_of_workers,
+     libcerror_error_t **error );
+
+int libfsapfs_decryption_pool_free(
+     libfsapfs_decryption_pool_t **decryption_pool,
+     libcerror_error_t **error );
+
+int libfsapfs_decryption_pool_grab_encryption_context(
+     libfsapfs_decryption_pool_t *decryption_pool,
+     libfsapfs_encryption_context_t **encryption_context,
+     libcerror_error_t **error );
+
+int libfsapfs_decryption_pool_release_encryption_context(
+     libfsapfs_decryption_pool_t *decryption_pool,
+     libfsapfs_encryption_context_t *encryption_context,
+     libcerror_error_t **error );
+
+int libfsapfs_decryption_pool_worker_decrypt(
+     libfsapfs_decryption_pool_worker_t *worker,
+     libfsapfs_decryption_pool_t *decryption_pool );
+
+int libfsapfs_decryption_pool_decrypt(
+     libfsapfs_decryption_pool_t *decryption_pool,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t sector_number,
+     uint16_t bytes_per_sector,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_DECRYPTION_POOL_H ) */
+
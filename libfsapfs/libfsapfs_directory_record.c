@@ -1112,6 +1112,271 @@ int libfsapfs_directory_record_compare_name_with_utf16_string(
 	return( result );
 }
 
+/* Retrieves the name and name hash from directory record key data
+ * The name references the key data and is not copied
+ * The name hash is 0 if the key data does not contain a name hash
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_directory_record_get_name_from_key_data(
+     const uint8_t *data,
+     size_t data_size,
+     const uint8_t **name,
+     uint16_t *name_size,
+     uint32_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_directory_record_get_name_from_key_data";
+	size_t data_offset    = 0;
+	uint32_t safe_hash    = 0;
+	uint32_t safe_size    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fsapfs_file_system_btree_key_directory_record_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name size.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	/* Determine if the directory record key data contains a name or a name and hash based on its size
+	 */
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (fsapfs_file_system_btree_key_directory_record_t *) data )->name_size,
+	 safe_size );
+
+	safe_size &= 0x000003ffUL;
+
+	data_offset = sizeof( fsapfs_file_system_btree_key_directory_record_t );
+
+	if( safe_size < ( data_size - data_offset ) )
+	{
+		if( data_size < sizeof( fsapfs_file_system_btree_key_directory_record_with_hash_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (fsapfs_file_system_btree_key_directory_record_with_hash_t *) data )->name_size_and_hash,
+		 safe_hash );
+
+		safe_size = safe_hash & 0x000003ffUL;
+		safe_hash = ( safe_hash & 0xfffffc00UL ) >> 10;
+
+		data_offset = sizeof( fsapfs_file_system_btree_key_directory_record_with_hash_t );
+	}
+	if( ( safe_size == 0 )
+	 || ( (size_t) safe_size > ( data_size - data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*name      = &( data[ data_offset ] );
+	*name_size = (uint16_t) safe_size;
+	*name_hash = safe_hash;
+
+	return( 1 );
+}
+
+/* Compares an UTF-8 string with the name in directory record key data
+ * The name is compared in place, without creating a directory record
+ * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsapfs_directory_record_compare_key_data_with_utf8_string(
+     const uint8_t *data,
+     size_t data_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t name_hash,
+     uint8_t use_case_folding,
+     libcerror_error_t **error )
+{
+	const uint8_t *name    = NULL;
+	static char *function  = "libfsapfs_directory_record_compare_key_data_with_utf8_string";
+	uint32_t key_name_hash = 0;
+	uint16_t name_size     = 0;
+	int result             = 0;
+
+	if( libfsapfs_directory_record_get_name_from_key_data(
+	     data,
+	     data_size,
+	     &name,
+	     &name_size,
+	     &key_name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name from key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_name_hash != 0 )
+	 && ( name_hash != 0 ) )
+	{
+		if( name_hash < key_name_hash )
+		{
+			return( LIBUNA_COMPARE_LESS );
+		}
+		else if( name_hash > key_name_hash )
+		{
+			return( LIBUNA_COMPARE_GREATER );
+		}
+	}
+	result = libfsapfs_name_compare_with_utf8_string(
+	          name,
+	          (size_t) name_size,
+	          utf8_string,
+	          utf8_string_length,
+	          use_case_folding,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare UTF-8 string with name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Compares an UTF-16 string with the name in directory record key data
+ * The name is compared in place, without creating a directory record
+ * Returns LIBUNA_COMPARE_LESS, LIBUNA_COMPARE_EQUAL, LIBUNA_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsapfs_directory_record_compare_key_data_with_utf16_string(
+     const uint8_t *data,
+     size_t data_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t name_hash,
+     uint8_t use_case_folding,
+     libcerror_error_t **error )
+{
+	const uint8_t *name    = NULL;
+	static char *function  = "libfsapfs_directory_record_compare_key_data_with_utf16_string";
+	uint32_t key_name_hash = 0;
+	uint16_t name_size     = 0;
+	int result             = 0;
+
+	if( libfsapfs_directory_record_get_name_from_key_data(
+	     data,
+	     data_size,
+	     &name,
+	     &name_size,
+	     &key_name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name from key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_name_hash != 0 )
+	 && ( name_hash != 0 ) )
+	{
+		if( name_hash < key_name_hash )
+		{
+			return( LIBUNA_COMPARE_LESS );
+		}
+		else if( name_hash > key_name_hash )
+		{
+			return( LIBUNA_COMPARE_GREATER );
+		}
+	}
+	result = libfsapfs_name_compare_with_utf16_string(
+	          name,
+	          (size_t) name_size,
+	          utf16_string,
+	          utf16_string_length,
+	          use_case_folding,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare UTF-16 string with name.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
 /* Retrieves the added time
  * The timestamp is a signed 64-bit POSIX date and time value in number of nano seconds
  * Returns 1 if successful or -1 on error
@@ -124,6 +124,32 @@ int libfsapfs_directory_record_compare_name_with_utf16_string(
      uint8_t use_case_folding,
      libcerror_error_t **error );
 
+int libfsapfs_directory_record_get_name_from_key_data(
+     const uint8_t *data,
+     size_t data_size,
+     const uint8_t **name,
+     uint16_t *name_size,
+     uint32_t *name_hash,
+     libcerror_error_t **error );
+
+int libfsapfs_directory_record_compare_key_data_with_utf8_string(
+     const uint8_t *data,
+     size_t data_size,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint32_t name_hash,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
+int libfsapfs_directory_record_compare_key_data_with_utf16_string(
+     const uint8_t *data,
+     size_t data_size,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     uint32_t name_hash,
+     uint8_t use_case_folding,
+     libcerror_error_t **error );
+
 int libfsapfs_directory_record_get_added_time(
      libfsapfs_directory_record_t *directory_record,
      int64_t *posix_time,
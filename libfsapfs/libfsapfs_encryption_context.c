@@ -29,6 +29,7 @@
 #include "libfsapfs_libcaes.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
+#include "libfsapfs_libcthreads.h"
 
 /* Creates an encryption context
  * Make sure the value encryption context is referencing, is set to NULL
@@ -120,6 +121,47 @@ int libfsapfs_encryption_context_initialize(
 
 		goto on_error;
 	}
+	if( libcaes_context_initialize(
+	     &( ( *context )->block_decryption_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize block decryption context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcaes_context_initialize(
+	     &( ( *context )->tweak_encryption_context ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize tweak encryption context.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *context )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	( *context )->method = method;
 
 	return( 1 );
@@ -127,6 +169,18 @@ int libfsapfs_encryption_context_initialize(
 on_error:
 	if( *context != NULL )
 	{
+		if( ( *context )->tweak_encryption_context != NULL )
+		{
+			libcaes_context_free(
+			 &( ( *context )->tweak_encryption_context ),
+			 NULL );
+		}
+		if( ( *context )->block_decryption_context != NULL )
+		{
+			libcaes_context_free(
+			 &( ( *context )->block_decryption_context ),
+			 NULL );
+		}
 		if( ( *context )->decryption_context != NULL )
 		{
 			libcaes_tweaked_context_free(
@@ -177,6 +231,52 @@ int libfsapfs_encryption_context_free(
 
 			result = -1;
 		}
+		if( libcaes_context_free(
+		     &( ( *context )->block_decryption_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable free block decryption context.",
+			 function );
+
+			result = -1;
+		}
+		if( libcaes_context_free(
+		     &( ( *context )->tweak_encryption_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable free tweak encryption context.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *context )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_set(
+		 *context,
+		 0,
+		 sizeof( libfsapfs_encryption_context_t ) );
+
 		memory_free(
 		 *context );
 
@@ -185,6 +285,163 @@ int libfsapfs_encryption_context_free(
 	return( result );
 }
 
+/* Clones an encryption context
+ * The clone has its own de- and encryption contexts set up with the keys of the source
+ * so that it can be used without contending for the lock of the source
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_encryption_context_clone(
+     libfsapfs_encryption_context_t **destination_context,
+     libfsapfs_encryption_context_t *source_context,
+     libcerror_error_t **error )
+{
+	uint8_t key[ 16 ];
+	uint8_t tweak_key[ 16 ];
+
+	static char *function = "libfsapfs_encryption_context_clone";
+	uint8_t keys_are_set  = 0;
+
+	if( destination_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_context == NULL )
+	{
+		*destination_context = NULL;
+
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     source_context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	keys_are_set = source_context->keys_are_set;
+
+	if( keys_are_set != 0 )
+	{
+		/* The memory_copy return value is not checked so that the lock is always released
+		 */
+		memory_copy(
+		 key,
+		 source_context->key,
+		 16 );
+
+		memory_copy(
+		 tweak_key,
+		 source_context->tweak_key,
+		 16 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     source_context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( libfsapfs_encryption_context_initialize(
+	     destination_context,
+	     source_context->method,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create destination context.",
+		 function );
+
+		goto on_error;
+	}
+	if( keys_are_set != 0 )
+	{
+		if( libfsapfs_encryption_context_set_keys(
+		     *destination_context,
+		     key,
+		     16,
+		     tweak_key,
+		     16,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set keys in destination context.",
+			 function );
+
+			goto on_error;
+		}
+		memory_set(
+		 key,
+		 0,
+		 16 );
+
+		memory_set(
+		 tweak_key,
+		 0,
+		 16 );
+	}
+	return( 1 );
+
+on_error:
+	if( keys_are_set != 0 )
+	{
+		memory_set(
+		 key,
+		 0,
+		 16 );
+
+		memory_set(
+		 tweak_key,
+		 0,
+		 16 );
+	}
+	if( *destination_context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 destination_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Sets the de- and encryption keys
  * Returns 1 if successful or -1 on error
  */
@@ -283,6 +540,21 @@ int libfsapfs_encryption_context_set_keys(
 	}
 	key_bit_size = key_byte_size * 8;
 
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libcaes_tweaked_context_set_keys(
 	     context->decryption_context,
 	     LIBCAES_CRYPT_MODE_DECRYPT,
@@ -299,12 +571,110 @@ int libfsapfs_encryption_context_set_keys(
 		 "%s: unable to set keys in decryption context.",
 		 function );
 
+		goto on_error;
+	}
+	if( libcaes_context_set_key(
+	     context->block_decryption_context,
+	     LIBCAES_CRYPT_MODE_DECRYPT,
+	     key,
+	     key_bit_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key in block decryption context.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcaes_context_set_key(
+	     context->tweak_encryption_context,
+	     LIBCAES_CRYPT_MODE_ENCRYPT,
+	     tweak_key,
+	     key_bit_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key in tweak encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     context->key,
+	     key,
+	     key_byte_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     context->tweak_key,
+	     tweak_key,
+	     key_byte_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy tweak key.",
+		 function );
+
+		goto on_error;
+	}
+	context->keys_are_set = 1;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
+#endif
 	return( 1 );
+
+on_error:
+	memory_set(
+	 context->key,
+	 0,
+	 16 );
+
+	memory_set(
+	 context->tweak_key,
+	 0,
+	 16 );
+
+	context->keys_are_set = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 context->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
 }
 
 /* De- or encrypts a block of data
+ * The input and output data can refer to the same buffer to de- or encrypt in-place
  * Returns 1 if successful or -1 on error
  */
 int libfsapfs_encryption_context_crypt(
@@ -400,26 +770,106 @@ int libfsapfs_encryption_context_crypt(
 
 		return( -1 );
 	}
-	if( memory_set(
-	     tweak_value,
-	     0,
-	     16 ) == NULL )
+	if( bytes_per_sector == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear tweak value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid bytes per sector value zero or less.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( data_offset = 0;
-	     data_offset < input_data_size;
-	     data_offset += bytes_per_sector )
+	if( ( input_data_size % bytes_per_sector ) != 0 )
 	{
-		byte_stream_copy_from_uint64_little_endian(
-		 tweak_value,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid input data size value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	/* If the sector size is a multiple of the AES block size no ciphertext stealing
+	 * is needed and the sectors can be decrypted in batches
+	 */
+	if( ( bytes_per_sector % 16 ) == 0 )
+	{
+		if( input_data != output_data )
+		{
+			if( memory_copy(
+			     output_data,
+			     input_data,
+			     input_data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy input data to output data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libfsapfs_encryption_context_decrypt_sectors(
+		     context,
+		     output_data,
+		     input_data_size,
+		     sector_number,
+		     bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* The AES-XTS decryption context is not safe for concurrent use
+	 */
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( memory_set(
+	     tweak_value,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear tweak value.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_offset = 0;
+	     data_offset < input_data_size;
+	     data_offset += bytes_per_sector )
+	{
+		byte_stream_copy_from_uint64_little_endian(
+		 tweak_value,
 		 sector_number );
 
 		if( libcaes_crypt_xts(
@@ -444,6 +894,26 @@ int libfsapfs_encryption_context_crypt(
 		}
 		sector_number += 1;
 	}
+	memory_set(
+	 tweak_value,
+	 0,
+	 16 );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( 1 );
 
 on_error:
@@ -452,6 +922,364 @@ on_error:
 	 0,
 	 16 );
 
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 context->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Applies the XTS tweaks of consecutive sectors to data
+ * The tweak of the first 16-byte block of a sector is its encrypted tweak, the tweak
+ * of every following block is the tweak of the previous block multiplied by x in GF(2^128)
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_encryption_context_apply_tweaks(
+     const uint8_t *encrypted_tweaks,
+     size_t number_of_sectors,
+     uint16_t bytes_per_sector,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_encryption_context_apply_tweaks";
+	size_t block_offset   = 0;
+	size_t data_offset    = 0;
+	size_t sector_index   = 0;
+	uint64_t carry        = 0;
+	uint64_t tweak_lower  = 0;
+	uint64_t tweak_upper  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( encrypted_tweaks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encrypted tweaks.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector == 0 )
+	 || ( ( bytes_per_sector % 16 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) SSIZE_MAX )
+	 || ( data_size < ( number_of_sectors * bytes_per_sector ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( sector_index = 0;
+	     sector_index < number_of_sectors;
+	     sector_index++ )
+	{
+		byte_stream_copy_to_uint64_little_endian(
+		 &( encrypted_tweaks[ sector_index * 16 ] ),
+		 tweak_lower );
+
+		byte_stream_copy_to_uint64_little_endian(
+		 &( encrypted_tweaks[ ( sector_index * 16 ) + 8 ] ),
+		 tweak_upper );
+
+		for( block_offset = 0;
+		     block_offset < (size_t) bytes_per_sector;
+		     block_offset += 16 )
+		{
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 value_64bit );
+
+			value_64bit ^= tweak_lower;
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( data[ data_offset ] ),
+			 value_64bit );
+
+			byte_stream_copy_to_uint64_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 value_64bit );
+
+			value_64bit ^= tweak_upper;
+
+			byte_stream_copy_from_uint64_little_endian(
+			 &( data[ data_offset + 8 ] ),
+			 value_64bit );
+
+			data_offset += 16;
+
+			/* Multiply the tweak by x, using the polynomial x^128 + x^7 + x^2 + x + 1
+			 */
+			carry       = tweak_upper >> 63;
+			tweak_upper = ( tweak_upper << 1 ) | ( tweak_lower >> 63 );
+			tweak_lower = ( tweak_lower << 1 ) ^ ( carry * 0x87 );
+		}
+	}
+	return( 1 );
+}
+
+/* Decrypts consecutive sectors in-place
+ * The tweaks of a batch of sectors are encrypted with a single AES-ECB call and
+ * the tweaked data of the batch is decrypted with a single AES-ECB call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_encryption_context_decrypt_sectors(
+     libfsapfs_encryption_context_t *context,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t sector_number,
+     uint16_t bytes_per_sector,
+     libcerror_error_t **error )
+{
+	uint8_t encrypted_tweaks[ LIBFSAPFS_ENCRYPTION_MAXIMUM_NUMBER_OF_BATCHED_SECTORS * 16 ];
+
+	static char *function    = "libfsapfs_encryption_context_decrypt_sectors";
+	size_t batch_data_size   = 0;
+	size_t data_offset       = 0;
+	size_t number_of_sectors = 0;
+	size_t sector_index      = 0;
+	size_t tweaks_size       = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( bytes_per_sector == 0 )
+	 || ( ( bytes_per_sector % 16 ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size % bytes_per_sector ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value not a multiple of bytes per sector.",
+		 function );
+
+		return( -1 );
+	}
+	/* The AES contexts are not safe for concurrent use
+	 */
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	while( data_offset < data_size )
+	{
+		number_of_sectors = ( data_size - data_offset ) / bytes_per_sector;
+
+		if( number_of_sectors > LIBFSAPFS_ENCRYPTION_MAXIMUM_NUMBER_OF_BATCHED_SECTORS )
+		{
+			number_of_sectors = LIBFSAPFS_ENCRYPTION_MAXIMUM_NUMBER_OF_BATCHED_SECTORS;
+		}
+		batch_data_size = number_of_sectors * bytes_per_sector;
+		tweaks_size     = number_of_sectors * 16;
+
+		if( memory_set(
+		     encrypted_tweaks,
+		     0,
+		     tweaks_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear encrypted tweaks.",
+			 function );
+
+			goto on_error;
+		}
+		for( sector_index = 0;
+		     sector_index < number_of_sectors;
+		     sector_index++ )
+		{
+			byte_stream_copy_from_uint64_little_endian(
+			 &( encrypted_tweaks[ sector_index * 16 ] ),
+			 sector_number + sector_index );
+		}
+		if( libcaes_crypt_ecb(
+		     context->tweak_encryption_context,
+		     LIBCAES_CRYPT_MODE_ENCRYPT,
+		     encrypted_tweaks,
+		     tweaks_size,
+		     encrypted_tweaks,
+		     tweaks_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_ENCRYPT_FAILED,
+			 "%s: unable to encrypt tweaks.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_encryption_context_apply_tweaks(
+		     encrypted_tweaks,
+		     number_of_sectors,
+		     bytes_per_sector,
+		     &( data[ data_offset ] ),
+		     batch_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to apply tweaks to encrypted data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcaes_crypt_ecb(
+		     context->block_decryption_context,
+		     LIBCAES_CRYPT_MODE_DECRYPT,
+		     &( data[ data_offset ] ),
+		     batch_data_size,
+		     &( data[ data_offset ] ),
+		     batch_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt data.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_encryption_context_apply_tweaks(
+		     encrypted_tweaks,
+		     number_of_sectors,
+		     bytes_per_sector,
+		     &( data[ data_offset ] ),
+		     batch_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to apply tweaks to decrypted data.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset   += batch_data_size;
+		sector_number += number_of_sectors;
+	}
+	memory_set(
+	 encrypted_tweaks,
+	 0,
+	 LIBFSAPFS_ENCRYPTION_MAXIMUM_NUMBER_OF_BATCHED_SECTORS * 16 );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     context->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+	memory_set(
+	 encrypted_tweaks,
+	 0,
+	 LIBFSAPFS_ENCRYPTION_MAXIMUM_NUMBER_OF_BATCHED_SECTORS * 16 );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 context->read_write_lock,
+	 NULL );
+#endif
 	return( -1 );
 }
 
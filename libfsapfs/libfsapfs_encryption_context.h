@@ -27,6 +27,7 @@
 
 #include "libfsapfs_libcaes.h"
 #include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -43,6 +44,32 @@ struct libfsapfs_encryption_context
 	/* The AES-XTS decryption context
 	 */
 	libcaes_tweaked_context_t *decryption_context;
+
+	/* The AES decryption context of the data key, used for batched decryption
+	 */
+	libcaes_context_t *block_decryption_context;
+
+	/* The AES encryption context of the tweak key, used for batched decryption
+	 */
+	libcaes_context_t *tweak_encryption_context;
+
+	/* The key, retained to clone the context
+	 */
+	uint8_t key[ 16 ];
+
+	/* The tweak key, retained to clone the context
+	 */
+	uint8_t tweak_key[ 16 ];
+
+	/* Value to indicate the keys are set
+	 */
+	uint8_t keys_are_set;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfsapfs_encryption_context_initialize(
@@ -54,6 +81,11 @@ int libfsapfs_encryption_context_free(
      libfsapfs_encryption_context_t **context,
      libcerror_error_t **error );
 
+int libfsapfs_encryption_context_clone(
+     libfsapfs_encryption_context_t **destination_context,
+     libfsapfs_encryption_context_t *source_context,
+     libcerror_error_t **error );
+
 int libfsapfs_encryption_context_set_keys(
      libfsapfs_encryption_context_t *context,
      const uint8_t *key,
@@ -73,6 +105,22 @@ int libfsapfs_encryption_context_crypt(
      uint16_t bytes_per_sector,
      libcerror_error_t **error );
 
+int libfsapfs_encryption_context_apply_tweaks(
+     const uint8_t *encrypted_tweaks,
+     size_t number_of_sectors,
+     uint16_t bytes_per_sector,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_encryption_context_decrypt_sectors(
+     libfsapfs_encryption_context_t *context,
+     uint8_t *data,
+     size_t data_size,
+     uint64_t sector_number,
+     uint16_t bytes_per_sector,
+     libcerror_error_t **error );
+
 int libfsapfs_encryption_aes_key_unwrap(
      const uint8_t *key,
      size_t key_size_bits,
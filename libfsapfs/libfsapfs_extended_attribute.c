@@ -214,6 +214,23 @@ int libfsapfs_extended_attribute_free(
 				result = -1;
 			}
 		}
+		if( internal_extended_attribute->positional_data_streams != NULL )
+		{
+			if( libcdata_array_free(
+			     &( internal_extended_attribute->positional_data_streams ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfdata_stream_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free positional data streams array.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_extended_attribute );
 	}
@@ -695,20 +712,21 @@ int libfsapfs_internal_extended_attribute_get_data_stream(
 	return( 1 );
 }
 
-/* Reads data at the current offset into a buffer
- * Returns the number of bytes read or -1 on error
+/* Grabs a data stream for a positional read
+ * The data stream is taken from the available positional data streams or created if none is available,
+ * it should be returned with libfsapfs_internal_extended_attribute_release_positional_data_stream
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfsapfs_extended_attribute_read_buffer(
-         libfsapfs_extended_attribute_t *extended_attribute,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libfsapfs_internal_extended_attribute_grab_positional_data_stream(
+     libfsapfs_internal_extended_attribute_t *internal_extended_attribute,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error )
 {
-	libfsapfs_internal_extended_attribute_t *internal_extended_attribute = NULL;
-	static char *function                                                = "libfsapfs_extended_attribute_read_buffer";
-	ssize_t read_count                                                   = 0;
+	static char *function = "libfsapfs_internal_extended_attribute_grab_positional_data_stream";
+	int number_of_entries = 0;
+	int result            = 1;
 
-	if( extended_attribute == NULL )
+	if( internal_extended_attribute == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -719,8 +737,17 @@ ssize_t libfsapfs_extended_attribute_read_buffer(
 
 		return( -1 );
 	}
-	internal_extended_attribute = (libfsapfs_internal_extended_attribute_t *) extended_attribute;
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
 
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_extended_attribute->read_write_lock,
@@ -736,42 +763,98 @@ ssize_t libfsapfs_extended_attribute_read_buffer(
 		return( -1 );
 	}
 #endif
-	if( internal_extended_attribute->data_stream == NULL )
+	if( internal_extended_attribute->positional_data_streams != NULL )
 	{
-		if( libfsapfs_internal_extended_attribute_get_data_stream(
-		     internal_extended_attribute,
+		if( libcdata_array_get_number_of_entries(
+		     internal_extended_attribute->positional_data_streams,
+		     &number_of_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
+			 "%s: unable to retrieve number of positional data streams.",
 			 function );
 
-			read_count = -1;
+			result = -1;
 		}
 	}
-	if( internal_extended_attribute->data_stream != NULL )
+	if( result != -1 )
 	{
-		read_count = libfdata_stream_read_buffer(
-		              internal_extended_attribute->data_stream,
-		              (intptr_t *) internal_extended_attribute->file_io_handle,
-		              (uint8_t *) buffer,
-		              buffer_size,
-		              0,
-		              error );
+		if( number_of_entries > 0 )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_extended_attribute->positional_data_streams,
+			     number_of_entries - 1,
+			     (intptr_t **) data_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve positional data stream: %d.",
+				 function,
+				 number_of_entries - 1 );
 
-		if( read_count < 0 )
+				result = -1;
+			}
+			else if( libcdata_array_set_entry_by_index(
+			          internal_extended_attribute->positional_data_streams,
+			          number_of_entries - 1,
+			          NULL,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set positional data stream: %d.",
+				 function,
+				 number_of_entries - 1 );
+
+				*data_stream = NULL;
+				result       = -1;
+			}
+			else if( libcdata_array_resize(
+			          internal_extended_attribute->positional_data_streams,
+			          number_of_entries - 1,
+			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdata_stream_free,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize positional data streams array.",
+				 function );
+
+				libfdata_stream_free(
+				 data_stream,
+				 NULL );
+
+				result = -1;
+			}
+		}
+		else if( libfsapfs_attributes_get_data_stream(
+		          internal_extended_attribute->attribute_values,
+		          internal_extended_attribute->io_handle,
+		          internal_extended_attribute->file_io_handle,
+		          internal_extended_attribute->encryption_context,
+		          internal_extended_attribute->file_system_btree,
+		          internal_extended_attribute->transaction_identifier,
+		          data_stream,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer from data stream.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create positional data stream.",
 			 function );
 
-			read_count = -1;
+			result = -1;
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
@@ -786,24 +869,150 @@ ssize_t libfsapfs_extended_attribute_read_buffer(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		if( *data_stream != NULL )
+		{
+			libfdata_stream_free(
+			 data_stream,
+			 NULL );
+		}
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
 }
 
-/* Reads data at a specific offset
+/* Releases a data stream used for a positional read
+ * The data stream is made available for subsequent positional reads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_extended_attribute_release_positional_data_stream(
+     libfsapfs_internal_extended_attribute_t *internal_extended_attribute,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_extended_attribute_release_positional_data_stream";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( internal_extended_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_stream == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_extended_attribute->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libfdata_stream_free(
+		 data_stream,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( internal_extended_attribute->positional_data_streams == NULL )
+	{
+		if( libcdata_array_initialize(
+		     &( internal_extended_attribute->positional_data_streams ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create positional data streams array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		if( libcdata_array_append_entry(
+		     internal_extended_attribute->positional_data_streams,
+		     &entry_index,
+		     (intptr_t *) *data_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append positional data stream to array.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*data_stream = NULL;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_extended_attribute->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( *data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 data_stream,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Reads data at the current offset into a buffer
  * Returns the number of bytes read or -1 on error
  */
-ssize_t libfsapfs_extended_attribute_read_buffer_at_offset(
+ssize_t libfsapfs_extended_attribute_read_buffer(
          libfsapfs_extended_attribute_t *extended_attribute,
          void *buffer,
          size_t buffer_size,
-         off64_t offset,
          libcerror_error_t **error )
 {
 	libfsapfs_internal_extended_attribute_t *internal_extended_attribute = NULL;
-	static char *function                                                = "libfsapfs_extended_attribute_read_buffer_at_offset";
+	static char *function                                                = "libfsapfs_extended_attribute_read_buffer";
 	ssize_t read_count                                                   = 0;
 
 	if( extended_attribute == NULL )
@@ -852,12 +1061,11 @@ ssize_t libfsapfs_extended_attribute_read_buffer_at_offset(
 	}
 	if( internal_extended_attribute->data_stream != NULL )
 	{
-		read_count = libfdata_stream_read_buffer_at_offset(
+		read_count = libfdata_stream_read_buffer(
 		              internal_extended_attribute->data_stream,
 		              (intptr_t *) internal_extended_attribute->file_io_handle,
 		              (uint8_t *) buffer,
 		              buffer_size,
-		              offset,
 		              0,
 		              error );
 
@@ -867,7 +1075,7 @@ ssize_t libfsapfs_extended_attribute_read_buffer_at_offset(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer at offset from data stream.",
+			 "%s: unable to read buffer from data stream.",
 			 function );
 
 			read_count = -1;
@@ -891,6 +1099,90 @@ ssize_t libfsapfs_extended_attribute_read_buffer_at_offset(
 	return( read_count );
 }
 
+/* Reads data at a specific offset
+ * This function does not change the current offset and can be called concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsapfs_extended_attribute_read_buffer_at_offset(
+         libfsapfs_extended_attribute_t *extended_attribute,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfdata_stream_t *data_stream                                       = NULL;
+	libfsapfs_internal_extended_attribute_t *internal_extended_attribute = NULL;
+	static char *function                                                = "libfsapfs_extended_attribute_read_buffer_at_offset";
+	ssize_t read_count                                                   = 0;
+
+	if( extended_attribute == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extended attribute.",
+		 function );
+
+		return( -1 );
+	}
+	internal_extended_attribute = (libfsapfs_internal_extended_attribute_t *) extended_attribute;
+
+	if( libfsapfs_internal_extended_attribute_grab_positional_data_stream(
+	     internal_extended_attribute,
+	     &data_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab positional data stream.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              data_stream,
+	              (intptr_t *) internal_extended_attribute->file_io_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset from data stream.",
+		 function );
+
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_extended_attribute_release_positional_data_stream(
+	     internal_extended_attribute,
+	     &data_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release positional data stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
+}
+
 /* Seeks a certain offset
  * Returns the offset if seek is successful or -1 on error
  */
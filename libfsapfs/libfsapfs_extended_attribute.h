@@ -77,6 +77,10 @@ struct libfsapfs_internal_extended_attribute
 	 */
 	libfdata_stream_t *data_stream;
 
+	/* The data streams available for positional reads
+	 */
+	libcdata_array_t *positional_data_streams;
+
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -140,6 +144,16 @@ int libfsapfs_internal_extended_attribute_get_data_stream(
      libfsapfs_internal_extended_attribute_t *internal_extended_attribute,
      libcerror_error_t **error );
 
+int libfsapfs_internal_extended_attribute_grab_positional_data_stream(
+     libfsapfs_internal_extended_attribute_t *internal_extended_attribute,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_extended_attribute_release_positional_data_stream(
+     libfsapfs_internal_extended_attribute_t *internal_extended_attribute,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 ssize_t libfsapfs_extended_attribute_read_buffer(
          libfsapfs_extended_attribute_t *extended_attribute,
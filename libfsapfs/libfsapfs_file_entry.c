@@ -141,6 +141,19 @@ int libfsapfs_file_entry_initialize(
 
 		goto on_error;
 	}
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file_entry->data_stream_read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize data stream read/write lock.",
+		 function );
+
+		goto on_error;
+	}
 #endif
 	*file_entry = (libfsapfs_file_entry_t *) internal_file_entry;
 
@@ -196,6 +209,19 @@ int libfsapfs_file_entry_free(
 
 			result = -1;
 		}
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file_entry->data_stream_read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data stream read/write lock.",
+			 function );
+
+			result = -1;
+		}
 #endif
 		/* The file_io_handle and file_system_btree references are freed elsewhere
 		 */
@@ -319,12 +345,280 @@ int libfsapfs_file_entry_free(
 				result = -1;
 			}
 		}
+		if( internal_file_entry->positional_data_streams != NULL )
+		{
+			if( libcdata_array_free(
+			     &( internal_file_entry->positional_data_streams ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfdata_stream_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free positional data streams array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_file_entry->compressed_data_streams != NULL )
+		{
+			if( libcdata_array_free(
+			     &( internal_file_entry->compressed_data_streams ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &libfdata_stream_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free compressed data streams array.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_file_entry );
 	}
 	return( result );
 }
 
+/* Determines if a lazily read value of the file entry has been determined
+ * Returns 1 if determined, 0 if not or -1 on error
+ */
+int libfsapfs_internal_file_entry_is_value_determined(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     int value_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_file_entry_is_value_determined";
+	int result            = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	switch( value_type )
+	{
+		case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_SIZE:
+			result = (int) ( internal_file_entry->data_size != (size64_t) -1 );
+			break;
+
+		case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_STREAM:
+			result = (int) ( internal_file_entry->data_stream != NULL );
+			break;
+
+		case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DIRECTORY_ENTRIES:
+			result = (int) ( internal_file_entry->directory_entries != NULL );
+			break;
+
+		case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_EXTENDED_ATTRIBUTES:
+			result = (int) ( internal_file_entry->extended_attributes_array != NULL );
+			break;
+
+		case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_FILE_EXTENTS:
+			result = (int) ( internal_file_entry->file_extents != NULL );
+			break;
+
+		/* A file entry without a symbolic link extended attribute has no symbolic link data
+		 */
+		case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_SYMBOLIC_LINK_DATA:
+			result = (int) ( ( internal_file_entry->symbolic_link_data != NULL )
+			              || ( ( internal_file_entry->extended_attributes_array != NULL )
+			               &&  ( internal_file_entry->symbolic_link_attribute_values == NULL ) ) );
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type: %d.",
+			 function,
+			 value_type );
+
+			return( -1 );
+	}
+	return( result );
+}
+
+/* Determines a lazily read value of the file entry if not already determined
+ * The value is determined while holding the write lock, after which it does not change
+ * until the file entry is freed, hence it can be accessed while holding the read lock
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_file_entry_determine_value(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     int value_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_file_entry_determine_value";
+	int result            = 0;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libfsapfs_internal_file_entry_is_value_determined(
+	          internal_file_entry,
+	          value_type,
+	          error );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if value: %d is determined.",
+		 function,
+		 value_type );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have determined the value in the meantime
+	 */
+	result = libfsapfs_internal_file_entry_is_value_determined(
+	          internal_file_entry,
+	          value_type,
+	          error );
+
+	if( result == 0 )
+	{
+		switch( value_type )
+		{
+			case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_SIZE:
+				result = libfsapfs_internal_file_entry_get_data_size(
+				          internal_file_entry,
+				          error );
+				break;
+
+			case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_STREAM:
+				result = libfsapfs_internal_file_entry_get_data_stream(
+				          internal_file_entry,
+				          error );
+				break;
+
+			case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DIRECTORY_ENTRIES:
+				result = libfsapfs_internal_file_entry_get_directory_entries(
+				          internal_file_entry,
+				          error );
+				break;
+
+			case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_EXTENDED_ATTRIBUTES:
+				result = libfsapfs_internal_file_entry_get_extended_attributes(
+				          internal_file_entry,
+				          error );
+				break;
+
+			case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_FILE_EXTENTS:
+				result = libfsapfs_internal_file_entry_get_file_extents(
+				          internal_file_entry,
+				          error );
+				break;
+
+			case LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_SYMBOLIC_LINK_DATA:
+				result = libfsapfs_internal_file_entry_get_symbolic_link_data(
+				          internal_file_entry,
+				          error );
+				break;
+		}
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine value: %d.",
+		 function,
+		 value_type );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
 /* Retrieves the identifier
  * This value is retrieved from the inode
  * Returns 1 if successful or -1 on error
@@ -521,7 +815,7 @@ int libfsapfs_file_entry_get_parent_file_entry(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -529,7 +823,7 @@ int libfsapfs_file_entry_get_parent_file_entry(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -607,7 +901,7 @@ int libfsapfs_file_entry_get_parent_file_entry(
 		result = 1;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -615,7 +909,7 @@ int libfsapfs_file_entry_get_parent_file_entry(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -631,7 +925,7 @@ on_error:
 		 NULL );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_file_entry->read_write_lock,
 	 NULL );
 #endif
@@ -2222,8 +2516,22 @@ int libfsapfs_file_entry_get_utf8_symbolic_link_target_size(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_SYMBOLIC_LINK_DATA,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine symbolic link data.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2231,28 +2539,12 @@ int libfsapfs_file_entry_get_utf8_symbolic_link_target_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->symbolic_link_data == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_symbolic_link_data(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine symbolic link data.",
-			 function );
-
-			goto on_error;
-		}
-	}
 	if( internal_file_entry->symbolic_link_data != NULL )
 	{
 		if( libuna_utf8_string_size_from_utf8_stream(
@@ -2273,7 +2565,7 @@ int libfsapfs_file_entry_get_utf8_symbolic_link_target_size(
 		result = 1;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2281,7 +2573,7 @@ int libfsapfs_file_entry_get_utf8_symbolic_link_target_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2291,7 +2583,7 @@ int libfsapfs_file_entry_get_utf8_symbolic_link_target_size(
 
 on_error:
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_file_entry->read_write_lock,
 	 NULL );
 #endif
@@ -2326,37 +2618,35 @@ int libfsapfs_file_entry_get_utf8_symbolic_link_target(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file_entry->read_write_lock,
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_SYMBOLIC_LINK_DATA,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine symbolic link data.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_file_entry->symbolic_link_data == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_symbolic_link_data(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine symbolic link data.",
-			 function );
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
+#endif
 	if( internal_file_entry->symbolic_link_data != NULL )
 	{
 		if( libuna_utf8_string_copy_from_utf8_stream(
@@ -2378,7 +2668,7 @@ int libfsapfs_file_entry_get_utf8_symbolic_link_target(
 		result = 1;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2386,7 +2676,7 @@ int libfsapfs_file_entry_get_utf8_symbolic_link_target(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2396,7 +2686,7 @@ int libfsapfs_file_entry_get_utf8_symbolic_link_target(
 
 on_error:
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_file_entry->read_write_lock,
 	 NULL );
 #endif
@@ -2430,8 +2720,22 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target_size(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_SYMBOLIC_LINK_DATA,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine symbolic link data.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2439,28 +2743,12 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->symbolic_link_data == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_symbolic_link_data(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine symbolic link data.",
-			 function );
-
-			goto on_error;
-		}
-	}
 	if( internal_file_entry->symbolic_link_data != NULL )
 	{
 		if( libuna_utf16_string_size_from_utf8_stream(
@@ -2481,7 +2769,7 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target_size(
 		result = 1;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2489,7 +2777,7 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2499,7 +2787,7 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target_size(
 
 on_error:
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_file_entry->read_write_lock,
 	 NULL );
 #endif
@@ -2534,8 +2822,22 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_SYMBOLIC_LINK_DATA,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine symbolic link data.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2543,28 +2845,12 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->symbolic_link_data == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_symbolic_link_data(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine symbolic link data.",
-			 function );
-
-			goto on_error;
-		}
-	}
 	if( internal_file_entry->symbolic_link_data != NULL )
 	{
 		if( libuna_utf16_string_copy_from_utf8_stream(
@@ -2586,7 +2872,7 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target(
 		result = 1;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2594,7 +2880,7 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2604,7 +2890,7 @@ int libfsapfs_file_entry_get_utf16_symbolic_link_target(
 
 on_error:
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_file_entry->read_write_lock,
 	 NULL );
 #endif
@@ -2636,8 +2922,22 @@ int libfsapfs_file_entry_get_number_of_extended_attributes(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_EXTENDED_ATTRIBUTES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine extended attributes.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2645,28 +2945,12 @@ int libfsapfs_file_entry_get_number_of_extended_attributes(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->extended_attributes_array == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_extended_attributes(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine extended attributes.",
-			 function );
-
-			result = -1;
-		}
-	}
 	if( internal_file_entry->extended_attributes_array != NULL )
 	{
 		if( libcdata_array_get_number_of_entries(
@@ -2685,7 +2969,7 @@ int libfsapfs_file_entry_get_number_of_extended_attributes(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2693,7 +2977,7 @@ int libfsapfs_file_entry_get_number_of_extended_attributes(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2751,8 +3035,22 @@ int libfsapfs_file_entry_get_extended_attribute_by_index(
 
 		return( -1 );
 	}
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_EXTENDED_ATTRIBUTES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine extended attributes.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2760,28 +3058,12 @@ int libfsapfs_file_entry_get_extended_attribute_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->extended_attributes_array == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_extended_attributes(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine extended attributes.",
-			 function );
-
-			result = -1;
-		}
-	}
 	if( internal_file_entry->extended_attributes_array != NULL )
 	{
 		if( libcdata_array_get_entry_by_index(
@@ -2824,7 +3106,7 @@ int libfsapfs_file_entry_get_extended_attribute_by_index(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2832,7 +3114,7 @@ int libfsapfs_file_entry_get_extended_attribute_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3078,8 +3360,22 @@ int libfsapfs_file_entry_has_extended_attribute_by_utf8_name(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_EXTENDED_ATTRIBUTES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine extended attributes.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3087,7 +3383,7 @@ int libfsapfs_file_entry_has_extended_attribute_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3112,7 +3408,7 @@ int libfsapfs_file_entry_has_extended_attribute_by_utf8_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3120,7 +3416,7 @@ int libfsapfs_file_entry_has_extended_attribute_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3156,8 +3452,22 @@ int libfsapfs_file_entry_has_extended_attribute_by_utf16_name(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_EXTENDED_ATTRIBUTES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine extended attributes.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3165,7 +3475,7 @@ int libfsapfs_file_entry_has_extended_attribute_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3190,7 +3500,7 @@ int libfsapfs_file_entry_has_extended_attribute_by_utf16_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3198,7 +3508,7 @@ int libfsapfs_file_entry_has_extended_attribute_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3257,8 +3567,22 @@ int libfsapfs_file_entry_get_extended_attribute_by_utf8_name(
 
 		return( -1 );
 	}
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_EXTENDED_ATTRIBUTES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine extended attributes.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3266,7 +3590,7 @@ int libfsapfs_file_entry_get_extended_attribute_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3313,7 +3637,7 @@ int libfsapfs_file_entry_get_extended_attribute_by_utf8_name(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3321,7 +3645,7 @@ int libfsapfs_file_entry_get_extended_attribute_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3380,8 +3704,22 @@ int libfsapfs_file_entry_get_extended_attribute_by_utf16_name(
 
 		return( -1 );
 	}
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_EXTENDED_ATTRIBUTES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine extended attributes.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3389,7 +3727,7 @@ int libfsapfs_file_entry_get_extended_attribute_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3436,7 +3774,7 @@ int libfsapfs_file_entry_get_extended_attribute_by_utf16_name(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3444,7 +3782,7 @@ int libfsapfs_file_entry_get_extended_attribute_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3571,8 +3909,22 @@ int libfsapfs_file_entry_get_number_of_sub_file_entries(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DIRECTORY_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine directory entries.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3580,47 +3932,31 @@ int libfsapfs_file_entry_get_number_of_sub_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->directory_entries == NULL )
+	if( result != -1 )
 	{
-		if( libfsapfs_internal_file_entry_get_directory_entries(
-		     internal_file_entry,
+		if( libcdata_array_get_number_of_entries(
+		     internal_file_entry->directory_entries,
+		     number_of_sub_file_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine directory entries.",
-			 function );
-
-			result = -1;
-		}
-	}
-	if( result != -1 )
-	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_file_entry->directory_entries,
-		     number_of_sub_file_entries,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from array.",
+			 "%s: unable to retrieve number of entries from array.",
 			 function );
 
 			result = -1;
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3628,7 +3964,7 @@ int libfsapfs_file_entry_get_number_of_sub_file_entries(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3688,8 +4024,22 @@ int libfsapfs_file_entry_get_sub_file_entry_by_index(
 
 		return( -1 );
 	}
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DIRECTORY_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine directory entries.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3697,28 +4047,12 @@ int libfsapfs_file_entry_get_sub_file_entry_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->directory_entries == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_directory_entries(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine directory entries.",
-			 function );
-
-			goto on_error;
-		}
-	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_file_entry->directory_entries,
 	     sub_file_entry_index,
@@ -3806,7 +4140,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_index(
 	directory_record_copy = NULL;
 
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3814,7 +4148,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		libfsapfs_file_entry_free(
@@ -3840,7 +4174,7 @@ on_error:
 		 NULL );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_file_entry->read_write_lock,
 	 NULL );
 #endif
@@ -3900,7 +4234,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3908,7 +4242,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3974,7 +4308,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3982,7 +4316,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf8_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		libfsapfs_file_entry_free(
@@ -4008,7 +4342,7 @@ on_error:
 		 NULL );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_file_entry->read_write_lock,
 	 NULL );
 #endif
@@ -4068,7 +4402,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf16_name(
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4076,7 +4410,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -4142,7 +4476,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf16_name(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -4150,7 +4484,7 @@ int libfsapfs_file_entry_get_sub_file_entry_by_utf16_name(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		libfsapfs_file_entry_free(
@@ -4176,7 +4510,7 @@ on_error:
 		 NULL );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	libcthreads_read_write_lock_release_for_write(
+	libcthreads_read_write_lock_release_for_read(
 	 internal_file_entry->read_write_lock,
 	 NULL );
 #endif
@@ -4276,19 +4610,23 @@ on_error:
 	return( -1 );
 }
 
-/* Determines the data stream
+/* Creates a data stream of the file entry
+ * Make sure the value data_stream is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libfsapfs_internal_file_entry_get_data_stream(
+int libfsapfs_internal_file_entry_initialize_data_stream(
      libfsapfs_internal_file_entry_t *internal_file_entry,
+     libfdata_stream_t **data_stream,
      libcerror_error_t **error )
 {
 	libfdata_stream_t *compressed_data_stream = NULL;
-	static char *function                     = "libfsapfs_internal_file_entry_get_data_stream";
+	static char *function                     = "libfsapfs_internal_file_entry_initialize_data_stream";
 	uint64_t data_stream_size                 = 0;
+	uint64_t identifier                       = 0;
 	uint64_t inode_flags                      = 0;
 	uint8_t is_sparse                         = 0;
 	int compression_method                    = 0;
+	int entry_index                           = 0;
 
 	if( internal_file_entry == NULL )
 	{
@@ -4312,13 +4650,24 @@ int libfsapfs_internal_file_entry_get_data_stream(
 
 		return( -1 );
 	}
-	if( internal_file_entry->data_stream != NULL )
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_stream != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file entry - data stream value already set.",
+		 "%s: invalid data stream value already set.",
 		 function );
 
 		return( -1 );
@@ -4374,7 +4723,8 @@ int libfsapfs_internal_file_entry_get_data_stream(
 				goto on_error;
 		}
 		if( ( internal_file_entry->compressed_data_header->compression_method == 4 )
-		 || ( internal_file_entry->compressed_data_header->compression_method == 8 ) )
+		 || ( internal_file_entry->compressed_data_header->compression_method == 8 )
+		 || ( internal_file_entry->compressed_data_header->compression_method == 12 ) )
 		{
 			if( libfsapfs_attributes_get_data_stream(
 			     internal_file_entry->resource_fork_attribute_values,
@@ -4418,11 +4768,28 @@ int libfsapfs_internal_file_entry_get_data_stream(
 				goto on_error;
 			}
 		}
+		if( libfsapfs_inode_get_identifier(
+		     internal_file_entry->inode,
+		     &identifier,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve identifier from inode.",
+			 function );
+
+			goto on_error;
+		}
 		if( libfsapfs_data_stream_initialize_from_compressed_data_stream(
-		     &( internal_file_entry->data_stream ),
+		     data_stream,
 		     compressed_data_stream,
 		     internal_file_entry->data_size,
 		     compression_method,
+		     internal_file_entry->io_handle,
+		     identifier,
+		     internal_file_entry->transaction_identifier,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -4434,6 +4801,41 @@ int libfsapfs_internal_file_entry_get_data_stream(
 
 			goto on_error;
 		}
+		/* The compressed data stream is not managed by the data stream
+		 */
+		if( internal_file_entry->compressed_data_streams == NULL )
+		{
+			if( libcdata_array_initialize(
+			     &( internal_file_entry->compressed_data_streams ),
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create compressed data streams array.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libcdata_array_append_entry(
+		     internal_file_entry->compressed_data_streams,
+		     &entry_index,
+		     (intptr_t *) compressed_data_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append compressed data stream to array.",
+			 function );
+
+			goto on_error;
+		}
+		compressed_data_stream = NULL;
 	}
 	else
 	{
@@ -4484,7 +4886,7 @@ int libfsapfs_internal_file_entry_get_data_stream(
 		is_sparse = (uint8_t) ( ( inode_flags & 0x00000200 ) != 0 );
 
 		if( libfsapfs_data_stream_initialize_from_file_extents(
-		     &( internal_file_entry->data_stream ),
+		     data_stream,
 		     internal_file_entry->io_handle,
 		     internal_file_entry->encryption_context,
 		     internal_file_entry->file_extents,
@@ -4505,29 +4907,31 @@ int libfsapfs_internal_file_entry_get_data_stream(
 	return( 1 );
 
 on_error:
-	if( internal_file_entry->data_stream != NULL )
+	if( *data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 data_stream,
+		 NULL );
+	}
+	if( compressed_data_stream != NULL )
 	{
 		libfdata_stream_free(
-		 &( internal_file_entry->data_stream ),
+		 &compressed_data_stream,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads data at the current offset into a buffer
- * Returns the number of bytes read or -1 on error
+/* Determines the data stream
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfsapfs_file_entry_read_buffer(
-         libfsapfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         libcerror_error_t **error )
+int libfsapfs_internal_file_entry_get_data_stream(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     libcerror_error_t **error )
 {
-	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsapfs_file_entry_read_buffer";
-	ssize_t read_count                                   = 0;
+	static char *function = "libfsapfs_internal_file_entry_get_data_stream";
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4538,94 +4942,49 @@ ssize_t libfsapfs_file_entry_read_buffer(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
-
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file_entry->read_write_lock,
-	     error ) != 1 )
+	if( internal_file_entry->data_stream != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file entry - data stream value already set.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	if( internal_file_entry->data_stream == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_data_stream(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
-			 function );
-
-			read_count = -1;
-		}
-	}
-	if( read_count != -1 )
-	{
-		read_count = libfdata_stream_read_buffer(
-		              internal_file_entry->data_stream,
-		              (intptr_t *) internal_file_entry->file_io_handle,
-		              (uint8_t *) buffer,
-		              buffer_size,
-		              0,
-		              error );
-
-		if( read_count < 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer from data stream.",
-			 function );
-
-			read_count = -1;
-		}
-	}
-#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file_entry->read_write_lock,
+	if( libfsapfs_internal_file_entry_initialize_data_stream(
+	     internal_file_entry,
+	     &( internal_file_entry->data_stream ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data stream.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-	return( read_count );
+	return( 1 );
 }
 
-/* Reads data at a specific offset
- * Returns the number of bytes read or -1 on error
+/* Grabs a data stream for a positional read
+ * The data stream is taken from the available positional data streams or created if none is available,
+ * it should be returned with libfsapfs_internal_file_entry_release_positional_data_stream
+ * Returns 1 if successful or -1 on error
  */
-ssize_t libfsapfs_file_entry_read_buffer_at_offset(
-         libfsapfs_file_entry_t *file_entry,
-         void *buffer,
-         size_t buffer_size,
-         off64_t offset,
-         libcerror_error_t **error )
+int libfsapfs_internal_file_entry_grab_positional_data_stream(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error )
 {
-	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
-	static char *function                                = "libfsapfs_file_entry_read_buffer_at_offset";
-	ssize_t read_count                                   = 0;
+	static char *function = "libfsapfs_internal_file_entry_grab_positional_data_stream";
+	int number_of_entries = 0;
+	int result            = 1;
 
-	if( file_entry == NULL )
+	if( internal_file_entry == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -4636,8 +4995,17 @@ ssize_t libfsapfs_file_entry_read_buffer_at_offset(
 
 		return( -1 );
 	}
-	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
 
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file_entry->read_write_lock,
@@ -4653,43 +5021,93 @@ ssize_t libfsapfs_file_entry_read_buffer_at_offset(
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->data_stream == NULL )
+	if( internal_file_entry->positional_data_streams != NULL )
 	{
-		if( libfsapfs_internal_file_entry_get_data_stream(
-		     internal_file_entry,
+		if( libcdata_array_get_number_of_entries(
+		     internal_file_entry->positional_data_streams,
+		     &number_of_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
+			 "%s: unable to retrieve number of positional data streams.",
 			 function );
 
-			read_count = -1;
+			result = -1;
 		}
 	}
-	if( read_count != -1 )
+	if( result != -1 )
 	{
-		read_count = libfdata_stream_read_buffer_at_offset(
-		              internal_file_entry->data_stream,
-		              (intptr_t *) internal_file_entry->file_io_handle,
-		              (uint8_t *) buffer,
-		              buffer_size,
-		              offset,
-		              0,
-		              error );
+		if( number_of_entries > 0 )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_file_entry->positional_data_streams,
+			     number_of_entries - 1,
+			     (intptr_t **) data_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve positional data stream: %d.",
+				 function,
+				 number_of_entries - 1 );
+
+				result = -1;
+			}
+			else if( libcdata_array_set_entry_by_index(
+			          internal_file_entry->positional_data_streams,
+			          number_of_entries - 1,
+			          NULL,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set positional data stream: %d.",
+				 function,
+				 number_of_entries - 1 );
+
+				*data_stream = NULL;
+				result       = -1;
+			}
+			else if( libcdata_array_resize(
+			          internal_file_entry->positional_data_streams,
+			          number_of_entries - 1,
+			          (int (*)(intptr_t **, libcerror_error_t **)) &libfdata_stream_free,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize positional data streams array.",
+				 function );
+
+				libfdata_stream_free(
+				 data_stream,
+				 NULL );
 
-		if( read_count < 0 )
+				result = -1;
+			}
+		}
+		else if( libfsapfs_internal_file_entry_initialize_data_stream(
+		          internal_file_entry,
+		          data_stream,
+		          error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read buffer at offset from data stream.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create positional data stream.",
 			 function );
 
-			read_count = -1;
+			result = -1;
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
@@ -4704,10 +5122,329 @@ ssize_t libfsapfs_file_entry_read_buffer_at_offset(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
+		if( *data_stream != NULL )
+		{
+			libfdata_stream_free(
+			 data_stream,
+			 NULL );
+		}
 		return( -1 );
 	}
 #endif
-	return( read_count );
+	return( result );
+}
+
+/* Releases a data stream used for a positional read
+ * The data stream is made available for subsequent positional reads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_internal_file_entry_release_positional_data_stream(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_internal_file_entry_release_positional_data_stream";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( internal_file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data_stream == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		libfdata_stream_free(
+		 data_stream,
+		 NULL );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file_entry->positional_data_streams == NULL )
+	{
+		if( libcdata_array_initialize(
+		     &( internal_file_entry->positional_data_streams ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create positional data streams array.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result != -1 )
+	{
+		if( libcdata_array_append_entry(
+		     internal_file_entry->positional_data_streams,
+		     &entry_index,
+		     (intptr_t *) *data_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append positional data stream to array.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			*data_stream = NULL;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( *data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 data_stream,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Reads data at the current offset into a buffer
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsapfs_file_entry_read_buffer(
+         libfsapfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsapfs_file_entry_read_buffer";
+	ssize_t read_count                                   = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
+
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_STREAM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data stream.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file_entry->data_stream_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	read_count = libfdata_stream_read_buffer(
+	              internal_file_entry->data_stream,
+	              (intptr_t *) internal_file_entry->file_io_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer from data stream.",
+		 function );
+
+		read_count = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file_entry->data_stream_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( read_count );
+}
+
+/* Reads data at a specific offset
+ * This function does not change the current offset and can be called concurrently
+ * Returns the number of bytes read or -1 on error
+ */
+ssize_t libfsapfs_file_entry_read_buffer_at_offset(
+         libfsapfs_file_entry_t *file_entry,
+         void *buffer,
+         size_t buffer_size,
+         off64_t offset,
+         libcerror_error_t **error )
+{
+	libfdata_stream_t *data_stream                       = NULL;
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsapfs_file_entry_read_buffer_at_offset";
+	ssize_t read_count                                   = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
+
+	/* Determining the data stream also determines the values needed to create a positional data stream
+	 */
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_STREAM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_file_entry_grab_positional_data_stream(
+	     internal_file_entry,
+	     &data_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab positional data stream.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libfdata_stream_read_buffer_at_offset(
+	              data_stream,
+	              (intptr_t *) internal_file_entry->file_io_handle,
+	              (uint8_t *) buffer,
+	              buffer_size,
+	              offset,
+	              0,
+	              error );
+
+	if( read_count < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read buffer at offset from data stream.",
+		 function );
+
+		libfdata_stream_free(
+		 &data_stream,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_file_entry_release_positional_data_stream(
+	     internal_file_entry,
+	     &data_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release positional data stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( read_count );
 }
 
 /* Seeks a certain offset
@@ -4736,9 +5473,23 @@ off64_t libfsapfs_file_entry_seek_offset(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_STREAM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data stream.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file_entry->read_write_lock,
+	     internal_file_entry->data_stream_read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4751,22 +5502,6 @@ off64_t libfsapfs_file_entry_seek_offset(
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->data_stream == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_data_stream(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
-			 function );
-
-			result_offset = -1;
-		}
-	}
 	if( result_offset != -1 )
 	{
 		result_offset = libfdata_stream_seek_offset(
@@ -4789,7 +5524,7 @@ off64_t libfsapfs_file_entry_seek_offset(
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file_entry->read_write_lock,
+	     internal_file_entry->data_stream_read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4830,9 +5565,23 @@ int libfsapfs_file_entry_get_offset(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_STREAM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data stream.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file_entry->read_write_lock,
+	     internal_file_entry->data_stream_read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -4845,22 +5594,6 @@ int libfsapfs_file_entry_get_offset(
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->data_stream == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_data_stream(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data stream.",
-			 function );
-
-			result = -1;
-		}
-	}
 	if( result != -1 )
 	{
 		if( libfdata_stream_get_offset(
@@ -4880,7 +5613,7 @@ int libfsapfs_file_entry_get_offset(
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file_entry->read_write_lock,
+	     internal_file_entry->data_stream_read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -5132,15 +5865,29 @@ int libfsapfs_file_entry_get_size(
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data size.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5148,34 +5895,18 @@ int libfsapfs_file_entry_get_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->data_size == (size64_t) -1 )
-	{
-		if( libfsapfs_internal_file_entry_get_data_size(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine data size.",
-			 function );
-
-			result = -1;
-		}
-	}
 	if( result != -1 )
 	{
 		*size = internal_file_entry->data_size;
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5183,7 +5914,7 @@ int libfsapfs_file_entry_get_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -5217,8 +5948,22 @@ int libfsapfs_file_entry_get_number_of_extents(
 	}
 	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
 
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_FILE_EXTENTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file extents.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5226,28 +5971,12 @@ int libfsapfs_file_entry_get_number_of_extents(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->file_extents == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_file_extents(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine file extents.",
-			 function );
-
-			result = -1;
-		}
-	}
 	if( result != -1 )
 	{
 		if( libcdata_array_get_number_of_entries(
@@ -5266,7 +5995,7 @@ int libfsapfs_file_entry_get_number_of_extents(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5274,7 +6003,7 @@ int libfsapfs_file_entry_get_number_of_extents(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -5356,8 +6085,22 @@ int libfsapfs_file_entry_get_extent_by_index(
 
 		return( -1 );
 	}
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_FILE_EXTENTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file extents.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5365,28 +6108,12 @@ int libfsapfs_file_entry_get_extent_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_file_entry->file_extents == NULL )
-	{
-		if( libfsapfs_internal_file_entry_get_file_extents(
-		     internal_file_entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine file extents.",
-			 function );
-
-			result = -1;
-		}
-	}
 	if( result != -1 )
 	{
 		if( libcdata_array_get_entry_by_index(
@@ -5425,7 +6152,7 @@ int libfsapfs_file_entry_get_extent_by_index(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file_entry->read_write_lock,
 	     error ) != 1 )
 	{
@@ -5433,7 +6160,250 @@ int libfsapfs_file_entry_get_extent_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the next range of stored data at or after a specific offset
+ * Sparse file extents and gaps between file extents are considered holes
+ * The data of a compressed file entry is considered to be a single range
+ * Returns 1 if successful, 0 if there is no data at or after the offset or -1 on error
+ */
+int libfsapfs_file_entry_get_next_data_range(
+     libfsapfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_file_extent_t *file_extent                 = NULL;
+	libfsapfs_internal_file_entry_t *internal_file_entry = NULL;
+	static char *function                                = "libfsapfs_file_entry_get_next_data_range";
+	uint64_t extent_end_offset                           = 0;
+	uint64_t range_end_offset                            = 0;
+	uint64_t range_start_offset                          = 0;
+	int extent_index                                     = 0;
+	int number_of_extents                                = 0;
+	int result                                           = 0;
+
+	if( file_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file_entry = (libfsapfs_internal_file_entry_t *) file_entry;
+
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid range size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_DATA_SIZE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_file_entry_determine_value(
+	     internal_file_entry,
+	     LIBFSAPFS_FILE_ENTRY_VALUE_TYPE_FILE_EXTENTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file extents.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( (size64_t) offset >= internal_file_entry->data_size )
+	{
+		result = 0;
+	}
+	else if( internal_file_entry->compressed_data_header != NULL )
+	{
+		range_start_offset = (uint64_t) offset;
+		range_end_offset   = (uint64_t) internal_file_entry->data_size;
+
+		result = 1;
+	}
+	else if( libcdata_array_get_number_of_entries(
+	          internal_file_entry->file_extents,
+	          &number_of_extents,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file extents.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		for( extent_index = 0;
+		     extent_index < number_of_extents;
+		     extent_index++ )
+		{
+			if( libcdata_array_get_entry_by_index(
+			     internal_file_entry->file_extents,
+			     extent_index,
+			     (intptr_t **) &file_extent,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve file extent: %d.",
+				 function,
+				 extent_index );
+
+				result = -1;
+
+				break;
+			}
+			if( file_extent == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing file extent: %d.",
+				 function,
+				 extent_index );
+
+				result = -1;
+
+				break;
+			}
+			extent_end_offset = file_extent->logical_offset + file_extent->data_size;
+
+			/* Sparse file extents are holes
+			 */
+			if( ( file_extent->physical_block_number == 0 )
+			 || ( extent_end_offset <= (uint64_t) offset ) )
+			{
+				if( result != 0 )
+				{
+					break;
+				}
+				continue;
+			}
+			if( result == 0 )
+			{
+				range_start_offset = file_extent->logical_offset;
+
+				if( range_start_offset < (uint64_t) offset )
+				{
+					range_start_offset = (uint64_t) offset;
+				}
+				range_end_offset = extent_end_offset;
+
+				result = 1;
+			}
+			/* Logically contiguous file extents are merged into a single range
+			 */
+			else if( file_extent->logical_offset == range_end_offset )
+			{
+				range_end_offset = extent_end_offset;
+			}
+			else
+			{
+				break;
+			}
+		}
+		if( range_end_offset > (uint64_t) internal_file_entry->data_size )
+		{
+			range_end_offset = (uint64_t) internal_file_entry->data_size;
+		}
+		if( ( result == 1 )
+		 && ( range_start_offset >= range_end_offset ) )
+		{
+			result = 0;
+		}
+	}
+	if( result == 1 )
+	{
+		*range_offset = (off64_t) range_start_offset;
+		*range_size   = (size64_t) ( range_end_offset - range_start_offset );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file_entry->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
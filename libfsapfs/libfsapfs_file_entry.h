@@ -119,10 +119,22 @@ struct libfsapfs_internal_file_entry
 	 */
 	libfdata_stream_t *data_stream;
 
+	/* The data streams available for positional reads
+	 */
+	libcdata_array_t *positional_data_streams;
+
+	/* The compressed data streams used by the data streams
+	 */
+	libcdata_array_t *compressed_data_streams;
+
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The data stream read/write lock
+	 */
+	libcthreads_read_write_lock_t *data_stream_read_write_lock;
 #endif
 };
 
@@ -142,6 +154,16 @@ int libfsapfs_file_entry_free(
      libfsapfs_file_entry_t **file_entry,
      libcerror_error_t **error );
 
+int libfsapfs_internal_file_entry_is_value_determined(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     int value_type,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_file_entry_determine_value(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     int value_type,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_file_entry_get_identifier(
      libfsapfs_file_entry_t *file_entry,
@@ -381,10 +403,25 @@ int libfsapfs_internal_file_entry_get_file_extents(
      libfsapfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error );
 
+int libfsapfs_internal_file_entry_initialize_data_stream(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error );
+
 int libfsapfs_internal_file_entry_get_data_stream(
      libfsapfs_internal_file_entry_t *internal_file_entry,
      libcerror_error_t **error );
 
+int libfsapfs_internal_file_entry_grab_positional_data_stream(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error );
+
+int libfsapfs_internal_file_entry_release_positional_data_stream(
+     libfsapfs_internal_file_entry_t *internal_file_entry,
+     libfdata_stream_t **data_stream,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 ssize_t libfsapfs_file_entry_read_buffer(
          libfsapfs_file_entry_t *file_entry,
@@ -438,6 +475,14 @@ int libfsapfs_file_entry_get_extent_by_index(
      uint32_t *extent_flags,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_file_entry_get_next_data_range(
+     libfsapfs_file_entry_t *file_entry,
+     off64_t offset,
+     off64_t *range_offset,
+     size64_t *range_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -25,9 +25,9 @@
 #include <types.h>
 
 #include "libfsapfs_attribute_values.h"
+#include "libfsapfs_block_reader.h"
 #include "libfsapfs_btree_entry.h"
 #include "libfsapfs_btree_node.h"
-#include "libfsapfs_data_block.h"
 #include "libfsapfs_debug.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_directory_record.h"
@@ -40,12 +40,10 @@
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
-#include "libfsapfs_libfcache.h"
-#include "libfsapfs_libfdata.h"
+#include "libfsapfs_node_cache.h"
 #include "libfsapfs_libuna.h"
 #include "libfsapfs_name_hash.h"
 #include "libfsapfs_object_map_btree.h"
-#include "libfsapfs_object_map_descriptor.h"
 
 #include "fsapfs_file_system.h"
 #include "fsapfs_object.h"
@@ -58,7 +56,6 @@ int libfsapfs_file_system_btree_initialize(
      libfsapfs_file_system_btree_t **file_system_btree,
      libfsapfs_io_handle_t *io_handle,
      libfsapfs_encryption_context_t *encryption_context,
-     libfdata_vector_t *data_block_vector,
      libfsapfs_object_map_btree_t *object_map_btree,
      uint64_t root_node_block_number,
      uint8_t use_case_folding,
@@ -88,6 +85,17 @@ int libfsapfs_file_system_btree_initialize(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	*file_system_btree = memory_allocate_structure(
 	                      libfsapfs_file_system_btree_t );
 
@@ -121,23 +129,26 @@ int libfsapfs_file_system_btree_initialize(
 
 		return( -1 );
 	}
-	if( libfcache_cache_initialize(
-	     &( ( *file_system_btree )->data_block_cache ),
-	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS,
+	if( libfsapfs_io_handle_reserve_cache_entries(
+	     io_handle,
+	     LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	     &( ( *file_system_btree )->number_of_cache_entries ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data block cache.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to reserve node cache entries.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( libfsapfs_node_cache_initialize(
 	     &( ( *file_system_btree )->node_cache ),
-	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES,
+	     ( *file_system_btree )->number_of_cache_entries,
+	     io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES - 1 ],
+	     (size64_t) io_handle->block_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -151,7 +162,6 @@ int libfsapfs_file_system_btree_initialize(
 	}
 	( *file_system_btree )->io_handle              = io_handle;
 	( *file_system_btree )->encryption_context     = encryption_context;
-	( *file_system_btree )->data_block_vector      = data_block_vector;
 	( *file_system_btree )->object_map_btree       = object_map_btree;
 	( *file_system_btree )->root_node_block_number = root_node_block_number;
 	( *file_system_btree )->use_case_folding       = use_case_folding;
@@ -161,6 +171,14 @@ int libfsapfs_file_system_btree_initialize(
 on_error:
 	if( *file_system_btree != NULL )
 	{
+		if( ( *file_system_btree )->number_of_cache_entries > 0 )
+		{
+			libfsapfs_io_handle_release_cache_entries(
+			 io_handle,
+			 LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+			 ( *file_system_btree )->number_of_cache_entries,
+			 NULL );
+		}
 		memory_free(
 		 *file_system_btree );
 
@@ -192,9 +210,9 @@ int libfsapfs_file_system_btree_free(
 	}
 	if( *file_system_btree != NULL )
 	{
-		/* The io_handle, data_block_vector and object_map_btree are referenced and freed elsewhere
+		/* The io_handle, encryption_context and object_map_btree are referenced and freed elsewhere
 		 */
-		if( libfcache_cache_free(
+		if( libfsapfs_node_cache_free(
 		     &( ( *file_system_btree )->node_cache ),
 		     error ) != 1 )
 		{
@@ -207,15 +225,17 @@ int libfsapfs_file_system_btree_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
-		     &( ( *file_system_btree )->data_block_cache ),
+		if( libfsapfs_io_handle_release_cache_entries(
+		     ( *file_system_btree )->io_handle,
+		     LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+		     ( *file_system_btree )->number_of_cache_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data block cache.",
+			 "%s: unable to release node cache entries.",
 			 function );
 
 			result = -1;
@@ -239,10 +259,9 @@ int libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
      uint64_t *sub_node_block_number,
      libcerror_error_t **error )
 {
-	libfsapfs_object_map_descriptor_t *object_map_descriptor = NULL;
-	static char *function                                    = "libfsapfs_file_system_btree_get_sub_node_block_number_from_entry";
-	uint64_t sub_node_object_identifier                      = 0;
-	int result                                               = 0;
+	static char *function               = "libfsapfs_file_system_btree_get_sub_node_block_number_from_entry";
+	uint64_t sub_node_object_identifier = 0;
+	int result                          = 0;
 
 	if( file_system_btree == NULL )
 	{
@@ -313,12 +332,12 @@ int libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
 		 transaction_identifier );
 	}
 #endif
-	result = libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
+	result = libfsapfs_object_map_btree_get_physical_address_by_object_identifier(
 	          file_system_btree->object_map_btree,
 	          file_io_handle,
 	          sub_node_object_identifier,
 	          transaction_identifier,
-	          &object_map_descriptor,
+	          sub_node_block_number,
 	          error );
 
 	if( result == -1 )
@@ -327,64 +346,30 @@ int libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve object map descriptor for sub node object identifier: %" PRIu64 " (transaction: %" PRIu64 ").",
+		 "%s: unable to retrieve physical address for sub node object identifier: %" PRIu64 " (transaction: %" PRIu64 ").",
 		 function,
 		 sub_node_object_identifier,
 		 transaction_identifier );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
-	{
-		if( object_map_descriptor == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid object map descriptor.",
-			 function );
-
-			goto on_error;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	if( libcnotify_verbose != 0 )
+	{
+		if( result != 0 )
 		{
 			libcnotify_printf(
 			 "%s: sub node block number: %" PRIu64 "\n",
 			 function,
-			 object_map_descriptor->physical_address );
-		}
-#endif
-		*sub_node_block_number = object_map_descriptor->physical_address;
-
-		if( libfsapfs_object_map_descriptor_free(
-		     &object_map_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free object map descriptor.",
-			 function );
-
-			goto on_error;
+			 *sub_node_block_number );
 		}
 	}
+#endif
 	return( result );
-
-on_error:
-	if( object_map_descriptor != NULL )
-	{
-		libfsapfs_object_map_descriptor_free(
-		 &object_map_descriptor,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves the file system B-tree root node
+ * The node is referenced and must be released with libfsapfs_node_cache_release_node
  * Returns 1 if successful, 0 if not available or -1 on error
  */
 int libfsapfs_file_system_btree_get_root_node(
@@ -394,14 +379,13 @@ int libfsapfs_file_system_btree_get_root_node(
      libfsapfs_btree_node_t **root_node,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	libfsapfs_btree_node_t *node         = NULL;
-	libfsapfs_data_block_t *data_block   = NULL;
-	static char *function                = "libfsapfs_file_system_btree_get_root_node";
-	int result                           = 0;
+	libfsapfs_btree_node_t *cached_node = NULL;
+	libfsapfs_btree_node_t *node        = NULL;
+	static char *function               = "libfsapfs_file_system_btree_get_root_node";
+	int result                          = 0;
 
 #if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
+	int64_t profiler_start_timestamp    = 0;
 #endif
 
 	if( file_system_btree == NULL )
@@ -426,17 +410,6 @@ int libfsapfs_file_system_btree_get_root_node(
 
 		return( -1 );
 	}
-	if( root_node_block_number > (uint64_t) INT_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid root node block number value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( root_node == NULL )
 	{
 		libcerror_error_set(
@@ -468,12 +441,10 @@ int libfsapfs_file_system_btree_get_root_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	result = libfcache_cache_get_value_by_identifier(
+	result = libfsapfs_node_cache_get_node(
 	          file_system_btree->node_cache,
-	          0,
-	          (off64_t) root_node_block_number,
-	          0,
-	          &cache_value,
+	          root_node_block_number,
+	          &cached_node,
 	          error );
 
 	if( result == -1 )
@@ -482,44 +453,13 @@ int libfsapfs_file_system_btree_get_root_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from cache.",
+		 "%s: unable to retrieve node from cache.",
 		 function );
 
 		goto on_error;
 	}
 	else if( result == 0 )
 	{
-		if( libfdata_vector_get_element_value_by_index(
-		     file_system_btree->data_block_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) file_system_btree->data_block_cache,
-		     (int) root_node_block_number,
-		     (intptr_t **) &data_block,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data block: %" PRIu64 ".",
-			 function,
-			 root_node_block_number );
-
-			goto on_error;
-		}
-		if( data_block == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data block: %" PRIu64 ".",
-			 function,
-			 root_node_block_number );
-
-			goto on_error;
-		}
 		if( libfsapfs_btree_node_initialize(
 		     &node,
 		     error ) != 1 )
@@ -533,10 +473,12 @@ int libfsapfs_file_system_btree_get_root_node(
 
 			goto on_error;
 		}
-		if( libfsapfs_btree_node_read_data(
+		if( libfsapfs_btree_node_read_file_io_handle(
 		     node,
-		     data_block->data,
-		     data_block->data_size,
+		     file_system_btree->io_handle,
+		     file_system_btree->encryption_context,
+		     file_io_handle,
+		     root_node_block_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -636,44 +578,22 @@ int libfsapfs_file_system_btree_get_root_node(
 
 			goto on_error;
 		}
-		if( libfcache_cache_set_value_by_identifier(
+		if( libfsapfs_node_cache_insert_node(
 		     file_system_btree->node_cache,
-		     0,
-		     (off64_t) root_node_block_number,
-		     0,
-		     (intptr_t *) node,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
-		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     &node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value in cache.",
-			 function );
-
-			goto on_error;
-		}
-		node = NULL;
-
-		if( libfcache_cache_get_value_by_identifier(
-		     file_system_btree->node_cache,
-		     0,
-		     (off64_t) root_node_block_number,
-		     0,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from cache.",
+			 "%s: unable to insert node into cache.",
 			 function );
 
 			goto on_error;
 		}
+		cached_node = node;
+		node        = NULL;
 	}
 #if defined( HAVE_PROFILER )
 	if( file_system_btree->io_handle->profiler != NULL )
@@ -698,23 +618,18 @@ int libfsapfs_file_system_btree_get_root_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	if( libfcache_cache_value_get_value(
-	     cache_value,
-	     (intptr_t **) root_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root node.",
-		 function );
+	*root_node = cached_node;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
+	if( cached_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &cached_node,
+		 NULL );
+	}
 	if( node != NULL )
 	{
 		libfsapfs_btree_node_free(
@@ -725,6 +640,7 @@ on_error:
 }
 
 /* Retrieves a file system B-tree sub node
+ * The node is referenced and must be released with libfsapfs_node_cache_release_node
  * Returns 1 if successful or -1 on error
  */
 int libfsapfs_file_system_btree_get_sub_node(
@@ -734,14 +650,13 @@ int libfsapfs_file_system_btree_get_sub_node(
      libfsapfs_btree_node_t **sub_node,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	libfsapfs_btree_node_t *node         = NULL;
-	libfsapfs_data_block_t *data_block   = NULL;
-	static char *function                = "libfsapfs_file_system_btree_get_sub_node";
-	int result                           = 0;
+	libfsapfs_btree_node_t *cached_node = NULL;
+	libfsapfs_btree_node_t *node        = NULL;
+	static char *function               = "libfsapfs_file_system_btree_get_sub_node";
+	int result                          = 0;
 
 #if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
+	int64_t profiler_start_timestamp    = 0;
 #endif
 
 	if( file_system_btree == NULL )
@@ -766,17 +681,6 @@ int libfsapfs_file_system_btree_get_sub_node(
 
 		return( -1 );
 	}
-	if( sub_node_block_number > (uint64_t) INT_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sub node block number value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( sub_node == NULL )
 	{
 		libcerror_error_set(
@@ -808,12 +712,10 @@ int libfsapfs_file_system_btree_get_sub_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	result = libfcache_cache_get_value_by_identifier(
+	result = libfsapfs_node_cache_get_node(
 	          file_system_btree->node_cache,
-	          0,
-	          (off64_t) sub_node_block_number,
-	          0,
-	          &cache_value,
+	          sub_node_block_number,
+	          &cached_node,
 	          error );
 
 	if( result == -1 )
@@ -822,44 +724,13 @@ int libfsapfs_file_system_btree_get_sub_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from cache.",
+		 "%s: unable to retrieve node from cache.",
 		 function );
 
 		goto on_error;
 	}
 	else if( result == 0 )
 	{
-		if( libfdata_vector_get_element_value_by_index(
-		     file_system_btree->data_block_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) file_system_btree->data_block_cache,
-		     (int) sub_node_block_number,
-		     (intptr_t **) &data_block,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data block: %" PRIu64 ".",
-			 function,
-			 sub_node_block_number );
-
-			goto on_error;
-		}
-		if( data_block == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data block: %" PRIu64 ".",
-			 function,
-			 sub_node_block_number );
-
-			goto on_error;
-		}
 		if( libfsapfs_btree_node_initialize(
 		     &node,
 		     error ) != 1 )
@@ -873,10 +744,12 @@ int libfsapfs_file_system_btree_get_sub_node(
 
 			goto on_error;
 		}
-		if( libfsapfs_btree_node_read_data(
+		if( libfsapfs_btree_node_read_file_io_handle(
 		     node,
-		     data_block->data,
-		     data_block->data_size,
+		     file_system_btree->io_handle,
+		     file_system_btree->encryption_context,
+		     file_io_handle,
+		     sub_node_block_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -926,44 +799,22 @@ int libfsapfs_file_system_btree_get_sub_node(
 
 			goto on_error;
 		}
-		if( libfcache_cache_set_value_by_identifier(
+		if( libfsapfs_node_cache_insert_node(
 		     file_system_btree->node_cache,
-		     0,
-		     (off64_t) sub_node_block_number,
-		     0,
-		     (intptr_t *) node,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
-		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     &node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value in cache.",
-			 function );
-
-			goto on_error;
-		}
-		node = NULL;
-
-		if( libfcache_cache_get_value_by_identifier(
-		     file_system_btree->node_cache,
-		     0,
-		     (off64_t) sub_node_block_number,
-		     0,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from cache.",
+			 "%s: unable to insert node into cache.",
 			 function );
 
 			goto on_error;
 		}
+		cached_node = node;
+		node        = NULL;
 	}
 #if defined( HAVE_PROFILER )
 	if( file_system_btree->io_handle->profiler != NULL )
@@ -988,23 +839,18 @@ int libfsapfs_file_system_btree_get_sub_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	if( libfcache_cache_value_get_value(
-	     cache_value,
-	     (intptr_t **) sub_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub node.",
-		 function );
+	*sub_node = cached_node;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
+	if( cached_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &cached_node,
+		 NULL );
+	}
 	if( node != NULL )
 	{
 		libfsapfs_btree_node_free(
@@ -1014,26 +860,36 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves an entry for a specific identifier from the file system B-tree node
- * Returns 1 if successful, 0 if not found or -1 on error
+/* Reads the sub nodes of a file system B-tree branch node that can contain a specific identifier
+ * The sub nodes that are not yet cached are read at once and inserted into the node cache
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
+int libfsapfs_file_system_btree_read_sub_nodes_by_identifier(
      libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
      libfsapfs_btree_node_t *node,
      uint64_t identifier,
-     uint8_t data_type,
-     libfsapfs_btree_entry_t **btree_entry,
+     uint64_t transaction_identifier,
      libcerror_error_t **error )
 {
+	uint64_t sub_node_block_numbers[ LIBFSAPFS_MAXIMUM_NUMBER_OF_BATCHED_BTREE_NODES ];
+
+	libfsapfs_block_reader_t *block_reader  = NULL;
 	libfsapfs_btree_entry_t *entry          = NULL;
-	libfsapfs_btree_entry_t *previous_entry = NULL;
-	static char *function                   = "libfsapfs_file_system_btree_get_entry_from_node_by_identifier";
+	libfsapfs_btree_node_t *cached_node     = NULL;
+	libfsapfs_btree_node_t *sub_node        = NULL;
+	uint8_t *sub_nodes_data                 = NULL;
+	static char *function                   = "libfsapfs_file_system_btree_read_sub_nodes_by_identifier";
 	uint64_t file_system_identifier         = 0;
-	uint64_t lookup_identifier              = 0;
-	uint8_t file_system_data_type           = 0;
-	int btree_entry_index                   = 0;
-	int is_leaf_node                        = 0;
+	uint64_t maximum_block_number           = 0;
+	uint64_t sub_node_block_number          = 0;
+	int entry_index                         = 0;
+	int first_entry_index                   = 0;
+	int last_entry_index                    = -1;
 	int number_of_entries                   = 0;
+	int number_of_sub_nodes                 = 0;
+	int result                              = 0;
+	int sub_node_index                      = 0;
 
 	if( file_system_btree == NULL )
 	{
@@ -1046,55 +902,47 @@ int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
 
 		return( -1 );
 	}
-	if( node == NULL )
+	if( file_system_btree->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid node.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system B-tree entry - missing IO handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( btree_entry == NULL )
+	if( file_system_btree->io_handle->block_size == 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid B-tree entry.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system B-tree entry - invalid IO handle - missing block size.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: retrieving B-tree entry identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
-		 function,
-		 identifier,
-		 data_type,
-		 libfsapfs_debug_print_file_system_data_type(
-		  data_type ) );
-	}
-#endif
-	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
-	                node,
-	                error );
-
-	if( is_leaf_node == -1 )
+	if( node == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine if B-tree node is a leaf node.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
 		 function );
 
 		return( -1 );
 	}
+	/* Memory mapped sub nodes reference the mapped data and are not copied
+	 * hence batching the reads provides no benefit
+	 */
+	if( ( file_system_btree->io_handle->mapped_file != NULL )
+	 && ( file_system_btree->encryption_context == NULL ) )
+	{
+		return( 1 );
+	}
 	if( libfsapfs_btree_node_get_number_of_entries(
 	     node,
 	     &number_of_entries,
@@ -1107,17 +955,19 @@ int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
 		 "%s: unable to retrieve number of entries from B-tree node.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	lookup_identifier = ( (uint64_t) data_type << 60 ) | identifier;
-
-	for( btree_entry_index = 0;
-	     btree_entry_index < number_of_entries;
-	     btree_entry_index++ )
+	/* The records of the identifier can start in the sub node of the last entry
+	 * with a smaller identifier and continue up to the sub node of the last entry
+	 * with the identifier
+	 */
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
 	{
 		if( libfsapfs_btree_node_get_entry_by_index(
 		     node,
-		     btree_entry_index,
+		     entry_index,
 		     &entry,
 		     error ) != 1 )
 		{
@@ -1125,12 +975,15 @@ int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from B-tree node.",
-			 function );
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 entry_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( entry == NULL )
+		if( ( entry == NULL )
+		 || ( entry->key_data == NULL )
+		 || ( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -1138,91 +991,640 @@ int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
 			 "%s: invalid B-tree entry: %d.",
 			 function,
-			 btree_entry_index );
+			 entry_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( entry->key_data == NULL )
-		{
-			libcerror_error_set(
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_file_system_btree_key_common_t *) entry->key_data )->file_system_identifier,
+		 file_system_identifier );
+
+		file_system_identifier &= 0x0fffffffffffffffUL;
+
+		if( file_system_identifier > identifier )
+		{
+			break;
+		}
+		if( file_system_identifier < identifier )
+		{
+			first_entry_index = entry_index;
+		}
+		last_entry_index = entry_index;
+	}
+	if( ( last_entry_index - first_entry_index + 1 ) > LIBFSAPFS_MAXIMUM_NUMBER_OF_BATCHED_BTREE_NODES )
+	{
+		last_entry_index = first_entry_index + LIBFSAPFS_MAXIMUM_NUMBER_OF_BATCHED_BTREE_NODES - 1;
+	}
+	/* A single sub node is read on demand
+	 */
+	if( ( last_entry_index - first_entry_index ) < 1 )
+	{
+		return( 1 );
+	}
+	maximum_block_number = (uint64_t) ( file_system_btree->io_handle->container_size / file_system_btree->io_handle->block_size );
+
+	for( entry_index = first_entry_index;
+	     entry_index <= last_entry_index;
+	     entry_index++ )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     entry_index,
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d - missing key data.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
 			 function,
-			 btree_entry_index );
+			 entry_index );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( entry->key_data_size < 8 )
+		result = libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
+		          file_system_btree,
+		          file_io_handle,
+		          entry,
+		          transaction_identifier,
+		          &sub_node_block_number,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
-			 function,
-			 btree_entry_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine sub node block number.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		byte_stream_copy_to_uint64_little_endian(
-		 entry->key_data,
-		 file_system_identifier );
-
-		file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
+		else if( ( result == 0 )
+		      || ( sub_node_block_number >= maximum_block_number ) )
+		{
+			continue;
+		}
+		result = libfsapfs_node_cache_get_node(
+		          file_system_btree->node_cache,
+		          sub_node_block_number,
+		          &cached_node,
+		          error );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( result == -1 )
 		{
-			libcnotify_printf(
-			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
-			 function,
-			 btree_entry_index,
-			 file_system_identifier & 0x0fffffffffffffffUL,
-			 file_system_data_type,
-			 libfsapfs_debug_print_file_system_data_type(
-			  file_system_data_type ) );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve node from cache.",
+			 function );
+
+			goto on_error;
 		}
-#endif
-		if( is_leaf_node != 0 )
+		else if( result != 0 )
 		{
-			if( file_system_identifier == lookup_identifier )
+			if( libfsapfs_node_cache_release_node(
+			     file_system_btree->node_cache,
+			     &cached_node,
+			     error ) != 1 )
 			{
-				*btree_entry = entry;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release B-tree node.",
+				 function );
 
-				return( 1 );
+				goto on_error;
 			}
+			continue;
 		}
-		else
+		sub_node_block_numbers[ number_of_sub_nodes++ ] = sub_node_block_number;
+	}
+	if( number_of_sub_nodes < 2 )
+	{
+		return( 1 );
+	}
+	sub_nodes_data = (uint8_t *) memory_allocate(
+	                              sizeof( uint8_t ) * number_of_sub_nodes * file_system_btree->io_handle->block_size );
+
+	if( sub_nodes_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sub nodes data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_block_reader_initialize(
+	     &block_reader,
+	     file_system_btree->io_handle,
+	     file_system_btree->encryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create block reader.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		/* The encryption identifier of a metadata block is its physical block number
+		 */
+		if( libfsapfs_block_reader_append_request(
+		     block_reader,
+		     (off64_t) ( sub_node_block_numbers[ sub_node_index ] * file_system_btree->io_handle->block_size ),
+		     &( sub_nodes_data[ sub_node_index * file_system_btree->io_handle->block_size ] ),
+		     (size_t) file_system_btree->io_handle->block_size,
+		     error ) != 1 )
 		{
-			file_system_identifier &= 0x0fffffffffffffffUL;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append read request for sub node: %" PRIu64 ".",
+			 function,
+			 sub_node_block_numbers[ sub_node_index ] );
+
+			goto on_error;
+		}
+	}
+	if( libfsapfs_block_reader_read(
+	     block_reader,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub nodes.",
+		 function );
 
-			if( file_system_identifier >= identifier )
+		goto on_error;
+	}
+	if( libfsapfs_block_reader_free(
+	     &block_reader,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free block reader.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_node_index = 0;
+	     sub_node_index < number_of_sub_nodes;
+	     sub_node_index++ )
+	{
+		if( libfsapfs_btree_node_initialize(
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		/* Sub nodes that cannot be read or are not supported are left to be read on demand
+		 * so that the corresponding error is reported by libfsapfs_file_system_btree_get_sub_node
+		 */
+		result = libfsapfs_btree_node_read_data(
+		          sub_node,
+		          &( sub_nodes_data[ sub_node_index * file_system_btree->io_handle->block_size ] ),
+		          (size_t) file_system_btree->io_handle->block_size,
+		          NULL );
+
+		if( ( result != 1 )
+		 || ( ( sub_node->object_type != 0x00000003UL )
+		  &&  ( sub_node->object_type != 0x10000003UL ) )
+		 || ( sub_node->object_subtype != 0x0000000eUL )
+		 || ( ( sub_node->node_header->flags & 0x0001 ) != 0 )
+		 || ( ( sub_node->node_header->flags & 0x0004 ) != 0 ) )
+		{
+			if( libfsapfs_btree_node_free(
+			     &sub_node,
+			     error ) != 1 )
 			{
-				if( ( previous_entry == NULL )
-				 || ( ( file_system_identifier == identifier )
-				  &&  ( file_system_data_type <= data_type ) ) )
-				{
-					previous_entry = entry;
-				}
-				*btree_entry = previous_entry;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free B-tree node.",
+				 function );
 
-				return( 1 );
+				goto on_error;
 			}
-			previous_entry = entry;
+			continue;
+		}
+		sub_node->block_number = sub_node_block_numbers[ sub_node_index ];
+
+		if( libfsapfs_node_cache_insert_node(
+		     file_system_btree->node_cache,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to insert node into cache.",
+			 function );
+
+			goto on_error;
+		}
+		cached_node = sub_node;
+		sub_node    = NULL;
+
+		if( libfsapfs_node_cache_release_node(
+		     file_system_btree->node_cache,
+		     &cached_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 sub_nodes_data );
+
+	return( 1 );
+
+on_error:
+	if( cached_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &cached_node,
+		 NULL );
+	}
+	if( sub_node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &sub_node,
+		 NULL );
+	}
+	if( block_reader != NULL )
+	{
+		libfsapfs_block_reader_free(
+		 &block_reader,
+		 NULL );
+	}
+	if( sub_nodes_data != NULL )
+	{
+		memory_free(
+		 sub_nodes_data );
+	}
+	return( -1 );
+}
+
+/* Compares a file system identifier with the key data of a file system B-tree entry
+ * The key value contains the lookup identifier as: ( data type << 60 ) | identifier
+ * Keys are ordered by identifier and then by data type
+ * Returns LIBFSAPFS_COMPARE_LESS, LIBFSAPFS_COMPARE_EQUAL, LIBFSAPFS_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsapfs_file_system_btree_compare_identifier_with_key_data(
+     intptr_t *key_value,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsapfs_file_system_btree_compare_identifier_with_key_data";
+	uint64_t file_system_identifier = 0;
+	uint64_t lookup_identifier      = 0;
+	uint8_t file_system_data_type   = 0;
+	uint8_t lookup_data_type        = 0;
+
+	if( key_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data_size < 8 )
+	 || ( key_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_identifier = *( (uint64_t *) key_value );
+	lookup_data_type  = (uint8_t) ( lookup_identifier >> 60 );
+
+	lookup_identifier &= 0x0fffffffffffffffUL;
+
+	byte_stream_copy_to_uint64_little_endian(
+	 key_data,
+	 file_system_identifier );
+
+	file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
+
+	file_system_identifier &= 0x0fffffffffffffffUL;
+
+	if( lookup_identifier < file_system_identifier )
+	{
+		return( LIBFSAPFS_COMPARE_LESS );
+	}
+	else if( lookup_identifier > file_system_identifier )
+	{
+		return( LIBFSAPFS_COMPARE_GREATER );
+	}
+	if( lookup_data_type < file_system_data_type )
+	{
+		return( LIBFSAPFS_COMPARE_LESS );
+	}
+	else if( lookup_data_type > file_system_data_type )
+	{
+		return( LIBFSAPFS_COMPARE_GREATER );
+	}
+	return( LIBFSAPFS_COMPARE_EQUAL );
+}
+
+/* Compares a directory record lookup key with the key data of a file system B-tree entry
+ * The key value contains the lookup identifier as: ( data type << 60 ) | identifier
+ * followed by the name hash
+ * Directory records with a hashed key are ordered by identifier, data type and then by name hash
+ * The name hash is only compared if both the key value and the key data contain a name hash
+ * Returns LIBFSAPFS_COMPARE_LESS, LIBFSAPFS_COMPARE_EQUAL, LIBFSAPFS_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsapfs_file_system_btree_compare_directory_record_with_key_data(
+     intptr_t *key_value,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *name    = NULL;
+	static char *function  = "libfsapfs_file_system_btree_compare_directory_record_with_key_data";
+	uint64_t *lookup_key   = NULL;
+	uint32_t key_name_hash = 0;
+	uint32_t name_hash     = 0;
+	uint16_t name_size     = 0;
+	int compare_result     = 0;
+
+	compare_result = libfsapfs_file_system_btree_compare_identifier_with_key_data(
+	                  key_value,
+	                  key_data,
+	                  key_data_size,
+	                  error );
+
+	if( compare_result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare identifier with key data.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_key = (uint64_t *) key_value;
+	name_hash  = (uint32_t) lookup_key[ 1 ];
+
+	if( ( compare_result != LIBFSAPFS_COMPARE_EQUAL )
+	 || ( (uint8_t) ( lookup_key[ 0 ] >> 60 ) != LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD )
+	 || ( name_hash == 0 ) )
+	{
+		return( compare_result );
+	}
+	if( libfsapfs_directory_record_get_name_from_key_data(
+	     key_data,
+	     key_data_size,
+	     &name,
+	     &name_size,
+	     &key_name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name hash from key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_name_hash != 0 )
+	{
+		if( name_hash < key_name_hash )
+		{
+			return( LIBFSAPFS_COMPARE_LESS );
+		}
+		else if( name_hash > key_name_hash )
+		{
+			return( LIBFSAPFS_COMPARE_GREATER );
+		}
+	}
+	return( LIBFSAPFS_COMPARE_EQUAL );
+}
+
+/* Retrieves an entry for a specific identifier from the file system B-tree node
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libfsapfs_btree_node_t *node,
+     uint64_t identifier,
+     uint8_t data_type,
+     libfsapfs_btree_entry_t **btree_entry,
+     libcerror_error_t **error )
+{
+	static char *function      = "libfsapfs_file_system_btree_get_entry_from_node_by_identifier";
+	uint64_t lookup_identifier = 0;
+	int btree_entry_index      = 0;
+	int is_leaf_node           = 0;
+	int number_of_entries      = 0;
+	int result                 = 0;
+
+	if( file_system_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( btree_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid B-tree entry.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: retrieving B-tree entry identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
+		 function,
+		 identifier,
+		 data_type,
+		 libfsapfs_debug_print_file_system_data_type(
+		  data_type ) );
+	}
+#endif
+	is_leaf_node = libfsapfs_btree_node_is_leaf_node(
+	                node,
+	                error );
+
+	if( is_leaf_node == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if B-tree node is a leaf node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_btree_node_get_number_of_entries(
+	     node,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from B-tree node.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	lookup_identifier = ( (uint64_t) data_type << 60 ) | ( identifier & 0x0fffffffffffffffUL );
+
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          node,
+	          (intptr_t *) &lookup_identifier,
+	          &libfsapfs_file_system_btree_compare_identifier_with_key_data,
+	          &btree_entry_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to search B-tree node for identifier: %" PRIu64 ".",
+		 function,
+		 identifier );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		if( is_leaf_node != 0 )
+		{
+			return( 0 );
+		}
+		/* In a branch node the sub node that can contain the identifier
+		 * starts at the last entry with a key that is less than the identifier
+		 */
+		if( btree_entry_index > 0 )
+		{
+			btree_entry_index--;
 		}
 	}
-	if( is_leaf_node == 0 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: B-tree entry: %d\n",
+		 function,
+		 btree_entry_index );
+	}
+#endif
+	if( libfsapfs_btree_node_get_entry_by_index(
+	     node,
+	     btree_entry_index,
+	     btree_entry,
+	     error ) != 1 )
 	{
-		*btree_entry = previous_entry;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d from B-tree node.",
+		 function,
+		 btree_entry_index );
 
-		return( 1 );
+		return( -1 );
 	}
-	return( 0 );
+	return( 1 );
 }
 
 /* Retrieves an entry for a specific identifier from the file system B-tree
+ * The B-tree node is referenced and must be released with libfsapfs_node_cache_release_node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libfsapfs_file_system_btree_get_entry_by_identifier(
@@ -1310,7 +1712,7 @@ int libfsapfs_file_system_btree_get_entry_by_identifier(
 			 "%s: invalid recursion depth value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
 		                node,
@@ -1325,7 +1727,7 @@ int libfsapfs_file_system_btree_get_entry_by_identifier(
 			 "%s: unable to determine if B-tree node is a leaf node.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		result = libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
 		          file_system_btree,
@@ -1344,7 +1746,7 @@ int libfsapfs_file_system_btree_get_entry_by_identifier(
 			 "%s: unable to retrieve entry from B-tree node.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( result == 0 )
 		{
@@ -1372,9 +1774,22 @@ int libfsapfs_file_system_btree_get_entry_by_identifier(
 			 "%s: unable to determine sub node block number.",
 			 function );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libfsapfs_node_cache_release_node(
+		     file_system_btree->node_cache,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
 		}
-		node = NULL;
 
 		if( libfsapfs_file_system_btree_get_sub_node(
 		     file_system_btree,
@@ -1391,13 +1806,37 @@ int libfsapfs_file_system_btree_get_entry_by_identifier(
 			 function,
 			 sub_node_block_number );
 
-			return( -1 );
+			goto on_error;
 		}
 		recursion_depth++;
 	}
 	while( is_leaf_node == 0 );
 
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 	return( 0 );
+
+on_error:
+	if( node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &node,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves a directory record for an UTF-8 encoded name from the file system B-tree leaf node
@@ -1416,17 +1855,12 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 	libfsapfs_btree_entry_t *entry                      = NULL;
 	libfsapfs_directory_record_t *safe_directory_record = NULL;
 	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name";
-	uint64_t file_system_identifier                     = 0;
-	uint64_t lookup_identifier                          = 0;
+	uint64_t lookup_key[ 2 ]                            = { 0, 0 };
 	int compare_result                                  = 0;
 	int entry_index                                     = 0;
 	int is_leaf_node                                    = 0;
 	int number_of_entries                               = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t file_system_data_type                       = 0;
-#endif
-
 	if( file_system_btree == NULL )
 	{
 		libcerror_error_set(
@@ -1498,11 +1932,28 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 
 		goto on_error;
 	}
-	lookup_identifier = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD << 60 ) | parent_identifier;
+	lookup_key[ 0 ] = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD << 60 ) | ( parent_identifier & 0x0fffffffffffffffUL );
+	lookup_key[ 1 ] = (uint64_t) name_hash;
 
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	/* Seek the first directory record of the parent with a matching name hash
+	 */
+	if( libfsapfs_btree_node_search_entry_by_key(
+	     node,
+	     (intptr_t *) lookup_key,
+	     &libfsapfs_file_system_btree_compare_directory_record_with_key_data,
+	     &entry_index,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to search B-tree node for directory record.",
+		 function );
+
+		goto on_error;
+	}
+	while( entry_index < number_of_entries )
 	{
 		if( libfsapfs_btree_node_get_entry_by_index(
 		     node,
@@ -1531,50 +1982,62 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 
 			goto on_error;
 		}
-		if( entry->key_data == NULL )
+		compare_result = libfsapfs_file_system_btree_compare_directory_record_with_key_data(
+		                  (intptr_t *) lookup_key,
+		                  entry->key_data,
+		                  entry->key_data_size,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d - missing key data.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare directory record with key of B-tree entry: %d.",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
-		if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		else if( compare_result != LIBFSAPFS_COMPARE_EQUAL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
-			 function,
-			 entry_index );
-
-			goto on_error;
+			break;
 		}
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsapfs_file_system_btree_key_common_t *) entry->key_data )->file_system_identifier,
-		 file_system_identifier );
-
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
-			file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
-
 			libcnotify_printf(
 			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
 			 function,
 			 entry_index,
-			 file_system_identifier & 0x0fffffffffffffffUL,
-			 file_system_data_type,
+			 parent_identifier,
+			 (uint8_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD,
 			 libfsapfs_debug_print_file_system_data_type(
-			  file_system_data_type ) );
+			  (uint8_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) );
 		}
 #endif
-		if( file_system_identifier == lookup_identifier )
+		compare_result = libfsapfs_directory_record_compare_key_data_with_utf8_string(
+		                  entry->key_data,
+		                  entry->key_data_size,
+		                  utf8_string,
+		                  utf8_string_length,
+		                  name_hash,
+		                  file_system_btree->use_case_folding,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare UTF-8 string with name of directory record.",
+			 function );
+
+			goto on_error;
+		}
+		else if( compare_result == LIBUNA_COMPARE_EQUAL )
 		{
 			if( libfsapfs_directory_record_initialize(
 			     &safe_directory_record,
@@ -1604,60 +2067,26 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf8_name
 
 				goto on_error;
 			}
-			compare_result = libfsapfs_directory_record_compare_name_with_utf8_string(
-			                  safe_directory_record,
-			                  utf8_string,
-			                  utf8_string_length,
-			                  name_hash,
-			                  file_system_btree->use_case_folding,
-			                  error );
-
-			if( compare_result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare UTF-8 string with name of directory record.",
-				 function );
-
-				goto on_error;
-			}
-			else if( compare_result == LIBUNA_COMPARE_EQUAL )
-			{
-				if( libfsapfs_directory_record_read_value_data(
-				     safe_directory_record,
-				     entry->value_data,
-				     (size_t) entry->value_data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read directory record value data.",
-					 function );
-
-					goto on_error;
-				}
-				*directory_record = safe_directory_record;
-
-				return( 1 );
-			}
-			if( libfsapfs_directory_record_free(
-			     &safe_directory_record,
+			if( libfsapfs_directory_record_read_value_data(
+			     safe_directory_record,
+			     entry->value_data,
+			     (size_t) entry->value_data_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory record.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory record value data.",
 				 function );
 
 				goto on_error;
 			}
+			*directory_record = safe_directory_record;
+
+			return( 1 );
 		}
+		entry_index++;
 	}
 	return( 0 );
 
@@ -1687,19 +2116,17 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_na
      int recursion_depth,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *entry                      = NULL;
-	libfsapfs_btree_entry_t *previous_entry             = NULL;
-	libfsapfs_btree_node_t *sub_node                    = NULL;
-	libfsapfs_directory_record_t *safe_directory_record = NULL;
-	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name";
-	uint64_t file_system_identifier                     = 0;
-	uint64_t sub_node_block_number                      = 0;
-	uint8_t file_system_data_type                       = 0;
-	int compare_result                                  = 0;
-	int entry_index                                     = 0;
-	int is_leaf_node                                    = 0;
-	int number_of_entries                               = 0;
-	int result                                          = 0;
+	libfsapfs_btree_entry_t *entry          = NULL;
+	libfsapfs_btree_entry_t *previous_entry = NULL;
+	libfsapfs_btree_node_t *sub_node        = NULL;
+	static char *function                   = "libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_name";
+	uint64_t lookup_key[ 2 ]                = { 0, 0 };
+	uint64_t sub_node_block_number          = 0;
+	int compare_result                      = 0;
+	int entry_index                         = 0;
+	int is_leaf_node                        = 0;
+	int number_of_entries                   = 0;
+	int result                              = 0;
 
 	if( file_system_btree == NULL )
 	{
@@ -1796,159 +2223,129 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_na
 
 		goto on_error;
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	lookup_key[ 0 ] = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD << 60 ) | ( parent_identifier & 0x0fffffffffffffffUL );
+	lookup_key[ 1 ] = (uint64_t) name_hash;
+
+	/* Seek the first directory record of the parent with a matching name hash
+	 * the entry preceding it refers to the sub node where the directory record
+	 * would be stored if no entry with a matching name hash is found
+	 */
+	if( libfsapfs_btree_node_search_entry_by_key(
+	     node,
+	     (intptr_t *) lookup_key,
+	     &libfsapfs_file_system_btree_compare_directory_record_with_key_data,
+	     &entry_index,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to search B-tree node for directory record.",
+		 function );
+
+		goto on_error;
+	}
+	if( entry_index > 0 )
 	{
 		if( libfsapfs_btree_node_get_entry_by_index(
 		     node,
-		     entry_index,
-		     &entry,
+		     entry_index - 1,
+		     &previous_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from B-tree node.",
-			 function );
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 entry_index - 1 );
 
 			goto on_error;
 		}
-		if( entry == NULL )
+	}
+	while( entry_index < number_of_entries )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     entry_index,
+		     &entry,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
-		if( entry->key_data == NULL )
+		if( entry == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d - missing key data.",
+			 "%s: invalid B-tree entry: %d.",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
-		if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		compare_result = libfsapfs_file_system_btree_compare_directory_record_with_key_data(
+		                  (intptr_t *) lookup_key,
+		                  entry->key_data,
+		                  entry->key_data_size,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare directory record with key of B-tree entry: %d.",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsapfs_file_system_btree_key_common_t *) entry->key_data )->file_system_identifier,
-		 file_system_identifier );
-
-		file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
-			 function,
-			 entry_index,
-			 file_system_identifier & 0x0fffffffffffffffUL,
-			 file_system_data_type,
-			 libfsapfs_debug_print_file_system_data_type(
-			  file_system_data_type ) );
-		}
-#endif
-		file_system_identifier &= 0x0fffffffffffffffUL;
-
-		if( ( file_system_identifier > parent_identifier )
-		 || ( ( file_system_identifier == parent_identifier )
-		  &&  ( file_system_data_type > LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) ) )
+		else if( compare_result != LIBFSAPFS_COMPARE_EQUAL )
 		{
 			break;
 		}
-		if( ( file_system_identifier == parent_identifier )
-		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) )
-		{
-			if( libfsapfs_directory_record_initialize(
-			     &safe_directory_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory record.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfsapfs_directory_record_read_key_data(
-			     safe_directory_record,
-			     entry->key_data,
-			     (size_t) entry->key_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read directory record key data.",
-				 function );
-
-				goto on_error;
-			}
-			/* The directory records are sorted by case-sensitive name
-			 */
-			compare_result = libfsapfs_directory_record_compare_name_with_utf8_string(
-			                  safe_directory_record,
-			                  utf8_string,
-			                  utf8_string_length,
-			                  name_hash,
-			                  0,
-			                  error );
-
-			if( compare_result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare UTF-8 string with name of directory record.",
-				 function );
+		/* The directory records are sorted by case-sensitive name
+		 */
+		compare_result = libfsapfs_directory_record_compare_key_data_with_utf8_string(
+		                  entry->key_data,
+		                  entry->key_data_size,
+		                  utf8_string,
+		                  utf8_string_length,
+		                  name_hash,
+		                  0,
+		                  error );
 
-				goto on_error;
-			}
-			if( libfsapfs_directory_record_free(
-			     &safe_directory_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory record.",
-				 function );
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare UTF-8 string with name of directory record.",
+			 function );
 
-				goto on_error;
-			}
-			if( compare_result == LIBUNA_COMPARE_LESS )
-			{
-				break;
-			}
+			goto on_error;
+		}
+		else if( compare_result == LIBUNA_COMPARE_LESS )
+		{
+			break;
 		}
 		previous_entry = entry;
+
+		entry_index++;
 	}
 	if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
 	     file_system_btree,
@@ -2037,21 +2434,34 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf8_na
 
 		goto on_error;
 	}
-	sub_node = NULL;
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
 
+		goto on_error;
+	}
 	return( result );
 
 on_error:
-	if( *directory_record != NULL )
+	if( sub_node != NULL )
 	{
-		libfsapfs_directory_record_free(
-		 directory_record,
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &sub_node,
 		 NULL );
 	}
-	if( safe_directory_record != NULL )
+	if( *directory_record != NULL )
 	{
 		libfsapfs_directory_record_free(
-		 &safe_directory_record,
+		 directory_record,
 		 NULL );
 	}
 	return( -1 );
@@ -2073,17 +2483,12 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_nam
 	libfsapfs_btree_entry_t *entry                      = NULL;
 	libfsapfs_directory_record_t *safe_directory_record = NULL;
 	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_name";
-	uint64_t file_system_identifier                     = 0;
-	uint64_t lookup_identifier                          = 0;
+	uint64_t lookup_key[ 2 ]                            = { 0, 0 };
 	int compare_result                                  = 0;
 	int entry_index                                     = 0;
 	int is_leaf_node                                    = 0;
 	int number_of_entries                               = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t file_system_data_type                       = 0;
-#endif
-
 	if( file_system_btree == NULL )
 	{
 		libcerror_error_set(
@@ -2155,11 +2560,28 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_nam
 
 		goto on_error;
 	}
-	lookup_identifier = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD << 60 ) | parent_identifier;
+	lookup_key[ 0 ] = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD << 60 ) | ( parent_identifier & 0x0fffffffffffffffUL );
+	lookup_key[ 1 ] = (uint64_t) name_hash;
 
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	/* Seek the first directory record of the parent with a matching name hash
+	 */
+	if( libfsapfs_btree_node_search_entry_by_key(
+	     node,
+	     (intptr_t *) lookup_key,
+	     &libfsapfs_file_system_btree_compare_directory_record_with_key_data,
+	     &entry_index,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to search B-tree node for directory record.",
+		 function );
+
+		goto on_error;
+	}
+	while( entry_index < number_of_entries )
 	{
 		if( libfsapfs_btree_node_get_entry_by_index(
 		     node,
@@ -2188,50 +2610,62 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_nam
 
 			goto on_error;
 		}
-		if( entry->key_data == NULL )
+		compare_result = libfsapfs_file_system_btree_compare_directory_record_with_key_data(
+		                  (intptr_t *) lookup_key,
+		                  entry->key_data,
+		                  entry->key_data_size,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d - missing key data.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare directory record with key of B-tree entry: %d.",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
-		if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		else if( compare_result != LIBFSAPFS_COMPARE_EQUAL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
-			 function,
-			 entry_index );
-
-			goto on_error;
+			break;
 		}
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsapfs_file_system_btree_key_common_t *) entry->key_data )->file_system_identifier,
-		 file_system_identifier );
-
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
-			file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
-
 			libcnotify_printf(
 			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
 			 function,
 			 entry_index,
-			 file_system_identifier & 0x0fffffffffffffffUL,
-			 file_system_data_type,
+			 parent_identifier,
+			 (uint8_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD,
 			 libfsapfs_debug_print_file_system_data_type(
-			  file_system_data_type ) );
+			  (uint8_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) );
 		}
 #endif
-		if( file_system_identifier == lookup_identifier )
+		compare_result = libfsapfs_directory_record_compare_key_data_with_utf16_string(
+		                  entry->key_data,
+		                  entry->key_data_size,
+		                  utf16_string,
+		                  utf16_string_length,
+		                  name_hash,
+		                  file_system_btree->use_case_folding,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare UTF-16 string with name of directory record.",
+			 function );
+
+			goto on_error;
+		}
+		else if( compare_result == LIBUNA_COMPARE_EQUAL )
 		{
 			if( libfsapfs_directory_record_initialize(
 			     &safe_directory_record,
@@ -2261,60 +2695,26 @@ int libfsapfs_file_system_btree_get_directory_record_from_leaf_node_by_utf16_nam
 
 				goto on_error;
 			}
-			compare_result = libfsapfs_directory_record_compare_name_with_utf16_string(
-			                  safe_directory_record,
-			                  utf16_string,
-			                  utf16_string_length,
-			                  name_hash,
-			                  file_system_btree->use_case_folding,
-			                  error );
-
-			if( compare_result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare UTF-16 string with name of directory record.",
-				 function );
-
-				goto on_error;
-			}
-			else if( compare_result == LIBUNA_COMPARE_EQUAL )
-			{
-				if( libfsapfs_directory_record_read_value_data(
-				     safe_directory_record,
-				     entry->value_data,
-				     (size_t) entry->value_data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read directory record value data.",
-					 function );
-
-					goto on_error;
-				}
-				*directory_record = safe_directory_record;
-
-				return( 1 );
-			}
-			if( libfsapfs_directory_record_free(
-			     &safe_directory_record,
+			if( libfsapfs_directory_record_read_value_data(
+			     safe_directory_record,
+			     entry->value_data,
+			     (size_t) entry->value_data_size,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory record.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read directory record value data.",
 				 function );
 
 				goto on_error;
 			}
+			*directory_record = safe_directory_record;
+
+			return( 1 );
 		}
+		entry_index++;
 	}
 	return( 0 );
 
@@ -2344,19 +2744,17 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_n
      int recursion_depth,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *entry                      = NULL;
-	libfsapfs_btree_entry_t *previous_entry             = NULL;
-	libfsapfs_btree_node_t *sub_node                    = NULL;
-	libfsapfs_directory_record_t *safe_directory_record = NULL;
-	static char *function                               = "libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name";
-	uint64_t file_system_identifier                     = 0;
-	uint64_t sub_node_block_number                      = 0;
-	uint8_t file_system_data_type                       = 0;
-	int compare_result                                  = 0;
-	int entry_index                                     = 0;
-	int is_leaf_node                                    = 0;
-	int number_of_entries                               = 0;
-	int result                                          = 0;
+	libfsapfs_btree_entry_t *entry          = NULL;
+	libfsapfs_btree_entry_t *previous_entry = NULL;
+	libfsapfs_btree_node_t *sub_node        = NULL;
+	static char *function                   = "libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_name";
+	uint64_t lookup_key[ 2 ]                = { 0, 0 };
+	uint64_t sub_node_block_number          = 0;
+	int compare_result                      = 0;
+	int entry_index                         = 0;
+	int is_leaf_node                        = 0;
+	int number_of_entries                   = 0;
+	int result                              = 0;
 
 	if( file_system_btree == NULL )
 	{
@@ -2453,159 +2851,129 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_n
 
 		goto on_error;
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	lookup_key[ 0 ] = ( (uint64_t) LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD << 60 ) | ( parent_identifier & 0x0fffffffffffffffUL );
+	lookup_key[ 1 ] = (uint64_t) name_hash;
+
+	/* Seek the first directory record of the parent with a matching name hash
+	 * the entry preceding it refers to the sub node where the directory record
+	 * would be stored if no entry with a matching name hash is found
+	 */
+	if( libfsapfs_btree_node_search_entry_by_key(
+	     node,
+	     (intptr_t *) lookup_key,
+	     &libfsapfs_file_system_btree_compare_directory_record_with_key_data,
+	     &entry_index,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to search B-tree node for directory record.",
+		 function );
+
+		goto on_error;
+	}
+	if( entry_index > 0 )
 	{
 		if( libfsapfs_btree_node_get_entry_by_index(
 		     node,
-		     entry_index,
-		     &entry,
+		     entry_index - 1,
+		     &previous_entry,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from B-tree node.",
-			 function );
+			 "%s: unable to retrieve B-tree entry: %d.",
+			 function,
+			 entry_index - 1 );
 
 			goto on_error;
 		}
-		if( entry == NULL )
+	}
+	while( entry_index < number_of_entries )
+	{
+		if( libfsapfs_btree_node_get_entry_by_index(
+		     node,
+		     entry_index,
+		     &entry,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve B-tree entry: %d.",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
-		if( entry->key_data == NULL )
+		if( entry == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d - missing key data.",
+			 "%s: invalid B-tree entry: %d.",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
-		if( entry->key_data_size < sizeof( fsapfs_file_system_btree_key_common_t ) )
+		compare_result = libfsapfs_file_system_btree_compare_directory_record_with_key_data(
+		                  (intptr_t *) lookup_key,
+		                  entry->key_data,
+		                  entry->key_data_size,
+		                  error );
+
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare directory record with key of B-tree entry: %d.",
 			 function,
 			 entry_index );
 
 			goto on_error;
 		}
-		byte_stream_copy_to_uint64_little_endian(
-		 ( (fsapfs_file_system_btree_key_common_t *) entry->key_data )->file_system_identifier,
-		 file_system_identifier );
-
-		file_system_data_type = (uint8_t) ( file_system_identifier >> 60 );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		else if( compare_result != LIBFSAPFS_COMPARE_EQUAL )
 		{
-			libcnotify_printf(
-			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
-			 function,
-			 entry_index,
-			 file_system_identifier & 0x0fffffffffffffffUL,
-			 file_system_data_type,
-			 libfsapfs_debug_print_file_system_data_type(
-			  file_system_data_type ) );
+			break;
 		}
-#endif
-		file_system_identifier &= 0x0fffffffffffffffUL;
+		/* The directory records are sorted by case-sensitive name
+		 */
+		compare_result = libfsapfs_directory_record_compare_key_data_with_utf16_string(
+		                  entry->key_data,
+		                  entry->key_data_size,
+		                  utf16_string,
+		                  utf16_string_length,
+		                  name_hash,
+		                  0,
+		                  error );
 
-		if( ( file_system_identifier > parent_identifier )
-		 || ( ( file_system_identifier == parent_identifier )
-		  &&  ( file_system_data_type > LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) ) )
+		if( compare_result == -1 )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare UTF-16 string with name of directory record.",
+			 function );
+
+			goto on_error;
 		}
-		if( ( file_system_identifier == parent_identifier )
-		 && ( file_system_data_type == LIBFSAPFS_FILE_SYSTEM_DATA_TYPE_DIRECTORY_RECORD ) )
+		else if( compare_result == LIBUNA_COMPARE_LESS )
 		{
-			if( libfsapfs_directory_record_initialize(
-			     &safe_directory_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create directory record.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfsapfs_directory_record_read_key_data(
-			     safe_directory_record,
-			     entry->key_data,
-			     (size_t) entry->key_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read directory record key data.",
-				 function );
-
-				goto on_error;
-			}
-			/* The directory records are sorted by case-sensitive name
-			 */
-			compare_result = libfsapfs_directory_record_compare_name_with_utf16_string(
-			                  safe_directory_record,
-			                  utf16_string,
-			                  utf16_string_length,
-			                  name_hash,
-			                  0,
-			                  error );
-
-			if( compare_result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compare UTF-16 string with name of directory record.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfsapfs_directory_record_free(
-			     &safe_directory_record,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free directory record.",
-				 function );
-
-				goto on_error;
-			}
-			if( compare_result == LIBUNA_COMPARE_LESS )
-			{
-				break;
-			}
+			break;
 		}
 		previous_entry = entry;
+
+		entry_index++;
 	}
 	if( libfsapfs_file_system_btree_get_sub_node_block_number_from_entry(
 	     file_system_btree,
@@ -2694,21 +3062,34 @@ int libfsapfs_file_system_btree_get_directory_record_from_branch_node_by_utf16_n
 
 		goto on_error;
 	}
-	sub_node = NULL;
-
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 	return( result );
 
 on_error:
-	if( *directory_record != NULL )
+	if( sub_node != NULL )
 	{
-		libfsapfs_directory_record_free(
-		 directory_record,
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &sub_node,
 		 NULL );
 	}
-	if( safe_directory_record != NULL )
+	if( *directory_record != NULL )
 	{
 		libfsapfs_directory_record_free(
-		 &safe_directory_record,
+		 directory_record,
 		 NULL );
 	}
 	return( -1 );
@@ -3069,6 +3450,24 @@ int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 		 transaction_identifier );
 	}
 #endif
+	if( libfsapfs_file_system_btree_read_sub_nodes_by_identifier(
+	     file_system_btree,
+	     file_io_handle,
+	     node,
+	     parent_identifier,
+	     transaction_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub nodes of: %" PRIu64 ".",
+		 function,
+		 parent_identifier );
+
+		goto on_error;
+	}
 	if( libfsapfs_btree_node_get_number_of_entries(
 	     node,
 	     &number_of_entries,
@@ -3255,7 +3654,20 @@ int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 			{
 				found_directory_entry = 1;
 			}
-			sub_node = NULL;
+			if( libfsapfs_node_cache_release_node(
+			     file_system_btree->node_cache,
+			     &sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release B-tree node.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		previous_entry = entry;
 	}
@@ -3345,9 +3757,30 @@ int libfsapfs_file_system_btree_get_directory_entries_from_branch_node(
 	{
 		found_directory_entry = 1;
 	}
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 	return( found_directory_entry );
 
 on_error:
+	if( sub_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &sub_node,
+		 NULL );
+	}
 	libcdata_array_empty(
 	 directory_entries,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_directory_record_free,
@@ -3498,6 +3931,20 @@ int libfsapfs_file_system_btree_get_directory_entries(
 
 		goto on_error;
 	}
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_PROFILER )
 	if( file_system_btree->io_handle->profiler != NULL )
 	{
@@ -3524,6 +3971,13 @@ int libfsapfs_file_system_btree_get_directory_entries(
 	return( result );
 
 on_error:
+	if( root_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &root_node,
+		 NULL );
+	}
 	libcdata_array_empty(
 	 directory_entries,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_directory_record_free,
@@ -4073,7 +4527,20 @@ int libfsapfs_file_system_btree_get_attributes_from_branch_node(
 			{
 				found_attribute = 1;
 			}
-			sub_node = NULL;
+			if( libfsapfs_node_cache_release_node(
+			     file_system_btree->node_cache,
+			     &sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release B-tree node.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		previous_entry = entry;
 	}
@@ -4163,9 +4630,30 @@ int libfsapfs_file_system_btree_get_attributes_from_branch_node(
 	{
 		found_attribute = 1;
 	}
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 	return( found_attribute );
 
 on_error:
+	if( sub_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &sub_node,
+		 NULL );
+	}
 	libcdata_array_empty(
 	 extended_attributes_array,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_attribute_values_free,
@@ -4316,6 +4804,20 @@ int libfsapfs_file_system_btree_get_attributes(
 
 		goto on_error;
 	}
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_PROFILER )
 	if( file_system_btree->io_handle->profiler != NULL )
 	{
@@ -4342,6 +4844,13 @@ int libfsapfs_file_system_btree_get_attributes(
 	return( result );
 
 on_error:
+	if( root_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &root_node,
+		 NULL );
+	}
 	libcdata_array_empty(
 	 extended_attributes_array,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_attribute_values_free,
@@ -4695,6 +5204,24 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 		 transaction_identifier );
 	}
 #endif
+	if( libfsapfs_file_system_btree_read_sub_nodes_by_identifier(
+	     file_system_btree,
+	     file_io_handle,
+	     node,
+	     identifier,
+	     transaction_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read sub nodes of: %" PRIu64 ".",
+		 function,
+		 identifier );
+
+		goto on_error;
+	}
 	if( libfsapfs_btree_node_get_number_of_entries(
 	     node,
 	     &number_of_entries,
@@ -4905,7 +5432,20 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 			{
 				found_file_extent = 1;
 			}
-			sub_node = NULL;
+			if( libfsapfs_node_cache_release_node(
+			     file_system_btree->node_cache,
+			     &sub_node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release B-tree node.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		previous_entry = entry;
 	}
@@ -4997,9 +5537,30 @@ int libfsapfs_file_system_btree_get_file_extents_from_branch_node(
 	{
 		found_file_extent = 1;
 	}
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &sub_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 	return( found_file_extent );
 
 on_error:
+	if( sub_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &sub_node,
+		 NULL );
+	}
 	libcdata_array_empty(
 	 file_extents,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
@@ -5115,9 +5676,30 @@ int libfsapfs_file_system_btree_get_file_extents(
 
 		goto on_error;
 	}
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 	return( result );
 
 on_error:
+	if( root_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &root_node,
+		 NULL );
+	}
 	libcdata_array_empty(
 	 file_extents,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
@@ -5298,7 +5880,20 @@ int libfsapfs_file_system_btree_get_inode_by_identifier(
 
 			goto on_error;
 		}
-		btree_node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     file_system_btree->node_cache,
+		     &btree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_PROFILER )
 	if( file_system_btree->io_handle->profiler != NULL )
@@ -5328,6 +5923,13 @@ int libfsapfs_file_system_btree_get_inode_by_identifier(
 	return( result );
 
 on_error:
+	if( btree_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &btree_node,
+		 NULL );
+	}
 	if( safe_inode != NULL )
 	{
 		libfsapfs_inode_free(
@@ -5545,8 +6147,20 @@ int libfsapfs_file_system_btree_get_inode_by_utf8_name(
 			goto on_error;
 		}
 	}
-	root_node = NULL;
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
 
+		goto on_error;
+	}
 	if( result != 0 )
 	{
 		result = libfsapfs_file_system_btree_get_entry_by_identifier(
@@ -5635,11 +6249,38 @@ int libfsapfs_file_system_btree_get_inode_by_utf8_name(
 
 			goto on_error;
 		}
-		btree_node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     file_system_btree->node_cache,
+		     &btree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( result );
 
 on_error:
+	if( root_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &root_node,
+		 NULL );
+	}
+	if( btree_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &btree_node,
+		 NULL );
+	}
 	if( *directory_record != NULL )
 	{
 		libfsapfs_directory_record_free(
@@ -5942,8 +6583,20 @@ int libfsapfs_file_system_btree_get_inode_by_utf8_path(
 			goto on_error;
 		}
 	}
-	root_node = NULL;
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
 
+		goto on_error;
+	}
 	if( result != 0 )
 	{
 		result = libfsapfs_file_system_btree_get_entry_by_identifier(
@@ -6032,13 +6685,40 @@ int libfsapfs_file_system_btree_get_inode_by_utf8_path(
 
 			goto on_error;
 		}
-		btree_node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     file_system_btree->node_cache,
+		     &btree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 
 		*directory_record = safe_directory_record;
 	}
 	return( result );
 
 on_error:
+	if( root_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &root_node,
+		 NULL );
+	}
+	if( btree_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &btree_node,
+		 NULL );
+	}
 	if( safe_directory_record != NULL )
 	{
 		libfsapfs_directory_record_free(
@@ -6262,8 +6942,20 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_name(
 			goto on_error;
 		}
 	}
-	root_node = NULL;
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
 
+		goto on_error;
+	}
 	if( result != 0 )
 	{
 		result = libfsapfs_file_system_btree_get_entry_by_identifier(
@@ -6352,11 +7044,38 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_name(
 
 			goto on_error;
 		}
-		btree_node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     file_system_btree->node_cache,
+		     &btree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( result );
 
 on_error:
+	if( root_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &root_node,
+		 NULL );
+	}
+	if( btree_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &btree_node,
+		 NULL );
+	}
 	if( *directory_record != NULL )
 	{
 		libfsapfs_directory_record_free(
@@ -6659,8 +7378,20 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
 			goto on_error;
 		}
 	}
-	root_node = NULL;
+	if( libfsapfs_node_cache_release_node(
+	     file_system_btree->node_cache,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
 
+		goto on_error;
+	}
 	if( result != 0 )
 	{
 		result = libfsapfs_file_system_btree_get_entry_by_identifier(
@@ -6749,13 +7480,40 @@ int libfsapfs_file_system_btree_get_inode_by_utf16_path(
 
 			goto on_error;
 		}
-		btree_node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     file_system_btree->node_cache,
+		     &btree_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 
 		*directory_record = safe_directory_record;
 	}
 	return( result );
 
 on_error:
+	if( root_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &root_node,
+		 NULL );
+	}
+	if( btree_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 file_system_btree->node_cache,
+		 &btree_node,
+		 NULL );
+	}
 	if( safe_directory_record != NULL )
 	{
 		libfsapfs_directory_record_free(
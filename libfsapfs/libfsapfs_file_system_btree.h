@@ -33,8 +33,7 @@
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libcerror.h"
-#include "libfsapfs_libfcache.h"
-#include "libfsapfs_libfdata.h"
+#include "libfsapfs_node_cache.h"
 #include "libfsapfs_object_map_btree.h"
 
 #if defined( __cplusplus )
@@ -53,17 +52,13 @@ struct libfsapfs_file_system_btree
 	 */
 	libfsapfs_encryption_context_t *encryption_context;
 
-	/* The data block vector
-	 */
-	libfdata_vector_t *data_block_vector;
-
-	/* The data block cache
+	/* The node cache
 	 */
-	libfcache_cache_t *data_block_cache;
+	libfsapfs_node_cache_t *node_cache;
 
-	/* The node cache
+	/* The number of node cache entries reserved from the IO handle
 	 */
-	libfcache_cache_t *node_cache;
+	int number_of_cache_entries;
 
 	/* The volume object map B-tree
 	 */
@@ -82,7 +77,6 @@ int libfsapfs_file_system_btree_initialize(
      libfsapfs_file_system_btree_t **file_system_btree,
      libfsapfs_io_handle_t *io_handle,
      libfsapfs_encryption_context_t *encryption_context,
-     libfdata_vector_t *data_block_vector,
      libfsapfs_object_map_btree_t *object_map_btree,
      uint64_t root_node_block_number,
      uint8_t use_case_folding,
@@ -114,6 +108,26 @@ int libfsapfs_file_system_btree_get_sub_node(
      libfsapfs_btree_node_t **sub_node,
      libcerror_error_t **error );
 
+int libfsapfs_file_system_btree_read_sub_nodes_by_identifier(
+     libfsapfs_file_system_btree_t *file_system_btree,
+     libbfio_handle_t *file_io_handle,
+     libfsapfs_btree_node_t *node,
+     uint64_t identifier,
+     uint64_t transaction_identifier,
+     libcerror_error_t **error );
+
+int libfsapfs_file_system_btree_compare_identifier_with_key_data(
+     intptr_t *key_value,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_file_system_btree_compare_directory_record_with_key_data(
+     intptr_t *key_value,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
 int libfsapfs_file_system_btree_get_entry_from_node_by_identifier(
      libfsapfs_file_system_btree_t *file_system_btree,
      libfsapfs_btree_node_t *node,
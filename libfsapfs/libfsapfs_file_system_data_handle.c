@@ -23,8 +23,11 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsapfs_block_reader.h"
+#include "libfsapfs_cache_statistics.h"
 #include "libfsapfs_data_block.h"
 #include "libfsapfs_definitions.h"
+#include "libfsapfs_decryption_pool.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_file_extent.h"
 #include "libfsapfs_libbfio.h"
@@ -32,6 +35,7 @@
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libfcache.h"
 #include "libfsapfs_libfdata.h"
+#include "libfsapfs_mapped_file.h"
 #include "libfsapfs_profiler.h"
 #include "libfsapfs_unused.h"
 #include "libfsapfs_file_system_data_handle.h"
@@ -45,6 +49,7 @@ int libfsapfs_file_system_data_handle_initialize(
      libfsapfs_io_handle_t *io_handle,
      libfsapfs_encryption_context_t *encryption_context,
      libcdata_array_t *file_extents,
+     uint8_t is_sparse,
      libcerror_error_t **error )
 {
 	static char *function = "libfsapfs_file_system_data_handle_initialize";
@@ -110,9 +115,23 @@ int libfsapfs_file_system_data_handle_initialize(
 
 		goto on_error;
 	}
-	( *file_system_data_handle )->io_handle          = io_handle;
-	( *file_system_data_handle )->encryption_context = encryption_context;
-	( *file_system_data_handle )->file_extents       = file_extents;
+	if( libfsapfs_encryption_context_clone(
+	     &( ( *file_system_data_handle )->encryption_context ),
+	     encryption_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to clone encryption context.",
+		 function );
+
+		goto on_error;
+	}
+	( *file_system_data_handle )->io_handle    = io_handle;
+	( *file_system_data_handle )->file_extents = file_extents;
+	( *file_system_data_handle )->is_sparse    = is_sparse;
 
 	return( 1 );
 
@@ -135,6 +154,7 @@ int libfsapfs_file_system_data_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfsapfs_file_system_data_handle_free";
+	int result            = 1;
 
 	if( file_system_data_handle == NULL )
 	{
@@ -149,12 +169,28 @@ int libfsapfs_file_system_data_handle_free(
 	}
 	if( *file_system_data_handle != NULL )
 	{
+		if( ( *file_system_data_handle )->encryption_context != NULL )
+		{
+			if( libfsapfs_encryption_context_free(
+			     &( ( *file_system_data_handle )->encryption_context ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free encryption context.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 *file_system_data_handle );
 
 		*file_system_data_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Reads a data block
@@ -174,14 +210,17 @@ int libfsapfs_file_system_data_handle_read_data_block(
      uint8_t read_flags LIBFSAPFS_ATTRIBUTE_UNUSED,
      libcerror_error_t **error )
 {
-	libfsapfs_data_block_t *data_block   = NULL;
-	libfsapfs_file_extent_t *file_extent = NULL;
-	static char *function                = "libfsapfs_file_system_data_handle_read_data_block";
-	uint64_t encryption_identifier       = 0;
-	int64_t file_extent_offset           = 0;
+	libfsapfs_cache_statistics_t *cache_statistics = NULL;
+	libfsapfs_data_block_t *data_block             = NULL;
+	libfsapfs_file_extent_t *file_extent           = NULL;
+	static char *function                          = "libfsapfs_file_system_data_handle_read_data_block";
+	size64_t read_size                             = 0;
+	uint64_t encryption_identifier                 = 0;
+	int64_t file_extent_offset                     = 0;
+	int number_of_cache_values                     = 0;
 
 #if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
+	int64_t profiler_start_timestamp               = 0;
 #endif
 
 	LIBFSAPFS_UNREFERENCED_PARAMETER( read_flags );
@@ -219,8 +258,9 @@ int libfsapfs_file_system_data_handle_read_data_block(
 
 		return( -1 );
 	}
-	if( libfsapfs_data_block_initialize(
+	if( libfsapfs_data_block_initialize_with_buffer_pool(
 	     &data_block,
+	     file_system_data_handle->io_handle->buffer_pool,
 	     (size_t) element_data_size,
 	     error ) != 1 )
 	{
@@ -348,6 +388,20 @@ int libfsapfs_file_system_data_handle_read_data_block(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
+	if( libfcache_cache_get_number_of_cache_values(
+	     cache,
+	     &number_of_cache_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of cache values.",
+		 function );
+
+		goto on_error;
+	}
 	if( libfdata_vector_set_element_value_by_index(
 	     vector,
 	     (intptr_t *) file_io_handle,
@@ -367,6 +421,47 @@ int libfsapfs_file_system_data_handle_read_data_block(
 
 		goto on_error;
 	}
+	data_block = NULL;
+
+	cache_statistics = file_system_data_handle->io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS - 1 ];
+
+	if( libfsapfs_cache_statistics_add_lookups(
+	     cache_statistics,
+	     0,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update cache statistics.",
+		 function );
+
+		goto on_error;
+	}
+
+	if( ( element_data_flags & LIBFDATA_RANGE_FLAG_IS_SPARSE ) == 0 )
+	{
+		read_size = element_data_size;
+	}
+	if( libfsapfs_cache_statistics_add_value(
+	     cache_statistics,
+	     cache,
+	     number_of_cache_values,
+	     element_data_size,
+	     read_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update cache statistics.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -379,3 +474,554 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the file extent that contains a specific logical offset
+ * The extent index is used as a hint where to start the search and is set to the index of the file extent
+ * Returns 1 if successful, 0 if no such file extent or -1 on error
+ */
+int libfsapfs_file_system_data_handle_get_file_extent_at_offset(
+     libfsapfs_file_system_data_handle_t *file_system_data_handle,
+     int *extent_index,
+     off64_t logical_offset,
+     libfsapfs_file_extent_t **file_extent,
+     libcerror_error_t **error )
+{
+	libfsapfs_file_extent_t *safe_file_extent = NULL;
+	static char *function                     = "libfsapfs_file_system_data_handle_get_file_extent_at_offset";
+	int number_of_extents                     = 0;
+	int safe_extent_index                     = 0;
+
+	if( file_system_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_extent == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file extent.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_data_handle->file_extents == NULL )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     file_system_data_handle->file_extents,
+	     &number_of_extents,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of file extents.",
+		 function );
+
+		return( -1 );
+	}
+	safe_extent_index = *extent_index;
+
+	if( ( safe_extent_index < 0 )
+	 || ( safe_extent_index >= number_of_extents ) )
+	{
+		safe_extent_index = 0;
+	}
+	while( safe_extent_index < number_of_extents )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     file_system_data_handle->file_extents,
+		     safe_extent_index,
+		     (intptr_t **) &safe_file_extent,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file extent: %d.",
+			 function,
+			 safe_extent_index );
+
+			return( -1 );
+		}
+		if( safe_file_extent == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing file extent: %d.",
+			 function,
+			 safe_extent_index );
+
+			return( -1 );
+		}
+		if( (uint64_t) logical_offset < safe_file_extent->logical_offset )
+		{
+			if( safe_extent_index == 0 )
+			{
+				return( 0 );
+			}
+			/* The hint is beyond the logical offset, restart at the first file extent
+			 */
+			safe_extent_index = 0;
+
+			continue;
+		}
+		if( ( (uint64_t) logical_offset - safe_file_extent->logical_offset ) < safe_file_extent->data_size )
+		{
+			break;
+		}
+		safe_extent_index++;
+	}
+	if( safe_extent_index >= number_of_extents )
+	{
+		return( 0 );
+	}
+	*extent_index = safe_extent_index;
+	*file_extent  = safe_file_extent;
+
+	return( 1 );
+}
+
+/* Reads data of a single file extent directly into a buffer, bypassing the data block cache
+ * The extent_index is used as a hint where to start looking for the file extent
+ * that contains the logical offset and is set to the index of that file extent
+ * Sparse file extents are filled with 0-byte values regardless of the minimum read size
+ * If a block reader is provided the read is appended to it as a request and the data is
+ * not available until the requests of the block reader have been read
+ * Returns the number of bytes read, 0 if the data cannot be read directly or -1 on error
+ */
+ssize_t libfsapfs_file_system_data_handle_read_extent_data(
+         libfsapfs_file_system_data_handle_t *file_system_data_handle,
+         libbfio_handle_t *file_io_handle,
+         libfsapfs_block_reader_t *block_reader,
+         int *extent_index,
+         off64_t logical_offset,
+         uint8_t *data,
+         size_t data_size,
+         size_t minimum_read_size,
+         libcerror_error_t **error )
+{
+	libfsapfs_file_extent_t *file_extent = NULL;
+	static char *function                = "libfsapfs_file_system_data_handle_read_extent_data";
+	size_t read_size                     = 0;
+	ssize_t read_count                   = 0;
+	off64_t file_offset                  = 0;
+	uint64_t extent_data_offset          = 0;
+	uint64_t sector_number               = 0;
+	int result                           = 0;
+
+#if defined( HAVE_PROFILER )
+	int64_t profiler_start_timestamp     = 0;
+#endif
+
+	if( file_system_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_data_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( extent_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid extent index.",
+		 function );
+
+		return( -1 );
+	}
+	if( logical_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid logical offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsapfs_file_system_data_handle_get_file_extent_at_offset(
+	          file_system_data_handle,
+	          extent_index,
+	          logical_offset,
+	          &file_extent,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 logical_offset,
+		 logical_offset );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	extent_data_offset = (uint64_t) logical_offset - file_extent->logical_offset;
+	read_size          = data_size;
+
+	if( (uint64_t) read_size > ( file_extent->data_size - extent_data_offset ) )
+	{
+		read_size = (size_t) ( file_extent->data_size - extent_data_offset );
+	}
+	if( file_extent->physical_block_number == 0 )
+	{
+		/* Sparse file extents are not stored and hence do not need to be read
+		 */
+		if( file_system_data_handle->is_sparse == 0 )
+		{
+			return( 0 );
+		}
+		if( memory_set(
+		     data,
+		     0,
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear data.",
+			 function );
+
+			return( -1 );
+		}
+		return( (ssize_t) read_size );
+	}
+	/* Encrypted data is decrypted per data block, unless the volume has a decryption pool
+	 * in which case sector aligned data is read and decrypted directly
+	 */
+	if( file_system_data_handle->encryption_context != NULL )
+	{
+		if( ( file_system_data_handle->io_handle->decryption_pool == NULL )
+		 || ( ( extent_data_offset % file_system_data_handle->io_handle->bytes_per_sector ) != 0 ) )
+		{
+			return( 0 );
+		}
+		read_size -= read_size % file_system_data_handle->io_handle->bytes_per_sector;
+
+		if( read_size == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( read_size < minimum_read_size )
+	{
+		return( 0 );
+	}
+	file_offset = (off64_t) ( ( file_extent->physical_block_number * file_system_data_handle->io_handle->block_size ) + extent_data_offset );
+
+	/* Encrypted data is read synchronously since it needs to be decrypted after the read
+	 */
+	if( ( block_reader != NULL )
+	 && ( file_system_data_handle->encryption_context == NULL ) )
+	{
+		if( libfsapfs_block_reader_append_request(
+		     block_reader,
+		     file_offset,
+		     data,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append extent data at offset: %" PRIi64 " (0x%08" PRIx64 ") to block reader.",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+		return( (ssize_t) read_size );
+	}
+
+#if defined( HAVE_PROFILER )
+	if( file_system_data_handle->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_start_timing(
+		     file_system_data_handle->io_handle->profiler,
+		     &profiler_start_timestamp,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to start timing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              data,
+	              read_size,
+	              file_offset,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read extent data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		return( -1 );
+	}
+	if( file_system_data_handle->encryption_context != NULL )
+	{
+		sector_number  = file_extent->encryption_identifier * file_system_data_handle->io_handle->block_size;
+		sector_number += extent_data_offset;
+		sector_number /= file_system_data_handle->io_handle->bytes_per_sector;
+
+		if( libfsapfs_decryption_pool_decrypt(
+		     file_system_data_handle->io_handle->decryption_pool,
+		     data,
+		     read_size,
+		     sector_number,
+		     file_system_data_handle->io_handle->bytes_per_sector,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ENCRYPTION,
+			 LIBCERROR_ENCRYPTION_ERROR_DECRYPT_FAILED,
+			 "%s: unable to decrypt extent data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+
+			return( -1 );
+		}
+	}
+#if defined( HAVE_PROFILER )
+	if( file_system_data_handle->io_handle->profiler != NULL )
+	{
+		if( libfsapfs_profiler_stop_timing(
+		     file_system_data_handle->io_handle->profiler,
+		     profiler_start_timestamp,
+		     function,
+		     file_offset,
+		     read_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to stop timing.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_PROFILER ) */
+
+	return( read_count );
+}
+
+/* Advises the kernel that the extent data of a specific logical range will be needed
+ * The advice is only applied if the container is memory mapped and the data is not encrypted
+ * The range is bounded by the maximum read-ahead size, the remainder is not advised
+ * The extent index is used as a hint where to start the search
+ * Returns 1 if successful, 0 if the data is not memory mapped or -1 on error
+ */
+int libfsapfs_file_system_data_handle_advise_extent_data(
+     libfsapfs_file_system_data_handle_t *file_system_data_handle,
+     int *extent_index,
+     off64_t logical_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	libfsapfs_file_extent_t *file_extent = NULL;
+	static char *function                = "libfsapfs_file_system_data_handle_advise_extent_data";
+	size64_t advise_size                 = 0;
+	uint64_t extent_data_offset          = 0;
+	off64_t file_offset                  = 0;
+	int result                           = 0;
+
+	if( file_system_data_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file system data handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_system_data_handle->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file system data handle - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_system_data_handle->io_handle->mapped_file == NULL )
+	 || ( file_system_data_handle->encryption_context != NULL ) )
+	{
+		return( 0 );
+	}
+	if( size > file_system_data_handle->io_handle->maximum_read_ahead_size )
+	{
+		size = file_system_data_handle->io_handle->maximum_read_ahead_size;
+	}
+	while( size > 0 )
+	{
+		result = libfsapfs_file_system_data_handle_get_file_extent_at_offset(
+		          file_system_data_handle,
+		          extent_index,
+		          logical_offset,
+		          &file_extent,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve file extent at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 logical_offset,
+			 logical_offset );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		extent_data_offset = (uint64_t) logical_offset - file_extent->logical_offset;
+		advise_size        = file_extent->data_size - extent_data_offset;
+
+		if( advise_size > size )
+		{
+			advise_size = size;
+		}
+		/* Sparse file extents are not stored
+		 */
+		if( file_extent->physical_block_number != 0 )
+		{
+			file_offset = (off64_t) ( ( file_extent->physical_block_number * file_system_data_handle->io_handle->block_size ) + extent_data_offset );
+
+			if( libfsapfs_mapped_file_advise_will_need(
+			     file_system_data_handle->io_handle->mapped_file,
+			     file_offset,
+			     advise_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to advise mapped file at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+				 function,
+				 file_offset,
+				 file_offset );
+
+				return( -1 );
+			}
+		}
+		logical_offset += (off64_t) advise_size;
+		size           -= advise_size;
+	}
+	return( 1 );
+}
+
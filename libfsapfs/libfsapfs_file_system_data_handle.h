@@ -25,7 +25,9 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsapfs_block_reader.h"
 #include "libfsapfs_encryption_context.h"
+#include "libfsapfs_file_extent.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
@@ -45,13 +47,18 @@ struct libfsapfs_file_system_data_handle
 	 */
 	libfsapfs_io_handle_t *io_handle;
 
-	/* The encryption context
+	/* The encryption context, a clone of the volume encryption context
+	 * so that data handles can decrypt concurrently
 	 */
 	libfsapfs_encryption_context_t *encryption_context;
 
 	/* The file extents
 	 */
 	libcdata_array_t *file_extents;
+
+	/* Value to indicate the file extents can contain sparse extents
+	 */
+	uint8_t is_sparse;
 };
 
 int libfsapfs_file_system_data_handle_initialize(
@@ -59,6 +66,7 @@ int libfsapfs_file_system_data_handle_initialize(
      libfsapfs_io_handle_t *io_handle,
      libfsapfs_encryption_context_t *encryption_context,
      libcdata_array_t *file_extents,
+     uint8_t is_sparse,
      libcerror_error_t **error );
 
 int libfsapfs_file_system_data_handle_free(
@@ -78,6 +86,31 @@ int libfsapfs_file_system_data_handle_read_data_block(
      uint8_t read_flags,
      libcerror_error_t **error );
 
+int libfsapfs_file_system_data_handle_get_file_extent_at_offset(
+     libfsapfs_file_system_data_handle_t *file_system_data_handle,
+     int *extent_index,
+     off64_t logical_offset,
+     libfsapfs_file_extent_t **file_extent,
+     libcerror_error_t **error );
+
+ssize_t libfsapfs_file_system_data_handle_read_extent_data(
+         libfsapfs_file_system_data_handle_t *file_system_data_handle,
+         libbfio_handle_t *file_io_handle,
+         libfsapfs_block_reader_t *block_reader,
+         int *extent_index,
+         off64_t logical_offset,
+         uint8_t *data,
+         size_t data_size,
+         size_t minimum_read_size,
+         libcerror_error_t **error );
+
+int libfsapfs_file_system_data_handle_advise_extent_data(
+     libfsapfs_file_system_data_handle_t *file_system_data_handle,
+     int *extent_index,
+     off64_t logical_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
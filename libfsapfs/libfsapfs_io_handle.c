@@ -23,13 +23,22 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsapfs_cache_statistics.h"
+#include "libfsapfs_definitions.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
 #include "libfsapfs_profiler.h"
 
 const char fsapfs_container_signature[ 4 ] = { 'N', 'X', 'S', 'B' };
 const char fsapfs_volume_signature[ 4 ]    = { 'A', 'P', 'S', 'B' };
 
+/* The share, in 16ths, of the maximum cache size per cache type
+ * in order: object map nodes, snapshot metadata nodes, file system nodes, data blocks and decompressed data
+ */
+static const uint8_t libfsapfs_io_handle_cache_size_shares[ LIBFSAPFS_NUMBER_OF_CACHE_TYPES ] = {
+	2, 1, 10, 1, 2 };
+
 /* Creates an IO handle
  * Make sure the value io_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -39,6 +48,7 @@ int libfsapfs_io_handle_initialize(
      libcerror_error_t **error )
 {
 	static char *function = "libfsapfs_io_handle_initialize";
+	int cache_type_index  = 0;
 
 	if( io_handle == NULL )
 	{
@@ -125,14 +135,84 @@ int libfsapfs_io_handle_initialize(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	( *io_handle )->bytes_per_sector = 512;
-	( *io_handle )->block_size       = 4096;
+	for( cache_type_index = 0;
+	     cache_type_index < LIBFSAPFS_NUMBER_OF_CACHE_TYPES;
+	     cache_type_index++ )
+	{
+		if( libfsapfs_cache_statistics_initialize(
+		     &( ( *io_handle )->cache_statistics[ cache_type_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize cache statistics: %d.",
+			 function,
+			 cache_type_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *io_handle )->read_ahead_read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read-ahead read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *io_handle )->cache_read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize cache read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *io_handle )->bytes_per_sector                        = 512;
+	( *io_handle )->block_size                              = 4096;
+	( *io_handle )->maximum_read_ahead_size                 = LIBFSAPFS_DEFAULT_MAXIMUM_READ_AHEAD_SIZE;
+	( *io_handle )->maximum_number_of_concurrent_reads      = 1;
+	( *io_handle )->maximum_number_of_decryption_threads    = 1;
+	( *io_handle )->maximum_number_of_decompression_threads = 1;
 
 	return( 1 );
 
 on_error:
 	if( *io_handle != NULL )
 	{
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( ( *io_handle )->read_ahead_read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( ( *io_handle )->read_ahead_read_write_lock ),
+			 NULL );
+		}
+#endif
+		for( cache_type_index = 0;
+		     cache_type_index < LIBFSAPFS_NUMBER_OF_CACHE_TYPES;
+		     cache_type_index++ )
+		{
+			if( ( *io_handle )->cache_statistics[ cache_type_index ] != NULL )
+			{
+				libfsapfs_cache_statistics_free(
+				 &( ( *io_handle )->cache_statistics[ cache_type_index ] ),
+				 NULL );
+			}
+		}
 #if defined( HAVE_PROFILER )
 		if( ( *io_handle )->profiler != NULL )
 		{
@@ -157,6 +237,7 @@ int libfsapfs_io_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "libfsapfs_io_handle_free";
+	int cache_type_index  = 0;
 	int result            = 1;
 
 	if( io_handle == NULL )
@@ -173,34 +254,84 @@ int libfsapfs_io_handle_free(
 	if( *io_handle != NULL )
 	{
 #if defined( HAVE_PROFILER )
-		if( libfsapfs_profiler_close(
-		     ( *io_handle )->profiler,
-		     error ) != 0 )
+		if( ( *io_handle )->profiler != NULL )
+		{
+			if( libfsapfs_profiler_close(
+			     ( *io_handle )->profiler,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close profiler.",
+				 function );
+
+				result = -1;
+			}
+			if( libfsapfs_profiler_free(
+			     &( ( *io_handle )->profiler ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free profiler.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif /* defined( HAVE_PROFILER ) */
+
+		for( cache_type_index = 0;
+		     cache_type_index < LIBFSAPFS_NUMBER_OF_CACHE_TYPES;
+		     cache_type_index++ )
+		{
+			if( libfsapfs_cache_statistics_free(
+			     &( ( *io_handle )->cache_statistics[ cache_type_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free cache statistics: %d.",
+				 function,
+				 cache_type_index );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *io_handle )->read_ahead_read_write_lock ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close profiler.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read-ahead read/write lock.",
 			 function );
 
 			result = -1;
 		}
-		if( libfsapfs_profiler_free(
-		     &( ( *io_handle )->profiler ),
+		if( libcthreads_read_write_lock_free(
+		     &( ( *io_handle )->cache_read_write_lock ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free profiler.",
+			 "%s: unable to free cache read/write lock.",
 			 function );
 
 			result = -1;
 		}
-#endif /* defined( HAVE_PROFILER ) */
-
+#endif
 		memory_free(
 		 *io_handle );
 
@@ -216,10 +347,24 @@ int libfsapfs_io_handle_clear(
      libfsapfs_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function          = "libfsapfs_io_handle_clear";
+	libfsapfs_cache_statistics_t *cache_statistics[ LIBFSAPFS_NUMBER_OF_CACHE_TYPES ];
+	size64_t maximum_cache_size_by_type[ LIBFSAPFS_NUMBER_OF_CACHE_TYPES ];
+	uint64_t number_of_reserved_cache_entries[ LIBFSAPFS_NUMBER_OF_CACHE_TYPES ];
 
+	static char *function                                     = "libfsapfs_io_handle_clear";
+	size64_t maximum_cache_size                               = 0;
+	size64_t maximum_read_ahead_size                          = 0;
+	int cache_type_index                                      = 0;
+	int maximum_number_of_concurrent_reads                    = 0;
+	int maximum_number_of_decompression_threads               = 0;
+	int maximum_number_of_decryption_threads                  = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_t *cache_read_write_lock      = NULL;
+	libcthreads_read_write_lock_t *read_ahead_read_write_lock = NULL;
+#endif
 #if defined( HAVE_PROFILER )
-	libfsapfs_profiler_t *profiler = NULL;
+	libfsapfs_profiler_t *profiler                            = NULL;
 #endif
 
 	if( io_handle == NULL )
@@ -236,6 +381,62 @@ int libfsapfs_io_handle_clear(
 #if defined( HAVE_PROFILER )
 	profiler = io_handle->profiler;
 #endif
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	cache_read_write_lock      = io_handle->cache_read_write_lock;
+	read_ahead_read_write_lock = io_handle->read_ahead_read_write_lock;
+#endif
+	/* The cache and read configuration is retained so it applies when the container is re-opened
+	 */
+	maximum_cache_size                      = io_handle->maximum_cache_size;
+	maximum_read_ahead_size                 = io_handle->maximum_read_ahead_size;
+	maximum_number_of_concurrent_reads      = io_handle->maximum_number_of_concurrent_reads;
+	maximum_number_of_decryption_threads    = io_handle->maximum_number_of_decryption_threads;
+	maximum_number_of_decompression_threads = io_handle->maximum_number_of_decompression_threads;
+
+	if( memory_copy(
+	     maximum_cache_size_by_type,
+	     io_handle->maximum_cache_size_by_type,
+	     sizeof( size64_t ) * LIBFSAPFS_NUMBER_OF_CACHE_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy maximum cache size by type.",
+		 function );
+
+		return( -1 );
+	}
+	/* The reserved cache entries are retained since they are released when the caches are freed
+	 */
+	if( memory_copy(
+	     number_of_reserved_cache_entries,
+	     io_handle->number_of_reserved_cache_entries,
+	     sizeof( uint64_t ) * LIBFSAPFS_NUMBER_OF_CACHE_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of reserved cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     cache_statistics,
+	     io_handle->cache_statistics,
+	     sizeof( libfsapfs_cache_statistics_t * ) * LIBFSAPFS_NUMBER_OF_CACHE_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy cache statistics.",
+		 function );
+
+		return( -1 );
+	}
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -250,12 +451,1151 @@ int libfsapfs_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->bytes_per_sector = 512;
-	io_handle->block_size       = 4096;
+	io_handle->bytes_per_sector                        = 512;
+	io_handle->block_size                              = 4096;
+	io_handle->maximum_cache_size                      = maximum_cache_size;
+	io_handle->maximum_read_ahead_size                 = maximum_read_ahead_size;
+	io_handle->maximum_number_of_concurrent_reads      = maximum_number_of_concurrent_reads;
+	io_handle->maximum_number_of_decryption_threads    = maximum_number_of_decryption_threads;
+	io_handle->maximum_number_of_decompression_threads = maximum_number_of_decompression_threads;
+
+	if( memory_copy(
+	     io_handle->maximum_cache_size_by_type,
+	     maximum_cache_size_by_type,
+	     sizeof( size64_t ) * LIBFSAPFS_NUMBER_OF_CACHE_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy maximum cache size by type.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     io_handle->number_of_reserved_cache_entries,
+	     number_of_reserved_cache_entries,
+	     sizeof( uint64_t ) * LIBFSAPFS_NUMBER_OF_CACHE_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy number of reserved cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( cache_type_index = 0;
+	     cache_type_index < LIBFSAPFS_NUMBER_OF_CACHE_TYPES;
+	     cache_type_index++ )
+	{
+		io_handle->cache_statistics[ cache_type_index ] = cache_statistics[ cache_type_index ];
+
+		if( libfsapfs_cache_statistics_clear(
+		     io_handle->cache_statistics[ cache_type_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to clear cache statistics: %d.",
+			 function,
+			 cache_type_index );
 
+			return( -1 );
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	io_handle->cache_read_write_lock      = cache_read_write_lock;
+	io_handle->read_ahead_read_write_lock = read_ahead_read_write_lock;
+#endif
 #if defined( HAVE_PROFILER )
 	io_handle->profiler = profiler;
 #endif
 	return( 1 );
 }
 
+/* Clones (duplicates) the IO handle
+ * The cache statistics and reserved cache entries of the destination are cleared and it has no profiler
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_clone(
+     libfsapfs_io_handle_t **destination_io_handle,
+     libfsapfs_io_handle_t *source_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_clone";
+	int cache_type_index  = 0;
+
+	if( destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *destination_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid destination IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_io_handle == NULL )
+	{
+		*destination_io_handle = NULL;
+
+		return( 1 );
+	}
+	*destination_io_handle = memory_allocate_structure(
+	                          libfsapfs_io_handle_t );
+
+	if( *destination_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create destination IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     *destination_io_handle,
+	     source_io_handle,
+	     sizeof( libfsapfs_io_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to destination IO handle.",
+		 function );
+
+		memory_free(
+		 *destination_io_handle );
+
+		*destination_io_handle = NULL;
+
+		return( -1 );
+	}
+	if( memory_set(
+	     ( *destination_io_handle )->cache_statistics,
+	     0,
+	     sizeof( libfsapfs_cache_statistics_t * ) * LIBFSAPFS_NUMBER_OF_CACHE_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination cache statistics.",
+		 function );
+
+		memory_free(
+		 *destination_io_handle );
+
+		*destination_io_handle = NULL;
+
+		return( -1 );
+	}
+	if( memory_set(
+	     ( *destination_io_handle )->number_of_reserved_cache_entries,
+	     0,
+	     sizeof( uint64_t ) * LIBFSAPFS_NUMBER_OF_CACHE_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination number of reserved cache entries.",
+		 function );
+
+		memory_free(
+		 *destination_io_handle );
+
+		*destination_io_handle = NULL;
+
+		return( -1 );
+	}
+	( *destination_io_handle )->number_of_read_aheads = 0;
+	( *destination_io_handle )->read_ahead_size       = 0;
+	( *destination_io_handle )->read_ahead_used_size  = 0;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	( *destination_io_handle )->cache_read_write_lock      = NULL;
+	( *destination_io_handle )->read_ahead_read_write_lock = NULL;
+#endif
+#if defined( HAVE_PROFILER )
+	( *destination_io_handle )->profiler = NULL;
+#endif
+	for( cache_type_index = 0;
+	     cache_type_index < LIBFSAPFS_NUMBER_OF_CACHE_TYPES;
+	     cache_type_index++ )
+	{
+		if( libfsapfs_cache_statistics_initialize(
+		     &( ( *destination_io_handle )->cache_statistics[ cache_type_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize destination cache statistics: %d.",
+			 function,
+			 cache_type_index );
+
+			goto on_error;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *destination_io_handle )->read_ahead_read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize destination read-ahead read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *destination_io_handle )->cache_read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize destination cache read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *destination_io_handle != NULL )
+	{
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( ( *destination_io_handle )->read_ahead_read_write_lock != NULL )
+		{
+			libcthreads_read_write_lock_free(
+			 &( ( *destination_io_handle )->read_ahead_read_write_lock ),
+			 NULL );
+		}
+#endif
+		for( cache_type_index = 0;
+		     cache_type_index < LIBFSAPFS_NUMBER_OF_CACHE_TYPES;
+		     cache_type_index++ )
+		{
+			if( ( *destination_io_handle )->cache_statistics[ cache_type_index ] != NULL )
+			{
+				libfsapfs_cache_statistics_free(
+				 &( ( *destination_io_handle )->cache_statistics[ cache_type_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 *destination_io_handle );
+
+		*destination_io_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Sets the maximum cache size
+ * Every cache type that has no maximum cache size set gets a fixed share of the maximum cache size
+ * The maximum cache size of a cache type is shared by the caches of that type that use the IO handle
+ * A value of 0 represents the default
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_set_maximum_cache_size(
+     libfsapfs_io_handle_t *io_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_set_maximum_cache_size";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	io_handle->maximum_cache_size = maximum_cache_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum cache size of a specific cache type
+ * A value of 0 represents not set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_set_maximum_cache_size_by_type(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_set_maximum_cache_size_by_type";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type < LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES )
+	 || ( cache_type > LIBFSAPFS_CACHE_TYPE_DECOMPRESSED_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache type: %d.",
+		 function,
+		 cache_type );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	io_handle->maximum_cache_size_by_type[ cache_type - 1 ] = maximum_cache_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum read-ahead size
+ * A value of 0 disables read-ahead
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_set_maximum_read_ahead_size(
+     libfsapfs_io_handle_t *io_handle,
+     size64_t maximum_read_ahead_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_set_maximum_read_ahead_size";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_read_ahead_size > (size64_t) LIBFSAPFS_MAXIMUM_READ_AHEAD_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum read-ahead size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->maximum_read_ahead_size = maximum_read_ahead_size;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of concurrent reads
+ * A value of 1 disables concurrent reads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_set_maximum_number_of_concurrent_reads(
+     libfsapfs_io_handle_t *io_handle,
+     int maximum_number_of_concurrent_reads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_set_maximum_number_of_concurrent_reads";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_concurrent_reads < 1 )
+	 || ( maximum_number_of_concurrent_reads > LIBFSAPFS_MAXIMUM_NUMBER_OF_CONCURRENT_READS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of concurrent reads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->maximum_number_of_concurrent_reads = maximum_number_of_concurrent_reads;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of decryption threads
+ * A value of 1 disables concurrent decryption
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_set_maximum_number_of_decryption_threads(
+     libfsapfs_io_handle_t *io_handle,
+     int maximum_number_of_decryption_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_set_maximum_number_of_decryption_threads";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_decryption_threads < 1 )
+	 || ( maximum_number_of_decryption_threads > LIBFSAPFS_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of decryption threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->maximum_number_of_decryption_threads = maximum_number_of_decryption_threads;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of decompression threads
+ * A value of 1 disables concurrent decompression
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_set_maximum_number_of_decompression_threads(
+     libfsapfs_io_handle_t *io_handle,
+     int maximum_number_of_decompression_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_set_maximum_number_of_decompression_threads";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_decompression_threads < 1 )
+	 || ( maximum_number_of_decompression_threads > LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSION_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of decompression threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle->maximum_number_of_decompression_threads = maximum_number_of_decompression_threads;
+
+	return( 1 );
+}
+
+/* Retrieves the maximum number of cache entries of a specific cache type
+ * If a maximum cache size applies, the maximum number of cache entries is shared
+ * by the caches of the cache type, see libfsapfs_io_handle_reserve_cache_entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     int *maximum_number_of_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfsapfs_io_handle_get_maximum_number_of_cache_entries";
+	size64_t maximum_cache_size      = 0;
+	uint64_t number_of_cache_entries = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type < LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES )
+	 || ( cache_type > LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache type: %d.",
+		 function,
+		 cache_type );
+
+		return( -1 );
+	}
+	if( maximum_number_of_cache_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+	maximum_cache_size = io_handle->maximum_cache_size_by_type[ cache_type - 1 ];
+
+	if( maximum_cache_size == 0 )
+	{
+		maximum_cache_size = ( io_handle->maximum_cache_size / 16 )
+		                   * libfsapfs_io_handle_cache_size_shares[ cache_type - 1 ];
+	}
+	if( ( maximum_cache_size == 0 )
+	 && ( io_handle->maximum_cache_size == 0 ) )
+	{
+		if( cache_type == LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS )
+		{
+			*maximum_number_of_cache_entries = LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS;
+		}
+		else
+		{
+			*maximum_number_of_cache_entries = LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES;
+		}
+		return( 1 );
+	}
+	if( io_handle->block_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing block size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Both B-tree nodes and data blocks take up about a block of memory per cache entry
+	 */
+	number_of_cache_entries = maximum_cache_size / io_handle->block_size;
+
+	if( number_of_cache_entries == 0 )
+	{
+		number_of_cache_entries = 1;
+	}
+	else if( number_of_cache_entries > (uint64_t) INT_MAX )
+	{
+		number_of_cache_entries = (uint64_t) INT_MAX;
+	}
+	*maximum_number_of_cache_entries = (int) number_of_cache_entries;
+
+	return( 1 );
+}
+
+/* Reserves cache entries of a specific cache type for a new cache
+ * If a maximum cache size applies, the cache gets the cache entries of the cache type
+ * that are not reserved by other caches, with a minimum of 1
+ * If no maximum cache size applies, the cache gets the default number of cache entries
+ * The cache entries must be released with libfsapfs_io_handle_release_cache_entries when the cache is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_reserve_cache_entries(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     int *number_of_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function               = "libfsapfs_io_handle_reserve_cache_entries";
+	uint64_t number_of_reserved_entries = 0;
+	int maximum_number_of_cache_entries = 0;
+	int result                          = 1;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type < LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES )
+	 || ( cache_type > LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache type: %d.",
+		 function,
+		 cache_type );
+
+		return( -1 );
+	}
+	if( number_of_cache_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of cache entries.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+	     io_handle,
+	     cache_type,
+	     &maximum_number_of_cache_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum number of cache entries.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		number_of_reserved_entries = io_handle->number_of_reserved_cache_entries[ cache_type - 1 ];
+
+		if( ( io_handle->maximum_cache_size_by_type[ cache_type - 1 ] == 0 )
+		 && ( io_handle->maximum_cache_size == 0 ) )
+		{
+			*number_of_cache_entries = maximum_number_of_cache_entries;
+		}
+		else if( number_of_reserved_entries >= (uint64_t) maximum_number_of_cache_entries )
+		{
+			*number_of_cache_entries = 1;
+		}
+		else
+		{
+			*number_of_cache_entries = maximum_number_of_cache_entries - (int) number_of_reserved_entries;
+		}
+		io_handle->number_of_reserved_cache_entries[ cache_type - 1 ] += (uint64_t) *number_of_cache_entries;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases cache entries of a specific cache type that were reserved by a cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_release_cache_entries(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     int number_of_cache_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_release_cache_entries";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type < LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES )
+	 || ( cache_type > LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache type: %d.",
+		 function,
+		 cache_type );
+
+		return( -1 );
+	}
+	if( number_of_cache_entries < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of cache entries value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( (uint64_t) number_of_cache_entries > io_handle->number_of_reserved_cache_entries[ cache_type - 1 ] )
+	{
+		io_handle->number_of_reserved_cache_entries[ cache_type - 1 ] = 0;
+	}
+	else
+	{
+		io_handle->number_of_reserved_cache_entries[ cache_type - 1 ] -= (uint64_t) number_of_cache_entries;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the maximum cache size of a specific cache type
+ * The maximum cache size is in bytes, a value of 0 represents not set
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_get_maximum_cache_size(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_get_maximum_cache_size";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type < LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES )
+	 || ( cache_type > LIBFSAPFS_CACHE_TYPE_DECOMPRESSED_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache type: %d.",
+		 function,
+		 cache_type );
+
+		return( -1 );
+	}
+	if( maximum_cache_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum cache size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_cache_size = io_handle->maximum_cache_size_by_type[ cache_type - 1 ];
+
+	if( *maximum_cache_size == 0 )
+	{
+		*maximum_cache_size = ( io_handle->maximum_cache_size / 16 )
+		                    * libfsapfs_io_handle_cache_size_shares[ cache_type - 1 ];
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     io_handle->cache_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the cache statistics of a specific cache type
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_get_cache_statistics(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     libfsapfs_cache_statistics_t **cache_statistics,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_get_cache_statistics";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( cache_type < LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES )
+	 || ( cache_type > LIBFSAPFS_CACHE_TYPE_DECOMPRESSED_DATA ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported cache type: %d.",
+		 function,
+		 cache_type );
+
+		return( -1 );
+	}
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	*cache_statistics = io_handle->cache_statistics[ cache_type - 1 ];
+
+	return( 1 );
+}
+
+/* Adds read-ahead reads to the read-ahead statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_add_read_ahead_statistics(
+     libfsapfs_io_handle_t *io_handle,
+     uint64_t number_of_reads,
+     size64_t read_size,
+     size64_t used_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_add_read_ahead_statistics";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     io_handle->read_ahead_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	io_handle->number_of_read_aheads += number_of_reads;
+	io_handle->read_ahead_size       += read_size;
+	io_handle->read_ahead_used_size  += used_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     io_handle->read_ahead_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the read-ahead statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_io_handle_get_read_ahead_statistics(
+     libfsapfs_io_handle_t *io_handle,
+     uint64_t *number_of_reads,
+     size64_t *read_size,
+     size64_t *used_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_io_handle_get_read_ahead_statistics";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	if( used_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid used size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     io_handle->read_ahead_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_reads = io_handle->number_of_read_aheads;
+	*read_size       = io_handle->read_ahead_size;
+	*used_size       = io_handle->read_ahead_used_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     io_handle->read_ahead_read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
@@ -25,7 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsapfs_buffer_pool.h"
+#include "libfsapfs_cache_statistics.h"
+#include "libfsapfs_decompressed_data_cache.h"
+#include "libfsapfs_decompression_pool.h"
+#include "libfsapfs_decryption_pool.h"
+#include "libfsapfs_definitions.h"
 #include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_mapped_file.h"
 #include "libfsapfs_profiler.h"
 
 #if defined( __cplusplus )
@@ -51,6 +59,88 @@ struct libfsapfs_io_handle
 	 */
 	size64_t container_size;
 
+	/* The maximum cache size in bytes, where 0 represents the default
+	 */
+	size64_t maximum_cache_size;
+
+	/* The maximum cache size in bytes per cache type, where 0 represents not set
+	 */
+	size64_t maximum_cache_size_by_type[ LIBFSAPFS_NUMBER_OF_CACHE_TYPES ];
+
+	/* The number of cache entries per cache type reserved by the caches that use the IO handle
+	 */
+	uint64_t number_of_reserved_cache_entries[ LIBFSAPFS_NUMBER_OF_CACHE_TYPES ];
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock of the maximum cache sizes and the reserved cache entries
+	 */
+	libcthreads_read_write_lock_t *cache_read_write_lock;
+#endif
+
+	/* The cache statistics per cache type
+	 */
+	libfsapfs_cache_statistics_t *cache_statistics[ LIBFSAPFS_NUMBER_OF_CACHE_TYPES ];
+
+	/* The maximum read-ahead size in bytes, where 0 represents read-ahead is disabled
+	 */
+	size64_t maximum_read_ahead_size;
+
+	/* The maximum number of concurrent reads of a file data stream
+	 */
+	int maximum_number_of_concurrent_reads;
+
+	/* The maximum number of threads used to decrypt the data of a read
+	 */
+	int maximum_number_of_decryption_threads;
+
+	/* The maximum number of threads used to decompress the data of a read
+	 */
+	int maximum_number_of_decompression_threads;
+
+	/* The number of read-ahead reads
+	 */
+	uint64_t number_of_read_aheads;
+
+	/* The number of bytes read ahead
+	 */
+	size64_t read_ahead_size;
+
+	/* The number of bytes read ahead that were used
+	 */
+	size64_t read_ahead_used_size;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock of the read-ahead statistics
+	 */
+	libcthreads_read_write_lock_t *read_ahead_read_write_lock;
+#endif
+
+	/* The mapped file, set if the container was opened memory mapped
+	 * The mapped file is owned by the container
+	 */
+	libfsapfs_mapped_file_t *mapped_file;
+
+	/* The data block buffer pool, set if the IO handle belongs to a volume
+	 * The buffer pool is owned by the volume
+	 */
+	libfsapfs_buffer_pool_t *buffer_pool;
+
+	/* The decryption pool, set if the IO handle belongs to an unlocked volume
+	 * The decryption pool is owned by the volume
+	 */
+	libfsapfs_decryption_pool_t *decryption_pool;
+
+	/* The decompressed data cache, set if the IO handle belongs to a volume with a file system
+	 * The decompressed data cache is owned by the volume
+	 */
+	libfsapfs_decompressed_data_cache_t *decompressed_data_cache;
+
+	/* The decompression pool, set if the IO handle belongs to a volume with a file system
+	 * and concurrent decompression is enabled
+	 * The decompression pool is owned by the volume
+	 */
+	libfsapfs_decompression_pool_t *decompression_pool;
+
 #if defined( HAVE_PROFILER )
 	/* The profiler
 	 */
@@ -74,6 +164,86 @@ int libfsapfs_io_handle_clear(
      libfsapfs_io_handle_t *io_handle,
      libcerror_error_t **error );
 
+int libfsapfs_io_handle_clone(
+     libfsapfs_io_handle_t **destination_io_handle,
+     libfsapfs_io_handle_t *source_io_handle,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_set_maximum_cache_size(
+     libfsapfs_io_handle_t *io_handle,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_set_maximum_cache_size_by_type(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_set_maximum_read_ahead_size(
+     libfsapfs_io_handle_t *io_handle,
+     size64_t maximum_read_ahead_size,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_set_maximum_number_of_concurrent_reads(
+     libfsapfs_io_handle_t *io_handle,
+     int maximum_number_of_concurrent_reads,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_set_maximum_number_of_decryption_threads(
+     libfsapfs_io_handle_t *io_handle,
+     int maximum_number_of_decryption_threads,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_set_maximum_number_of_decompression_threads(
+     libfsapfs_io_handle_t *io_handle,
+     int maximum_number_of_decompression_threads,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     int *maximum_number_of_cache_entries,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_reserve_cache_entries(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     int *number_of_cache_entries,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_release_cache_entries(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     int number_of_cache_entries,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_get_maximum_cache_size(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     size64_t *maximum_cache_size,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_get_cache_statistics(
+     libfsapfs_io_handle_t *io_handle,
+     int cache_type,
+     libfsapfs_cache_statistics_t **cache_statistics,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_add_read_ahead_statistics(
+     libfsapfs_io_handle_t *io_handle,
+     uint64_t number_of_reads,
+     size64_t read_size,
+     size64_t used_size,
+     libcerror_error_t **error );
+
+int libfsapfs_io_handle_get_read_ahead_statistics(
+     libfsapfs_io_handle_t *io_handle,
+     uint64_t *number_of_reads,
+     size64_t *read_size,
+     size64_t *used_size,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
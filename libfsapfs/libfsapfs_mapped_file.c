@@ -0,0 +1,616 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcnotify.h"
+#include "libfsapfs_mapped_file.h"
+
+/* Creates a mapped file
+ * Make sure the value mapped_file is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_mapped_file_initialize(
+     libfsapfs_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_mapped_file_initialize";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*mapped_file = memory_allocate_structure(
+	                libfsapfs_mapped_file_t );
+
+	if( *mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *mapped_file,
+	     0,
+	     sizeof( libfsapfs_mapped_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear mapped file.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *mapped_file != NULL )
+	{
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a mapped file
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_mapped_file_free(
+     libfsapfs_mapped_file_t **mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_mapped_file_free";
+	int result            = 1;
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *mapped_file != NULL )
+	{
+		if( ( *mapped_file )->data != NULL )
+		{
+			if( libfsapfs_mapped_file_close(
+			     *mapped_file,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close mapped file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *mapped_file );
+
+		*mapped_file = NULL;
+	}
+	return( result );
+}
+
+/* Opens a mapped file
+ * The file is mapped read-only and the whole mapping is advised to be accessed randomly
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_mapped_file_open(
+     libfsapfs_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT )
+	struct stat file_statistics;
+
+	void *data            = NULL;
+	int file_descriptor   = -1;
+#endif
+	static char *function = "libfsapfs_mapped_file_open";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( mapped_file->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid mapped file - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_statistics.st_size <= 0 )
+	 || ( (size64_t) file_statistics.st_size > (size64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file size.",
+		 function );
+
+		goto on_error;
+	}
+	data = mmap(
+	        NULL,
+	        (size_t) file_statistics.st_size,
+	        PROT_READ,
+	        MAP_SHARED,
+	        file_descriptor,
+	        0 );
+
+	if( data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 errno,
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	mapped_file->data      = (uint8_t *) data;
+	mapped_file->data_size = (size64_t) file_statistics.st_size;
+
+	/* The mapping contains both the metadata, which is mostly accessed randomly,
+	 * and the data streams, which are read ahead explicitly per bounded window
+	 */
+	if( libfsapfs_mapped_file_set_access_pattern(
+	     mapped_file,
+	     LIBFSAPFS_MAPPED_FILE_ADVICE_RANDOM,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set mapped file access pattern.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( mapped_file->data != NULL )
+	{
+		munmap(
+		 mapped_file->data,
+		 (size_t) mapped_file->data_size );
+
+		mapped_file->data           = NULL;
+		mapped_file->data_size      = 0;
+		mapped_file->access_pattern = LIBFSAPFS_MAPPED_FILE_ADVICE_NORMAL;
+	}
+	else if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped files are not supported.",
+	 function );
+
+	return( -1 );
+#endif /* defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) */
+}
+
+/* Closes a mapped file
+ * Returns 0 if successful or -1 on error
+ */
+int libfsapfs_mapped_file_close(
+     libfsapfs_mapped_file_t *mapped_file,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_mapped_file_close";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT )
+	if( mapped_file->data != NULL )
+	{
+		if( munmap(
+		     mapped_file->data,
+		     (size_t) mapped_file->data_size ) != 0 )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 errno,
+			 "%s: unable to unmap file.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	mapped_file->data           = NULL;
+	mapped_file->data_size      = 0;
+	mapped_file->access_pattern = LIBFSAPFS_MAPPED_FILE_ADVICE_NORMAL;
+
+	return( 0 );
+}
+
+/* Retrieves a pointer to the mapped data at a specific offset
+ * Returns 1 if successful, 0 if the range is not mapped or -1 on error
+ */
+int libfsapfs_mapped_file_get_data(
+     libfsapfs_mapped_file_t *mapped_file,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_mapped_file_get_data";
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( mapped_file->data == NULL )
+	 || ( (size64_t) offset > mapped_file->data_size )
+	 || ( (size64_t) size > ( mapped_file->data_size - (size64_t) offset ) ) )
+	{
+		return( 0 );
+	}
+	*data = &( mapped_file->data[ offset ] );
+
+	return( 1 );
+}
+
+/* Advises the kernel about the expected access pattern of the whole mapped file
+ * The access pattern is only changed if it differs from the current access pattern
+ * The advice is a hint, a failure of the underlying system call is reported
+ * by the notification functions and leaves the current access pattern unchanged
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_mapped_file_set_access_pattern(
+     libfsapfs_mapped_file_t *mapped_file,
+     int access_pattern,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_mapped_file_set_access_pattern";
+
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) && defined( HAVE_MADVISE )
+	int system_advice     = 0;
+#endif
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	switch( access_pattern )
+	{
+		case LIBFSAPFS_MAPPED_FILE_ADVICE_NORMAL:
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) && defined( HAVE_MADVISE )
+			system_advice = MADV_NORMAL;
+#endif
+			break;
+
+		case LIBFSAPFS_MAPPED_FILE_ADVICE_RANDOM:
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) && defined( HAVE_MADVISE )
+			system_advice = MADV_RANDOM;
+#endif
+			break;
+
+		case LIBFSAPFS_MAPPED_FILE_ADVICE_SEQUENTIAL:
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) && defined( HAVE_MADVISE )
+			system_advice = MADV_SEQUENTIAL;
+#endif
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported access pattern.",
+			 function );
+
+			return( -1 );
+	}
+	if( ( mapped_file->data == NULL )
+	 || ( mapped_file->access_pattern == access_pattern ) )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) && defined( HAVE_MADVISE )
+	if( madvise(
+	     mapped_file->data,
+	     (size_t) mapped_file->data_size,
+	     system_advice ) != 0 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to advise access pattern: %d with error: %d.\n",
+			 function,
+			 access_pattern,
+			 errno );
+		}
+		return( 1 );
+	}
+#endif
+	mapped_file->access_pattern = access_pattern;
+
+	return( 1 );
+}
+
+/* Advises the kernel that a range of the mapped file will be needed
+ * so that the kernel can start reading the range ahead of its access
+ * The range is bounded by the maximum read-ahead size, the remainder is not advised
+ * The advice is a hint, a failure of the underlying system call is reported
+ * by the notification functions
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_mapped_file_advise_will_need(
+     libfsapfs_mapped_file_t *mapped_file,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_mapped_file_advise_will_need";
+
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) && defined( HAVE_MADVISE )
+	long page_size        = 0;
+	off64_t range_end     = 0;
+#endif
+
+	if( mapped_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid mapped file.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) && defined( HAVE_MADVISE )
+	if( ( mapped_file->data == NULL )
+	 || ( (size64_t) offset >= mapped_file->data_size )
+	 || ( size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( size > (size64_t) LIBFSAPFS_MAXIMUM_READ_AHEAD_SIZE )
+	{
+		size = (size64_t) LIBFSAPFS_MAXIMUM_READ_AHEAD_SIZE;
+	}
+	if( size > ( mapped_file->data_size - (size64_t) offset ) )
+	{
+		size = mapped_file->data_size - (size64_t) offset;
+	}
+	page_size = sysconf(
+	             _SC_PAGESIZE );
+
+	if( page_size <= 0 )
+	{
+		page_size = 4096;
+	}
+	/* madvise requires a page aligned address
+	 */
+	range_end = offset + (off64_t) size;
+	offset   -= offset % page_size;
+
+	if( madvise(
+	     &( mapped_file->data[ offset ] ),
+	     (size_t) ( range_end - offset ),
+	     MADV_WILLNEED ) != 0 )
+	{
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to advise range: %" PRIi64 " - %" PRIi64 " with error: %d.\n",
+			 function,
+			 offset,
+			 range_end,
+			 errno );
+		}
+	}
+#endif
+	return( 1 );
+}
+
@@ -0,0 +1,95 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_MAPPED_FILE_H )
+#define _LIBFSAPFS_MAPPED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_SYS_MMAN_H ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+#define HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT
+#endif
+
+typedef struct libfsapfs_mapped_file libfsapfs_mapped_file_t;
+
+struct libfsapfs_mapped_file
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size64_t data_size;
+
+	/* The access pattern advised for the whole mapping
+	 */
+	int access_pattern;
+};
+
+int libfsapfs_mapped_file_initialize(
+     libfsapfs_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libfsapfs_mapped_file_free(
+     libfsapfs_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libfsapfs_mapped_file_open(
+     libfsapfs_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libfsapfs_mapped_file_close(
+     libfsapfs_mapped_file_t *mapped_file,
+     libcerror_error_t **error );
+
+int libfsapfs_mapped_file_get_data(
+     libfsapfs_mapped_file_t *mapped_file,
+     off64_t offset,
+     size_t size,
+     const uint8_t **data,
+     libcerror_error_t **error );
+
+int libfsapfs_mapped_file_set_access_pattern(
+     libfsapfs_mapped_file_t *mapped_file,
+     int access_pattern,
+     libcerror_error_t **error );
+
+int libfsapfs_mapped_file_advise_will_need(
+     libfsapfs_mapped_file_t *mapped_file,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_MAPPED_FILE_H ) */
+
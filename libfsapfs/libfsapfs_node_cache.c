@@ -0,0 +1,764 @@
+/*
+ * B-tree node cache functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_cache_statistics.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_node_cache.h"
+
+/* The reference count of a cached node is changed while the shard is locked for reading,
+ * hence it is updated atomically
+ */
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+#define libfsapfs_node_cache_increment_reference_count( reference_count ) \
+	(int) InterlockedIncrement( (LONG volatile *) ( reference_count ) )
+
+#define libfsapfs_node_cache_decrement_reference_count( reference_count ) \
+	(int) InterlockedDecrement( (LONG volatile *) ( reference_count ) )
+
+#elif defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+#define libfsapfs_node_cache_increment_reference_count( reference_count ) \
+	__atomic_add_fetch( reference_count, 1, __ATOMIC_ACQ_REL )
+
+#define libfsapfs_node_cache_decrement_reference_count( reference_count ) \
+	__atomic_sub_fetch( reference_count, 1, __ATOMIC_ACQ_REL )
+
+#else
+#define libfsapfs_node_cache_increment_reference_count( reference_count ) \
+	( *( reference_count ) += 1 )
+
+#define libfsapfs_node_cache_decrement_reference_count( reference_count ) \
+	( *( reference_count ) -= 1 )
+
+#endif
+
+/* Creates a node cache
+ * The nodes are divided over shards by block number, where every shard has its own lock
+ * Make sure the value node_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_cache_initialize(
+     libfsapfs_node_cache_t **node_cache,
+     int maximum_number_of_nodes,
+     libfsapfs_cache_statistics_t *cache_statistics,
+     size64_t node_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_node_cache_shard_t *shard = NULL;
+	static char *function               = "libfsapfs_node_cache_initialize";
+	size_t nodes_size                   = 0;
+	int number_of_nodes                 = 0;
+	int shard_index                     = 0;
+
+	if( node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_nodes <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of nodes value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	if( cache_statistics == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid cache statistics.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_nodes = maximum_number_of_nodes / LIBFSAPFS_NODE_CACHE_NUMBER_OF_SHARDS;
+
+	if( number_of_nodes == 0 )
+	{
+		number_of_nodes = 1;
+	}
+	nodes_size = sizeof( libfsapfs_btree_node_t * ) * number_of_nodes;
+
+	*node_cache = memory_allocate_structure(
+	               libfsapfs_node_cache_t );
+
+	if( *node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create node cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *node_cache,
+	     0,
+	     sizeof( libfsapfs_node_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node cache.",
+		 function );
+
+		memory_free(
+		 *node_cache );
+
+		*node_cache = NULL;
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBFSAPFS_NODE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		shard = &( ( *node_cache )->shards[ shard_index ] );
+
+		shard->nodes = (libfsapfs_btree_node_t **) memory_allocate(
+		                                            nodes_size );
+
+		if( shard->nodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create nodes of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     shard->nodes,
+		     0,
+		     nodes_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear nodes of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		shard->number_of_nodes = number_of_nodes;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_initialize(
+		     &( shard->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize read/write lock of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	( *node_cache )->cache_statistics = cache_statistics;
+	( *node_cache )->node_size        = node_size;
+
+	return( 1 );
+
+on_error:
+	if( *node_cache != NULL )
+	{
+		libfsapfs_node_cache_free(
+		 node_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a node cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_cache_free(
+     libfsapfs_node_cache_t **node_cache,
+     libcerror_error_t **error )
+{
+	libfsapfs_node_cache_shard_t *shard = NULL;
+	static char *function               = "libfsapfs_node_cache_free";
+	size64_t cached_size                = 0;
+	int node_index                      = 0;
+	int result                          = 1;
+	int shard_index                     = 0;
+
+	if( node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node_cache != NULL )
+	{
+		for( shard_index = 0;
+		     shard_index < LIBFSAPFS_NODE_CACHE_NUMBER_OF_SHARDS;
+		     shard_index++ )
+		{
+			shard = &( ( *node_cache )->shards[ shard_index ] );
+
+			if( shard->nodes != NULL )
+			{
+				for( node_index = 0;
+				     node_index < shard->number_of_nodes;
+				     node_index++ )
+				{
+					if( shard->nodes[ node_index ] == NULL )
+					{
+						continue;
+					}
+					cached_size += ( *node_cache )->node_size;
+
+					if( libfsapfs_btree_node_free(
+					     &( shard->nodes[ node_index ] ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free node: %d of shard: %d.",
+						 function,
+						 node_index,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+				memory_free(
+				 shard->nodes );
+			}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+			if( shard->read_write_lock != NULL )
+			{
+				if( libcthreads_read_write_lock_free(
+				     &( shard->read_write_lock ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free read/write lock of shard: %d.",
+					 function,
+					 shard_index );
+
+					result = -1;
+				}
+			}
+#endif
+		}
+		if( ( *node_cache )->cache_statistics != NULL )
+		{
+			if( libfsapfs_cache_statistics_update(
+			     ( *node_cache )->cache_statistics,
+			     0,
+			     0,
+			     cached_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to update cache statistics.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *node_cache );
+
+		*node_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves a specific node from the cache
+ * The shard is only locked for reading, hence concurrent cache hits do not serialize
+ * On success the node is referenced and must be released with libfsapfs_node_cache_release_node
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsapfs_node_cache_get_node(
+     libfsapfs_node_cache_t *node_cache,
+     uint64_t block_number,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_node_t *cached_node = NULL;
+	libfsapfs_node_cache_shard_t *shard = NULL;
+	static char *function               = "libfsapfs_node_cache_get_node";
+	int node_index                      = 0;
+	int result                          = 0;
+
+	if( node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	shard      = &( node_cache->shards[ block_number % LIBFSAPFS_NODE_CACHE_NUMBER_OF_SHARDS ] );
+	node_index = (int) ( ( block_number / LIBFSAPFS_NODE_CACHE_NUMBER_OF_SHARDS ) % shard->number_of_nodes );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cached_node = shard->nodes[ node_index ];
+
+	if( ( cached_node != NULL )
+	 && ( cached_node->block_number == block_number ) )
+	{
+		libfsapfs_node_cache_increment_reference_count(
+		 &( cached_node->reference_count ) );
+
+		*node  = cached_node;
+		result = 1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The cache statistics have their own lock and are updated after the shard is released
+	 */
+	if( libfsapfs_cache_statistics_add_lookups(
+	     node_cache->cache_statistics,
+	     1,
+	     ( result == 0 ) ? 1 : 0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update cache statistics.",
+		 function );
+
+		if( result == 1 )
+		{
+			libfsapfs_node_cache_release_node(
+			 node_cache,
+			 node,
+			 NULL );
+		}
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Inserts a node into the cache
+ * The cache takes over management of the node. If another node with the same block number
+ * was inserted in the meantime the node is freed and replaced by the cached node
+ * On success the node is referenced and must be released with libfsapfs_node_cache_release_node
+ * A cached node that is replaced while it is referenced is freed when it is released
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_cache_insert_node(
+     libfsapfs_node_cache_t *node_cache,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_node_t *cached_node = NULL;
+	libfsapfs_node_cache_shard_t *shard = NULL;
+	static char *function               = "libfsapfs_node_cache_insert_node";
+	size64_t added_size                 = 0;
+	uint64_t block_number               = 0;
+	uint64_t number_of_evictions        = 0;
+	int node_index                      = 0;
+	int result                          = 1;
+
+	if( node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: missing node.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *node )->is_cached != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid node - already cached.",
+		 function );
+
+		return( -1 );
+	}
+	block_number = ( *node )->block_number;
+
+	shard      = &( node_cache->shards[ block_number % LIBFSAPFS_NODE_CACHE_NUMBER_OF_SHARDS ] );
+	node_index = (int) ( ( block_number / LIBFSAPFS_NODE_CACHE_NUMBER_OF_SHARDS ) % shard->number_of_nodes );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	cached_node = shard->nodes[ node_index ];
+
+	if( ( cached_node != NULL )
+	 && ( cached_node->block_number == block_number ) )
+	{
+		if( libfsapfs_btree_node_free(
+		     node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free node.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			libfsapfs_node_cache_increment_reference_count(
+			 &( cached_node->reference_count ) );
+
+			*node = cached_node;
+		}
+	}
+	else
+	{
+		( *node )->is_cached       = 1;
+		( *node )->reference_count = 1;
+
+		shard->nodes[ node_index ] = *node;
+
+		if( cached_node == NULL )
+		{
+			added_size = node_cache->node_size;
+		}
+		else
+		{
+			number_of_evictions = 1;
+
+			cached_node->is_cached = 0;
+
+			if( cached_node->reference_count == 0 )
+			{
+				if( libfsapfs_btree_node_free(
+				     &cached_node,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free evicted node.",
+					 function );
+
+					/* The node is managed by the cache, hence it should not be freed by the caller
+					 */
+					( *node )->reference_count = 0;
+
+					*node  = NULL;
+					result = -1;
+				}
+			}
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_cache_statistics_update(
+	     node_cache->cache_statistics,
+	     number_of_evictions,
+	     added_size,
+	     0,
+	     node_cache->node_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update cache statistics.",
+		 function );
+
+		if( result == 1 )
+		{
+			libfsapfs_node_cache_release_node(
+			 node_cache,
+			 node,
+			 NULL );
+		}
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Releases a reference to a node retrieved from the cache
+ * The node is freed if it is no longer cached and this was the last reference
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_node_cache_release_node(
+     libfsapfs_node_cache_t *node_cache,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error )
+{
+	libfsapfs_node_cache_shard_t *shard = NULL;
+	static char *function               = "libfsapfs_node_cache_release_node";
+	int reference_count                 = 0;
+	int result                          = 1;
+
+	if( node_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( *node == NULL )
+	{
+		return( 1 );
+	}
+	shard = &( node_cache->shards[ ( *node )->block_number % LIBFSAPFS_NODE_CACHE_NUMBER_OF_SHARDS ] );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	reference_count = libfsapfs_node_cache_decrement_reference_count(
+	                   &( ( *node )->reference_count ) );
+
+	if( reference_count < 0 )
+	{
+		libfsapfs_node_cache_increment_reference_count(
+		 &( ( *node )->reference_count ) );
+
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node - reference count value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		/* The is cached value is only changed while the shard is locked for writing
+		 * and a node that is no longer cached cannot be referenced again,
+		 * hence the last reference can free the node
+		 */
+		if( ( reference_count == 0 )
+		 && ( ( *node )->is_cached == 0 ) )
+		{
+			if( libfsapfs_btree_node_free(
+			     node,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free node.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     shard->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*node = NULL;
+
+	return( result );
+}
+
@@ -0,0 +1,106 @@
+/*
+ * B-tree node cache functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_NODE_CACHE_H )
+#define _LIBFSAPFS_NODE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_btree_node.h"
+#include "libfsapfs_cache_statistics.h"
+#include "libfsapfs_definitions.h"
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_node_cache_shard libfsapfs_node_cache_shard_t;
+
+struct libfsapfs_node_cache_shard
+{
+	/* The nodes
+	 */
+	libfsapfs_btree_node_t **nodes;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+typedef struct libfsapfs_node_cache libfsapfs_node_cache_t;
+
+struct libfsapfs_node_cache
+{
+	/* The shards
+	 */
+	libfsapfs_node_cache_shard_t shards[ LIBFSAPFS_NODE_CACHE_NUMBER_OF_SHARDS ];
+
+	/* The cache statistics
+	 */
+	libfsapfs_cache_statistics_t *cache_statistics;
+
+	/* The node size
+	 */
+	size64_t node_size;
+};
+
+int libfsapfs_node_cache_initialize(
+     libfsapfs_node_cache_t **node_cache,
+     int maximum_number_of_nodes,
+     libfsapfs_cache_statistics_t *cache_statistics,
+     size64_t node_size,
+     libcerror_error_t **error );
+
+int libfsapfs_node_cache_free(
+     libfsapfs_node_cache_t **node_cache,
+     libcerror_error_t **error );
+
+int libfsapfs_node_cache_get_node(
+     libfsapfs_node_cache_t *node_cache,
+     uint64_t block_number,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error );
+
+int libfsapfs_node_cache_insert_node(
+     libfsapfs_node_cache_t *node_cache,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error );
+
+int libfsapfs_node_cache_release_node(
+     libfsapfs_node_cache_t *node_cache,
+     libfsapfs_btree_node_t **node,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_NODE_CACHE_H ) */
+
@@ -24,16 +24,15 @@
 #include <memory.h>
 #include <types.h>
 
+#include "libfsapfs_address_table.h"
 #include "libfsapfs_btree_entry.h"
 #include "libfsapfs_btree_node.h"
-#include "libfsapfs_data_block.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
-#include "libfsapfs_libfcache.h"
-#include "libfsapfs_libfdata.h"
+#include "libfsapfs_node_cache.h"
 #include "libfsapfs_object_map_btree.h"
 #include "libfsapfs_object_map_descriptor.h"
 
@@ -47,7 +46,6 @@
 int libfsapfs_object_map_btree_initialize(
      libfsapfs_object_map_btree_t **object_map_btree,
      libfsapfs_io_handle_t *io_handle,
-     libfdata_vector_t *data_block_vector,
      uint64_t root_node_block_number,
      libcerror_error_t **error )
 {
@@ -75,6 +73,17 @@ int libfsapfs_object_map_btree_initialize(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	*object_map_btree = memory_allocate_structure(
 	                     libfsapfs_object_map_btree_t );
 
@@ -108,23 +117,26 @@ int libfsapfs_object_map_btree_initialize(
 
 		return( -1 );
 	}
-	if( libfcache_cache_initialize(
-	     &( ( *object_map_btree )->data_block_cache ),
-	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS,
+	if( libfsapfs_io_handle_reserve_cache_entries(
+	     io_handle,
+	     LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES,
+	     &( ( *object_map_btree )->number_of_cache_entries ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data block cache.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to reserve node cache entries.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( libfsapfs_node_cache_initialize(
 	     &( ( *object_map_btree )->node_cache ),
-	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES,
+	     ( *object_map_btree )->number_of_cache_entries,
+	     io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES - 1 ],
+	     (size64_t) io_handle->block_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -136,8 +148,21 @@ int libfsapfs_object_map_btree_initialize(
 
 		goto on_error;
 	}
+	if( libfsapfs_address_table_initialize(
+	     &( ( *object_map_btree )->address_table ),
+	     LIBFSAPFS_ADDRESS_TABLE_NUMBER_OF_ENTRIES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create address table.",
+		 function );
+
+		goto on_error;
+	}
 	( *object_map_btree )->io_handle              = io_handle;
-	( *object_map_btree )->data_block_vector      = data_block_vector;
 	( *object_map_btree )->root_node_block_number = root_node_block_number;
 
 	return( 1 );
@@ -145,6 +170,20 @@ int libfsapfs_object_map_btree_initialize(
 on_error:
 	if( *object_map_btree != NULL )
 	{
+		if( ( *object_map_btree )->number_of_cache_entries > 0 )
+		{
+			libfsapfs_io_handle_release_cache_entries(
+			 io_handle,
+			 LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES,
+			 ( *object_map_btree )->number_of_cache_entries,
+			 NULL );
+		}
+		if( ( *object_map_btree )->node_cache != NULL )
+		{
+			libfsapfs_node_cache_free(
+			 &( ( *object_map_btree )->node_cache ),
+			 NULL );
+		}
 		memory_free(
 		 *object_map_btree );
 
@@ -176,9 +215,9 @@ int libfsapfs_object_map_btree_free(
 	}
 	if( *object_map_btree != NULL )
 	{
-		/* The data_block_vector is referenced and freed elsewhere
+		/* The io_handle is referenced and freed elsewhere
 		 */
-		if( libfcache_cache_free(
+		if( libfsapfs_node_cache_free(
 		     &( ( *object_map_btree )->node_cache ),
 		     error ) != 1 )
 		{
@@ -191,15 +230,30 @@ int libfsapfs_object_map_btree_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
-		     &( ( *object_map_btree )->data_block_cache ),
+		if( libfsapfs_io_handle_release_cache_entries(
+		     ( *object_map_btree )->io_handle,
+		     LIBFSAPFS_CACHE_TYPE_OBJECT_MAP_NODES,
+		     ( *object_map_btree )->number_of_cache_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data block cache.",
+			 "%s: unable to release node cache entries.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsapfs_address_table_free(
+		     &( ( *object_map_btree )->address_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free address table.",
 			 function );
 
 			result = -1;
@@ -213,6 +267,7 @@ int libfsapfs_object_map_btree_free(
 }
 
 /* Retrieves the object map B-tree root node
+ * The node is referenced and must be released with libfsapfs_node_cache_release_node
  * Returns 1 if successful or -1 on error
  */
 int libfsapfs_object_map_btree_get_root_node(
@@ -222,14 +277,13 @@ int libfsapfs_object_map_btree_get_root_node(
      libfsapfs_btree_node_t **root_node,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	libfsapfs_btree_node_t *node         = NULL;
-	libfsapfs_data_block_t *data_block   = NULL;
-	static char *function                = "libfsapfs_object_map_btree_get_root_node";
-	int result                           = 0;
+	libfsapfs_btree_node_t *cached_node = NULL;
+	libfsapfs_btree_node_t *node        = NULL;
+	static char *function               = "libfsapfs_object_map_btree_get_root_node";
+	int result                          = 0;
 
 #if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
+	int64_t profiler_start_timestamp    = 0;
 #endif
 
 	if( object_map_btree == NULL )
@@ -243,17 +297,6 @@ int libfsapfs_object_map_btree_get_root_node(
 
 		return( -1 );
 	}
-	if( root_node_block_number > (uint64_t) INT_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid root node block number value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( root_node == NULL )
 	{
 		libcerror_error_set(
@@ -285,12 +328,10 @@ int libfsapfs_object_map_btree_get_root_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	result = libfcache_cache_get_value_by_identifier(
+	result = libfsapfs_node_cache_get_node(
 	          object_map_btree->node_cache,
-	          0,
-	          (off64_t) root_node_block_number,
-	          0,
-	          &cache_value,
+	          root_node_block_number,
+	          &cached_node,
 	          error );
 
 	if( result == -1 )
@@ -299,44 +340,13 @@ int libfsapfs_object_map_btree_get_root_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from cache.",
+		 "%s: unable to retrieve node from cache.",
 		 function );
 
 		goto on_error;
 	}
 	else if( result == 0 )
 	{
-		if( libfdata_vector_get_element_value_by_index(
-		     object_map_btree->data_block_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) object_map_btree->data_block_cache,
-		     (int) root_node_block_number,
-		     (intptr_t **) &data_block,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data block: %" PRIu64 ".",
-			 function,
-			 root_node_block_number );
-
-			goto on_error;
-		}
-		if( data_block == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data block: %" PRIu64 ".",
-			 function,
-			 root_node_block_number );
-
-			goto on_error;
-		}
 		if( libfsapfs_btree_node_initialize(
 		     &node,
 		     error ) != 1 )
@@ -350,10 +360,12 @@ int libfsapfs_object_map_btree_get_root_node(
 
 			goto on_error;
 		}
-		if( libfsapfs_btree_node_read_data(
+		if( libfsapfs_btree_node_read_file_io_handle(
 		     node,
-		     data_block->data,
-		     data_block->data_size,
+		     object_map_btree->io_handle,
+		     NULL,
+		     file_io_handle,
+		     root_node_block_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -435,44 +447,22 @@ int libfsapfs_object_map_btree_get_root_node(
 
 			goto on_error;
 		}
-		if( libfcache_cache_set_value_by_identifier(
+		if( libfsapfs_node_cache_insert_node(
 		     object_map_btree->node_cache,
-		     0,
-		     (off64_t) root_node_block_number,
-		     0,
-		     (intptr_t *) node,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
-		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     &node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value in cache.",
-			 function );
-
-			goto on_error;
-		}
-		node = NULL;
-
-		if( libfcache_cache_get_value_by_identifier(
-		     object_map_btree->node_cache,
-		     0,
-		     (off64_t) root_node_block_number,
-		     0,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from cache.",
+			 "%s: unable to insert node into cache.",
 			 function );
 
 			goto on_error;
 		}
+		cached_node = node;
+		node        = NULL;
 	}
 #if defined( HAVE_PROFILER )
 	if( object_map_btree->io_handle->profiler != NULL )
@@ -497,23 +487,18 @@ int libfsapfs_object_map_btree_get_root_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	if( libfcache_cache_value_get_value(
-	     cache_value,
-	     (intptr_t **) root_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root node.",
-		 function );
+	*root_node = cached_node;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
+	if( cached_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 object_map_btree->node_cache,
+		 &cached_node,
+		 NULL );
+	}
 	if( node != NULL )
 	{
 		libfsapfs_btree_node_free(
@@ -524,6 +509,7 @@ on_error:
 }
 
 /* Retrieves a object map B-tree sub node
+ * The node is referenced and must be released with libfsapfs_node_cache_release_node
  * Returns 1 if successful or -1 on error
  */
 int libfsapfs_object_map_btree_get_sub_node(
@@ -533,14 +519,13 @@ int libfsapfs_object_map_btree_get_sub_node(
      libfsapfs_btree_node_t **sub_node,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	libfsapfs_btree_node_t *node         = NULL;
-	libfsapfs_data_block_t *data_block   = NULL;
-	static char *function                = "libfsapfs_object_map_btree_get_sub_node";
-	int result                           = 0;
+	libfsapfs_btree_node_t *cached_node = NULL;
+	libfsapfs_btree_node_t *node        = NULL;
+	static char *function               = "libfsapfs_object_map_btree_get_sub_node";
+	int result                          = 0;
 
 #if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
+	int64_t profiler_start_timestamp    = 0;
 #endif
 
 	if( object_map_btree == NULL )
@@ -554,17 +539,6 @@ int libfsapfs_object_map_btree_get_sub_node(
 
 		return( -1 );
 	}
-	if( sub_node_block_number > (uint64_t) INT_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sub node block number value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( sub_node == NULL )
 	{
 		libcerror_error_set(
@@ -596,12 +570,10 @@ int libfsapfs_object_map_btree_get_sub_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	result = libfcache_cache_get_value_by_identifier(
+	result = libfsapfs_node_cache_get_node(
 	          object_map_btree->node_cache,
-	          0,
-	          (off64_t) sub_node_block_number,
-	          0,
-	          &cache_value,
+	          sub_node_block_number,
+	          &cached_node,
 	          error );
 
 	if( result == -1 )
@@ -610,44 +582,13 @@ int libfsapfs_object_map_btree_get_sub_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from cache.",
+		 "%s: unable to retrieve node from cache.",
 		 function );
 
 		goto on_error;
 	}
 	else if( result == 0 )
 	{
-		if( libfdata_vector_get_element_value_by_index(
-		     object_map_btree->data_block_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) object_map_btree->data_block_cache,
-		     (int) sub_node_block_number,
-		     (intptr_t **) &data_block,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data block: %" PRIu64 ".",
-			 function,
-			 sub_node_block_number );
-
-			goto on_error;
-		}
-		if( data_block == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data block: %" PRIu64 ".",
-			 function,
-			 sub_node_block_number );
-
-			goto on_error;
-		}
 		if( libfsapfs_btree_node_initialize(
 		     &node,
 		     error ) != 1 )
@@ -661,10 +602,12 @@ int libfsapfs_object_map_btree_get_sub_node(
 
 			goto on_error;
 		}
-		if( libfsapfs_btree_node_read_data(
+		if( libfsapfs_btree_node_read_file_io_handle(
 		     node,
-		     data_block->data,
-		     data_block->data_size,
+		     object_map_btree->io_handle,
+		     NULL,
+		     file_io_handle,
+		     sub_node_block_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -713,44 +656,22 @@ int libfsapfs_object_map_btree_get_sub_node(
 
 			goto on_error;
 		}
-		if( libfcache_cache_set_value_by_identifier(
+		if( libfsapfs_node_cache_insert_node(
 		     object_map_btree->node_cache,
-		     0,
-		     (off64_t) sub_node_block_number,
-		     0,
-		     (intptr_t *) node,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
-		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     &node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value in cache.",
-			 function );
-
-			goto on_error;
-		}
-		node = NULL;
-
-		if( libfcache_cache_get_value_by_identifier(
-		     object_map_btree->node_cache,
-		     0,
-		     (off64_t) sub_node_block_number,
-		     0,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from cache.",
+			 "%s: unable to insert node into cache.",
 			 function );
 
 			goto on_error;
 		}
+		cached_node = node;
+		node        = NULL;
 	}
 #if defined( HAVE_PROFILER )
 	if( object_map_btree->io_handle->profiler != NULL )
@@ -775,23 +696,18 @@ int libfsapfs_object_map_btree_get_sub_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	if( libfcache_cache_value_get_value(
-	     cache_value,
-	     (intptr_t **) sub_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub node.",
-		 function );
+	*sub_node = cached_node;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
+	if( cached_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 object_map_btree->node_cache,
+		 &cached_node,
+		 NULL );
+	}
 	if( node != NULL )
 	{
 		libfsapfs_btree_node_free(
@@ -801,7 +717,89 @@ on_error:
 	return( -1 );
 }
 
+/* Compares an object identifier and transaction identifier with the key data of an object map B-tree entry
+ * The key value contains the lookup object identifier followed by the lookup transaction identifier
+ * Keys are ordered by object identifier and then by transaction identifier
+ * Returns LIBFSAPFS_COMPARE_LESS, LIBFSAPFS_COMPARE_EQUAL, LIBFSAPFS_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsapfs_object_map_btree_compare_identifier_with_key_data(
+     intptr_t *key_value,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libfsapfs_object_map_btree_compare_identifier_with_key_data";
+	uint64_t lookup_identifier      = 0;
+	uint64_t lookup_transaction     = 0;
+	uint64_t object_map_identifier  = 0;
+	uint64_t object_map_transaction = 0;
+
+	if( key_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data_size < 16 )
+	 || ( key_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_identifier  = ( (uint64_t *) key_value )[ 0 ];
+	lookup_transaction = ( (uint64_t *) key_value )[ 1 ];
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( key_data[ 0 ] ),
+	 object_map_identifier );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 &( key_data[ 8 ] ),
+	 object_map_transaction );
+
+	if( lookup_identifier < object_map_identifier )
+	{
+		return( LIBFSAPFS_COMPARE_LESS );
+	}
+	else if( lookup_identifier > object_map_identifier )
+	{
+		return( LIBFSAPFS_COMPARE_GREATER );
+	}
+	if( lookup_transaction < object_map_transaction )
+	{
+		return( LIBFSAPFS_COMPARE_LESS );
+	}
+	else if( lookup_transaction > object_map_transaction )
+	{
+		return( LIBFSAPFS_COMPARE_GREATER );
+	}
+	return( LIBFSAPFS_COMPARE_EQUAL );
+}
+
 /* Retrieves an entry for a specific identifier from the object map B-tree node
+ * The entry with the largest transaction identifier that is less than or equal to the lookup transaction identifier is used
  * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libfsapfs_object_map_btree_get_entry_from_node_by_identifier(
@@ -812,15 +810,14 @@ int libfsapfs_object_map_btree_get_entry_from_node_by_identifier(
      libfsapfs_btree_entry_t **btree_entry,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *entry          = NULL;
-	libfsapfs_btree_entry_t *previous_entry = NULL;
-	static char *function                   = "libfsapfs_object_map_btree_get_entry_from_node_by_identifier";
-	uint64_t object_map_identifier          = 0;
-	uint64_t object_map_transaction         = 0;
-	uint64_t previous_object_map_identifier = 0;
-	int btree_entry_index                   = 0;
-	int is_leaf_node                        = 0;
-	int number_of_entries                   = 0;
+	libfsapfs_btree_entry_t *entry = NULL;
+	static char *function          = "libfsapfs_object_map_btree_get_entry_from_node_by_identifier";
+	uint64_t lookup_key[ 2 ]       = { 0, 0 };
+	uint64_t object_map_identifier = 0;
+	int btree_entry_index          = 0;
+	int is_leaf_node               = 0;
+	int number_of_entries          = 0;
+	int result                     = 0;
 
 	if( object_map_btree == NULL )
 	{
@@ -883,50 +880,79 @@ int libfsapfs_object_map_btree_get_entry_from_node_by_identifier(
 
 		return( -1 );
 	}
-	for( btree_entry_index = 0;
-	     btree_entry_index < number_of_entries;
-	     btree_entry_index++ )
+	if( number_of_entries == 0 )
 	{
-		if( libfsapfs_btree_node_get_entry_by_index(
-		     node,
-		     btree_entry_index,
-		     &entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from B-tree node.",
-			 function );
+		return( 0 );
+	}
+	lookup_key[ 0 ] = object_identifier;
+	lookup_key[ 1 ] = transaction_identifier;
+
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          node,
+	          (intptr_t *) lookup_key,
+	          &libfsapfs_object_map_btree_compare_identifier_with_key_data,
+	          &btree_entry_index,
+	          error );
 
-			return( -1 );
-		}
-		if( entry == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d.",
-			 function,
-			 btree_entry_index );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to search B-tree node for identifier: %" PRIu64 " (transaction: %" PRIu64 ").",
+		 function,
+		 object_identifier,
+		 transaction_identifier );
 
-			return( -1 );
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		/* Use the last entry with a key that is less than the lookup key
+		 */
+		if( btree_entry_index > 0 )
+		{
+			btree_entry_index--;
 		}
-		if( entry->key_data == NULL )
+		else if( is_leaf_node != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d - missing key data.",
-			 function,
-			 btree_entry_index );
-
-			return( -1 );
+			return( 0 );
 		}
-		if( entry->key_data_size < 16 )
+	}
+	if( libfsapfs_btree_node_get_entry_by_index(
+	     node,
+	     btree_entry_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d from B-tree node.",
+		 function,
+		 btree_entry_index );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid B-tree entry: %d.",
+		 function,
+		 btree_entry_index );
+
+		return( -1 );
+	}
+	if( ( result == 0 )
+	 && ( is_leaf_node != 0 ) )
+	{
+		if( ( entry->key_data == NULL )
+		 || ( entry->key_data_size < 16 ) )
 		{
 			libcerror_error_set(
 			 error,
@@ -942,58 +968,29 @@ int libfsapfs_object_map_btree_get_entry_from_node_by_identifier(
 		 &( entry->key_data[ 0 ] ),
 		 object_map_identifier );
 
-		byte_stream_copy_to_uint64_little_endian(
-		 &( entry->key_data[ 8 ] ),
-		 object_map_transaction );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: B-tree entry: %d, identifier: %" PRIu64 " (transaction: %" PRIu64 ")\n",
-			 function,
-			 btree_entry_index,
-			 object_map_identifier,
-			 object_map_transaction );
-		}
-#endif
-		if( object_map_identifier > object_identifier )
-		{
-			break;
-		}
-		else if( ( object_map_identifier == object_identifier )
-		      && ( object_map_transaction > transaction_identifier ) )
+		/* The preceding entry can only be used if it contains an older transaction of the same object
+		 */
+		if( object_map_identifier != object_identifier )
 		{
-			break;
+			return( 0 );
 		}
-		previous_entry                 = entry;
-		previous_object_map_identifier = object_map_identifier;
 	}
-	if( is_leaf_node != 0 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		if( previous_object_map_identifier == object_identifier )
-		{
-			*btree_entry = previous_entry;
-
-			return( 1 );
-		}
+		libcnotify_printf(
+		 "%s: B-tree entry: %d\n",
+		 function,
+		 btree_entry_index );
 	}
-	else
-	{
-		if( ( previous_entry == NULL )
-		 || ( ( object_map_identifier == object_identifier )
-		  &&  ( object_map_transaction <= transaction_identifier ) ) )
-		{
-			previous_entry = entry;
-		}
-		*btree_entry = previous_entry;
+#endif
+	*btree_entry = entry;
 
-		return( 1 );
-	}
-	return( 0 );
+	return( 1 );
 }
 
 /* Retrieves an entry for a specific identifier from the object map B-tree
+ * The B-tree node is referenced and must be released with libfsapfs_node_cache_release_node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libfsapfs_object_map_btree_get_entry_by_identifier(
@@ -1074,7 +1071,7 @@ int libfsapfs_object_map_btree_get_entry_by_identifier(
 			 "%s: invalid recursion depth value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
 		                node,
@@ -1089,7 +1086,7 @@ int libfsapfs_object_map_btree_get_entry_by_identifier(
 			 "%s: unable to determine if B-tree node is a leaf node.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		result = libfsapfs_object_map_btree_get_entry_from_node_by_identifier(
 		          object_map_btree,
@@ -1108,7 +1105,7 @@ int libfsapfs_object_map_btree_get_entry_by_identifier(
 			 "%s: unable to retrieve entry from B-tree node.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( result == 0 )
 		{
@@ -1130,7 +1127,7 @@ int libfsapfs_object_map_btree_get_entry_by_identifier(
 			 "%s: invalid B-tree entry.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( entry->value_data == NULL )
 		{
@@ -1141,7 +1138,7 @@ int libfsapfs_object_map_btree_get_entry_by_identifier(
 			 "%s: invalid B-tree entry - missing value data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( entry->value_data_size != 8 )
 		{
@@ -1152,7 +1149,7 @@ int libfsapfs_object_map_btree_get_entry_by_identifier(
 			 "%s: invalid B-tree entry - unsupported value data size.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		byte_stream_copy_to_uint64_little_endian(
 		 entry->value_data,
@@ -1167,7 +1164,20 @@ int libfsapfs_object_map_btree_get_entry_by_identifier(
 			 sub_node_block_number );
 		}
 #endif
-		node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     object_map_btree->node_cache,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 
 		if( libfsapfs_object_map_btree_get_sub_node(
 		     object_map_btree,
@@ -1184,13 +1194,37 @@ int libfsapfs_object_map_btree_get_entry_by_identifier(
 			 function,
 			 sub_node_block_number );
 
-			return( -1 );
+			goto on_error;
 		}
 		recursion_depth++;
 	}
 	while( is_leaf_node == 0 );
 
+	if( libfsapfs_node_cache_release_node(
+	     object_map_btree->node_cache,
+	     &node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 	return( 0 );
+
+on_error:
+	if( node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 object_map_btree->node_cache,
+		 &node,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the object map descriptor of a specific object identifier
@@ -1330,13 +1364,33 @@ int libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
 
 			goto on_error;
 		}
-		node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     object_map_btree->node_cache,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	*descriptor = safe_descriptor;
 
 	return( result );
 
 on_error:
+	if( node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 object_map_btree->node_cache,
+		 &node,
+		 NULL );
+	}
 	if( safe_descriptor != NULL )
 	{
 		libfsapfs_object_map_descriptor_free(
@@ -1346,3 +1400,169 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves the physical address of a specific object identifier
+ * Previously resolved physical addresses are retrieved from the address table
+ * instead of traversing the object map B-tree
+ * Returns 1 if successful, 0 if not found or -1 on error
+ */
+int libfsapfs_object_map_btree_get_physical_address_by_object_identifier(
+     libfsapfs_object_map_btree_t *object_map_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t object_identifier,
+     uint64_t transaction_identifier,
+     uint64_t *physical_address,
+     libcerror_error_t **error )
+{
+	libfsapfs_btree_entry_t *entry = NULL;
+	libfsapfs_btree_node_t *node   = NULL;
+	static char *function          = "libfsapfs_object_map_btree_get_physical_address_by_object_identifier";
+	int result                     = 0;
+
+	if( object_map_btree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid object map B-tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( physical_address == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid physical address.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfsapfs_address_table_get_physical_address(
+	          object_map_btree->address_table,
+	          object_identifier,
+	          transaction_identifier,
+	          physical_address,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve physical address from address table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	result = libfsapfs_object_map_btree_get_entry_by_identifier(
+	          object_map_btree,
+	          file_io_handle,
+	          object_identifier,
+	          transaction_identifier,
+	          &node,
+	          &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry from B-tree.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		if( node == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( entry == NULL )
+		 || ( entry->value_data == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid B-tree entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( entry->value_data_size < sizeof( fsapfs_object_map_btree_value_t ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid B-tree entry - value data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 ( (fsapfs_object_map_btree_value_t *) entry->value_data )->object_physical_address,
+		 *physical_address );
+
+		if( libfsapfs_node_cache_release_node(
+		     object_map_btree->node_cache,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_address_table_set_physical_address(
+		     object_map_btree->address_table,
+		     object_identifier,
+		     transaction_identifier,
+		     *physical_address,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set physical address in address table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 object_map_btree->node_cache,
+		 &node,
+		 NULL );
+	}
+	return( -1 );
+}
+
@@ -25,13 +25,13 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfsapfs_address_table.h"
 #include "libfsapfs_btree_entry.h"
 #include "libfsapfs_btree_node.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
-#include "libfsapfs_libfcache.h"
-#include "libfsapfs_libfdata.h"
+#include "libfsapfs_node_cache.h"
 #include "libfsapfs_object_map_descriptor.h"
 
 #if defined( __cplusplus )
@@ -46,17 +46,17 @@ struct libfsapfs_object_map_btree
 	 */
 	libfsapfs_io_handle_t *io_handle;
 
-	/* Data block vector
+	/* The node cache
 	 */
-	libfdata_vector_t *data_block_vector;
+	libfsapfs_node_cache_t *node_cache;
 
-	/* Data block cache
+	/* The number of node cache entries reserved from the IO handle
 	 */
-	libfcache_cache_t *data_block_cache;
+	int number_of_cache_entries;
 
-	/* The node cache
+	/* The table of resolved physical addresses
 	 */
-	libfcache_cache_t *node_cache;
+	libfsapfs_address_table_t *address_table;
 
 	/* Block number of B-tree root node
 	 */
@@ -66,7 +66,6 @@ struct libfsapfs_object_map_btree
 int libfsapfs_object_map_btree_initialize(
      libfsapfs_object_map_btree_t **object_map_btree,
      libfsapfs_io_handle_t *io_handle,
-     libfdata_vector_t *data_block_vector,
      uint64_t root_node_block_number,
      libcerror_error_t **error );
 
@@ -88,6 +87,12 @@ int libfsapfs_object_map_btree_get_sub_node(
      libfsapfs_btree_node_t **sub_node,
      libcerror_error_t **error );
 
+int libfsapfs_object_map_btree_compare_identifier_with_key_data(
+     intptr_t *key_value,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
 int libfsapfs_object_map_btree_get_entry_from_node_by_identifier(
      libfsapfs_object_map_btree_t *object_map_btree,
      libfsapfs_btree_node_t *node,
@@ -113,6 +118,14 @@ int libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
      libfsapfs_object_map_descriptor_t **descriptor,
      libcerror_error_t **error );
 
+int libfsapfs_object_map_btree_get_physical_address_by_object_identifier(
+     libfsapfs_object_map_btree_t *object_map_btree,
+     libbfio_handle_t *file_io_handle,
+     uint64_t object_identifier,
+     uint64_t transaction_identifier,
+     uint64_t *physical_address,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -27,10 +27,12 @@
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
-#include "libfsapfs_libhmac.h"
 #include "libfsapfs_password.h"
+#include "libfsapfs_sha256.h"
 
 /* Compute a PBKDF2-derived key from the given input.
+ * The HMAC-SHA256 inner and outer hash states of the password are calculated once,
+ * after which every iteration only requires 2 SHA-256 block transformations
  * Returns 1 if successful or -1 on error
  */
 int libfsapfs_password_pbkdf2(
@@ -43,20 +45,23 @@ int libfsapfs_password_pbkdf2(
      size_t output_data_size,
      libcerror_error_t **error )
 {
-	uint8_t hash_buffer[ LIBHMAC_SHA256_HASH_SIZE ];
-
-	uint8_t *data_buffer       = NULL;
-	uint8_t *output_ptr        = NULL;
-	static char *function      = "libfsapfs_password_pbkdf2";
-	size_t block_offset        = 0;
-	size_t data_buffer_size    = 0;
-	size_t hash_size           = LIBHMAC_SHA256_HASH_SIZE;
-	size_t remaining_data_size = 0;
-	uint32_t block_index       = 0;
-	uint32_t byte_index        = 0;
-	uint32_t number_of_blocks  = 0;
-	uint32_t password_iterator = 0;
-	int result                 = 0;
+	uint8_t block_index_data[ 4 ];
+	uint8_t hash_block[ LIBFSAPFS_SHA256_BLOCK_SIZE ];
+	uint8_t key_block[ LIBFSAPFS_SHA256_BLOCK_SIZE ];
+	uint8_t output_hash[ LIBFSAPFS_SHA256_HASH_SIZE ];
+	uint32_t hash_values[ 8 ];
+
+	libfsapfs_sha256_context_t context;
+	libfsapfs_sha256_context_t inner_context;
+	libfsapfs_sha256_context_t outer_context;
+
+	static char *function     = "libfsapfs_password_pbkdf2";
+	size_t block_offset       = 0;
+	size_t byte_index         = 0;
+	size_t read_size          = 0;
+	uint32_t block_index      = 0;
+	uint32_t iteration_index  = 0;
+	uint8_t value_32bit_index = 0;
 
 	if( password == NULL )
 	{
@@ -135,284 +140,446 @@ int libfsapfs_password_pbkdf2(
 
 		return( -1 );
 	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: password:\n",
+		 function );
+		libcnotify_print_data(
+		 password,
+		 password_size,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: salt:\n",
+		 function );
+		libcnotify_print_data(
+		 salt,
+		 salt_size,
+		 0 );
+
+		libcnotify_printf(
+		 "%s: number of iterations\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_iterations );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
 	if( memory_set(
-	     output_data,
+	     key_block,
 	     0,
-	     output_data_size ) == NULL )
+	     LIBFSAPFS_SHA256_BLOCK_SIZE ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to clear output data.",
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear key block.",
 		 function );
 
 		goto on_error;
 	}
-/* TODO add bounds check */
-	number_of_blocks    = output_data_size / hash_size;
-	remaining_data_size = output_data_size - ( number_of_blocks * hash_size );
-	data_buffer_size    = salt_size + 4;
+	/* A HMAC key that exceeds the block size is replaced by its hash
+	 */
+	if( password_size > LIBFSAPFS_SHA256_BLOCK_SIZE )
+	{
+		if( libfsapfs_sha256_context_initialize(
+		     &context,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize SHA-256 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_sha256_context_update(
+		     &context,
+		     password,
+		     password_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA-256 context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfsapfs_sha256_context_finalize(
+		     &context,
+		     key_block,
+		     LIBFSAPFS_SHA256_BLOCK_SIZE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA-256 context.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( password_size > 0 )
+	{
+		if( memory_copy(
+		     key_block,
+		     password,
+		     password_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy password to key block.",
+			 function );
 
-	if( data_buffer_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			goto on_error;
+		}
+	}
+	/* Calculate the inner and outer hash states of the HMAC key
+	 */
+	for( byte_index = 0;
+	     byte_index < LIBFSAPFS_SHA256_BLOCK_SIZE;
+	     byte_index++ )
+	{
+		key_block[ byte_index ] ^= 0x36;
+	}
+	if( libfsapfs_sha256_context_initialize(
+	     &inner_context,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid data buffer size value exceeds maximum allocation size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize inner SHA-256 context.",
 		 function );
 
 		goto on_error;
 	}
-	data_buffer = (uint8_t *) memory_allocate(
-	                           sizeof( uint8_t ) * data_buffer_size );
-
-	if( data_buffer == NULL )
+	if( libfsapfs_sha256_context_update(
+	     &inner_context,
+	     key_block,
+	     LIBFSAPFS_SHA256_BLOCK_SIZE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create data buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update inner SHA-256 context.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_set(
-	     data_buffer,
-	     0,
-	     data_buffer_size ) == NULL )
+	for( byte_index = 0;
+	     byte_index < LIBFSAPFS_SHA256_BLOCK_SIZE;
+	     byte_index++ )
+	{
+		key_block[ byte_index ] ^= 0x36 ^ 0x5c;
+	}
+	if( libfsapfs_sha256_context_initialize(
+	     &outer_context,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to clear data buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize outer SHA-256 context.",
 		 function );
 
 		goto on_error;
 	}
-	if( memory_copy(
-	     data_buffer,
-	     salt,
-	     salt_size ) == NULL)
+	if( libfsapfs_sha256_context_update(
+	     &outer_context,
+	     key_block,
+	     LIBFSAPFS_SHA256_BLOCK_SIZE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy salt into data buffer.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to update outer SHA-256 context.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* The HMAC of an iteration hashes the 32 bytes of the previous HMAC after the
+	 * 64 bytes of the key block, hence the padding of the hash block is the same for
+	 * every iteration: a 1-bit, 0-bits and the data size of 96 bytes in bits
+	 */
+	if( memory_set(
+	     hash_block,
+	     0,
+	     LIBFSAPFS_SHA256_BLOCK_SIZE ) == NULL )
 	{
-		libcnotify_printf(
-		 "%s: password:\n",
-		 function );
-		libcnotify_print_data(
-		 password,
-		 password_size,
-		 0 );
-
-		libcnotify_printf(
-		 "%s: data buffer:\n",
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash block.",
 		 function );
-		libcnotify_print_data(
-		 data_buffer,
-		 data_buffer_size,
-		 0 );
 
-		libcnotify_printf(
-		 "%s: number of iterations\t\t\t\t: %" PRIu32 "\n",
-		 function,
-		 number_of_iterations );
+		goto on_error;
+	}
+	hash_block[ LIBFSAPFS_SHA256_HASH_SIZE ] = 0x80;
 
-		libcnotify_printf(
-		 "%s: number of blocks\t\t\t\t: %" PRIu32 "\n",
-		 function,
-		 number_of_blocks );
+	byte_stream_copy_from_uint64_big_endian(
+	 &( hash_block[ LIBFSAPFS_SHA256_BLOCK_SIZE - 8 ] ),
+	 (uint64_t) ( LIBFSAPFS_SHA256_BLOCK_SIZE + LIBFSAPFS_SHA256_HASH_SIZE ) * 8 );
 
-		libcnotify_printf(
-		 "%s: remaining data size\t\t\t\t: %" PRIzd "\n",
-		 function,
-		 remaining_data_size );
-
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	for( block_index = 0;
-	     block_index < number_of_blocks;
-	     block_index++ )
+	while( block_offset < output_data_size )
 	{
-		output_ptr = &( output_data[ block_offset ] );
+		block_index += 1;
 
 		byte_stream_copy_from_uint32_big_endian(
-		 &( data_buffer[ salt_size ] ),
-		 block_index + 1 );
-
-               	result = libhmac_sha256_calculate_hmac(
-		          password,
-		          password_size,
-		          data_buffer,
-		          data_buffer_size,
-		          hash_buffer,
-		          hash_size,
-		          error );
-
-		if( result != 1 )
+		 block_index_data,
+		 block_index );
+
+		/* The first iteration calculates: HMAC( password, salt | block index )
+		 */
+		context = inner_context;
+
+		if( libfsapfs_sha256_context_update(
+		     &context,
+		     salt,
+		     salt_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compute initial hmac for block %d.",
-			 function,
-			 block_index );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA-256 context with salt.",
+			 function );
 
 			goto on_error;
 		}
-		if( memory_copy(
-		     output_ptr,
-		     hash_buffer,
-		     hash_size ) == NULL )
+		if( libfsapfs_sha256_context_update(
+		     &context,
+		     block_index_data,
+		     4,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy hash buffer into output data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA-256 context with block index.",
 			 function );
 
 			goto on_error;
 		}
-		for( password_iterator = 0;
-		     password_iterator < number_of_iterations - 1;
-		     password_iterator++ )
+		if( libfsapfs_sha256_context_finalize(
+		     &context,
+		     hash_block,
+		     LIBFSAPFS_SHA256_HASH_SIZE,
+		     error ) != 1 )
 		{
-			result = libhmac_sha256_calculate_hmac(
-			          password,
-			          password_size,
-			          hash_buffer,
-			          hash_size,
-			          hash_buffer,
-			          hash_size,
-			          error );
-
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compute initial hmac for block %d.",
-				 function,
-				 block_index);
-
-				goto on_error;
-			}
-			for( byte_index = 0;
-			     byte_index < hash_size;
-			     byte_index++ )
-			{
-				output_ptr[ byte_index ] ^= hash_buffer[ byte_index ];
-			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA-256 context.",
+			 function );
+
+			goto on_error;
 		}
-		block_offset += hash_size;
-	}
-	if( remaining_data_size > 0 )
-	{
-		output_ptr = &( output_data[ block_offset ] );
+		context = outer_context;
 
-		byte_stream_copy_from_uint32_big_endian(
-		 &( data_buffer[ salt_size ] ),
-		 block_index + 1 );
-
-		result = libhmac_sha256_calculate_hmac(
-		          password,
-		          password_size,
-		          data_buffer,
-		          data_buffer_size,
-		          hash_buffer,
-		          hash_size,
-		          error );
-
-		if( result != 1 )
+		if( libfsapfs_sha256_context_update(
+		     &context,
+		     hash_block,
+		     LIBFSAPFS_SHA256_HASH_SIZE,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compute initial hmac for block %d.",
-			 function,
-			 block_index);
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to update SHA-256 context.",
+			 function );
 
 			goto on_error;
 		}
-		if( memory_copy(
-		     output_ptr,
-		     hash_buffer,
-		     remaining_data_size ) == NULL )
+		if( libfsapfs_sha256_context_finalize(
+		     &context,
+		     hash_block,
+		     LIBFSAPFS_SHA256_HASH_SIZE,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy hash buffer into output data in last block.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to finalize SHA-256 context.",
 			 function );
 
 			goto on_error;
 		}
-		for( password_iterator = 0;
-		     password_iterator < number_of_iterations - 1;
-		     password_iterator++ )
+		for( byte_index = 0;
+		     byte_index < LIBFSAPFS_SHA256_HASH_SIZE;
+		     byte_index++ )
+		{
+			output_hash[ byte_index ] = hash_block[ byte_index ];
+		}
+		/* The remaining iterations calculate: HMAC( password, previous HMAC )
+		 * directly from the inner and outer hash states
+		 */
+		for( iteration_index = 1;
+		     iteration_index < number_of_iterations;
+		     iteration_index++ )
 		{
-			result = libhmac_sha256_calculate_hmac(
-			          password,
-			          password_size,
-			          hash_buffer,
-			          hash_size,
-			          hash_buffer,
-			          hash_size,
-			          error );
-
-			if( result != 1 )
+			for( value_32bit_index = 0;
+			     value_32bit_index < 8;
+			     value_32bit_index++ )
+			{
+				hash_values[ value_32bit_index ] = inner_context.hash_values[ value_32bit_index ];
+			}
+			libfsapfs_sha256_transform(
+			 hash_values,
+			 hash_block,
+			 1 );
+
+			for( value_32bit_index = 0;
+			     value_32bit_index < 8;
+			     value_32bit_index++ )
+			{
+				byte_stream_copy_from_uint32_big_endian(
+				 &( hash_block[ value_32bit_index * 4 ] ),
+				 hash_values[ value_32bit_index ] );
+
+				hash_values[ value_32bit_index ] = outer_context.hash_values[ value_32bit_index ];
+			}
+			libfsapfs_sha256_transform(
+			 hash_values,
+			 hash_block,
+			 1 );
+
+			for( value_32bit_index = 0;
+			     value_32bit_index < 8;
+			     value_32bit_index++ )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to compute initial hmac for block %d.",
-				 function,
-				 block_index );
-
-				goto on_error;
+				byte_stream_copy_from_uint32_big_endian(
+				 &( hash_block[ value_32bit_index * 4 ] ),
+				 hash_values[ value_32bit_index ] );
 			}
 			for( byte_index = 0;
-			     byte_index < remaining_data_size;
+			     byte_index < LIBFSAPFS_SHA256_HASH_SIZE;
 			     byte_index++ )
 			{
-				output_ptr[ byte_index ] ^= hash_buffer[ byte_index ];
+				output_hash[ byte_index ] ^= hash_block[ byte_index ];
 			}
 		}
+		read_size = output_data_size - block_offset;
+
+		if( read_size > LIBFSAPFS_SHA256_HASH_SIZE )
+		{
+			read_size = LIBFSAPFS_SHA256_HASH_SIZE;
+		}
+		if( memory_copy(
+		     &( output_data[ block_offset ] ),
+		     output_hash,
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy hash of block: %" PRIu32 " to output data.",
+			 function,
+			 block_index );
+
+			goto on_error;
+		}
+		block_offset += read_size;
 	}
-	if( data_buffer != NULL )
-	{
-		memory_free(
-		 data_buffer );
-	}
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libfsapfs_sha256_context_t ) );
+
+	memory_set(
+	 &inner_context,
+	 0,
+	 sizeof( libfsapfs_sha256_context_t ) );
+
+	memory_set(
+	 &outer_context,
+	 0,
+	 sizeof( libfsapfs_sha256_context_t ) );
+
+	memory_set(
+	 hash_block,
+	 0,
+	 LIBFSAPFS_SHA256_BLOCK_SIZE );
+
+	memory_set(
+	 hash_values,
+	 0,
+	 sizeof( uint32_t ) * 8 );
+
+	memory_set(
+	 key_block,
+	 0,
+	 LIBFSAPFS_SHA256_BLOCK_SIZE );
+
+	memory_set(
+	 output_hash,
+	 0,
+	 LIBFSAPFS_SHA256_HASH_SIZE );
+
 	return( 1 );
 
 on_error:
-	if( data_buffer != NULL )
-	{
-		memory_free(
-		 data_buffer );
-	}
+	memory_set(
+	 &context,
+	 0,
+	 sizeof( libfsapfs_sha256_context_t ) );
+
+	memory_set(
+	 &inner_context,
+	 0,
+	 sizeof( libfsapfs_sha256_context_t ) );
+
+	memory_set(
+	 &outer_context,
+	 0,
+	 sizeof( libfsapfs_sha256_context_t ) );
+
+	memory_set(
+	 hash_block,
+	 0,
+	 LIBFSAPFS_SHA256_BLOCK_SIZE );
+
+	memory_set(
+	 hash_values,
+	 0,
+	 sizeof( uint32_t ) * 8 );
+
+	memory_set(
+	 key_block,
+	 0,
+	 LIBFSAPFS_SHA256_BLOCK_SIZE );
+
+	memory_set(
+	 output_hash,
+	 0,
+	 LIBFSAPFS_SHA256_HASH_SIZE );
+
 	return( -1 );
 }
 
@@ -0,0 +1,582 @@
+/*
+ * SHA-256 functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_sha256.h"
+
+/* The SHA-256 instructions of the SHA extensions (SHA-NI) are used if supported
+ * by the compiler and the CPU the library runs on
+ */
+#if ( ( defined( __GNUC__ ) && ( __GNUC__ >= 5 ) ) || defined( __clang__ ) ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#define LIBFSAPFS_SHA256_HAVE_SHA_EXTENSIONS	1
+
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+/* The first 32 bits of the fractional parts of the square roots of the first 8 primes
+ */
+static const uint32_t libfsapfs_sha256_initial_hash_values[ 8 ] = {
+	0x6a09e667UL, 0xbb67ae85UL, 0x3c6ef372UL, 0xa54ff53aUL,
+	0x510e527fUL, 0x9b05688cUL, 0x1f83d9abUL, 0x5be0cd19UL };
+
+/* The first 32 bits of the fractional parts of the cube roots of the first 64 primes
+ */
+static const uint32_t libfsapfs_sha256_prime_cube_roots[ 64 ] = {
+	0x428a2f98UL, 0x71374491UL, 0xb5c0fbcfUL, 0xe9b5dba5UL, 0x3956c25bUL, 0x59f111f1UL, 0x923f82a4UL, 0xab1c5ed5UL,
+	0xd807aa98UL, 0x12835b01UL, 0x243185beUL, 0x550c7dc3UL, 0x72be5d74UL, 0x80deb1feUL, 0x9bdc06a7UL, 0xc19bf174UL,
+	0xe49b69c1UL, 0xefbe4786UL, 0x0fc19dc6UL, 0x240ca1ccUL, 0x2de92c6fUL, 0x4a7484aaUL, 0x5cb0a9dcUL, 0x76f988daUL,
+	0x983e5152UL, 0xa831c66dUL, 0xb00327c8UL, 0xbf597fc7UL, 0xc6e00bf3UL, 0xd5a79147UL, 0x06ca6351UL, 0x14292967UL,
+	0x27b70a85UL, 0x2e1b2138UL, 0x4d2c6dfcUL, 0x53380d13UL, 0x650a7354UL, 0x766a0abbUL, 0x81c2c92eUL, 0x92722c85UL,
+	0xa2bfe8a1UL, 0xa81a664bUL, 0xc24b8b70UL, 0xc76c51a3UL, 0xd192e819UL, 0xd6990624UL, 0xf40e3585UL, 0x106aa070UL,
+	0x19a4c116UL, 0x1e376c08UL, 0x2748774cUL, 0x34b0bcb5UL, 0x391c0cb3UL, 0x4ed8aa4aUL, 0x5b9cca4fUL, 0x682e6ff3UL,
+	0x748f82eeUL, 0x78a5636fUL, 0x84c87814UL, 0x8cc70208UL, 0x90befffaUL, 0xa4506cebUL, 0xbef9a3f7UL, 0xc67178f2UL };
+
+#if defined( LIBFSAPFS_SHA256_HAVE_SHA_EXTENSIONS )
+
+/* Value to indicate the CPU supports the SHA extensions, where -1 represents not determined
+ * The value is accessed atomically since multiple threads can determine it at the same time,
+ * which is harmless since every thread determines the same value
+ */
+static int libfsapfs_sha256_have_sha_extensions = -1;
+
+#endif
+
+#define libfsapfs_sha256_rotate_right( value, number_of_bits ) \
+	( ( ( value ) >> ( number_of_bits ) ) | ( ( value ) << ( 32 - ( number_of_bits ) ) ) )
+
+#define libfsapfs_sha256_round( a, b, c, d, e, f, g, h, round_index ) \
+	temporary_value1 = h \
+	                 + ( libfsapfs_sha256_rotate_right( e, 6 ) ^ libfsapfs_sha256_rotate_right( e, 11 ) ^ libfsapfs_sha256_rotate_right( e, 25 ) ) \
+	                 + ( ( e & f ) ^ ( ~e & g ) ) \
+	                 + libfsapfs_sha256_prime_cube_roots[ round_index ] \
+	                 + values_32bit[ round_index ]; \
+	temporary_value2 = ( libfsapfs_sha256_rotate_right( a, 2 ) ^ libfsapfs_sha256_rotate_right( a, 13 ) ^ libfsapfs_sha256_rotate_right( a, 22 ) ) \
+	                 + ( ( a & b ) ^ ( a & c ) ^ ( b & c ) ); \
+	d += temporary_value1; \
+	h  = temporary_value1 + temporary_value2;
+
+/* Calculates the SHA-256 hash of blocks of data using generic C code
+ */
+static void libfsapfs_sha256_transform_generic(
+             uint32_t *hash_values,
+             const uint8_t *data,
+             size_t number_of_blocks )
+{
+	uint32_t values_32bit[ 64 ];
+
+	uint32_t a                = 0;
+	uint32_t b                = 0;
+	uint32_t c                = 0;
+	uint32_t d                = 0;
+	uint32_t e                = 0;
+	uint32_t f                = 0;
+	uint32_t g                = 0;
+	uint32_t h                = 0;
+	uint32_t s0               = 0;
+	uint32_t s1               = 0;
+	uint32_t temporary_value1 = 0;
+	uint32_t temporary_value2 = 0;
+	uint8_t value_32bit_index = 0;
+
+	while( number_of_blocks > 0 )
+	{
+		for( value_32bit_index = 0;
+		     value_32bit_index < 16;
+		     value_32bit_index++ )
+		{
+			byte_stream_copy_to_uint32_big_endian(
+			 &( data[ value_32bit_index * 4 ] ),
+			 values_32bit[ value_32bit_index ] );
+		}
+		for( value_32bit_index = 16;
+		     value_32bit_index < 64;
+		     value_32bit_index++ )
+		{
+			s0 = values_32bit[ value_32bit_index - 15 ];
+			s0 = libfsapfs_sha256_rotate_right( s0, 7 ) ^ libfsapfs_sha256_rotate_right( s0, 18 ) ^ ( s0 >> 3 );
+
+			s1 = values_32bit[ value_32bit_index - 2 ];
+			s1 = libfsapfs_sha256_rotate_right( s1, 17 ) ^ libfsapfs_sha256_rotate_right( s1, 19 ) ^ ( s1 >> 10 );
+
+			values_32bit[ value_32bit_index ] = values_32bit[ value_32bit_index - 16 ]
+			                                  + s0
+			                                  + values_32bit[ value_32bit_index - 7 ]
+			                                  + s1;
+		}
+		a = hash_values[ 0 ];
+		b = hash_values[ 1 ];
+		c = hash_values[ 2 ];
+		d = hash_values[ 3 ];
+		e = hash_values[ 4 ];
+		f = hash_values[ 5 ];
+		g = hash_values[ 6 ];
+		h = hash_values[ 7 ];
+
+		/* The working variables are rotated by renaming them instead of moving the values
+		 */
+		for( value_32bit_index = 0;
+		     value_32bit_index < 64;
+		     value_32bit_index += 8 )
+		{
+			libfsapfs_sha256_round( a, b, c, d, e, f, g, h, value_32bit_index );
+			libfsapfs_sha256_round( h, a, b, c, d, e, f, g, value_32bit_index + 1 );
+			libfsapfs_sha256_round( g, h, a, b, c, d, e, f, value_32bit_index + 2 );
+			libfsapfs_sha256_round( f, g, h, a, b, c, d, e, value_32bit_index + 3 );
+			libfsapfs_sha256_round( e, f, g, h, a, b, c, d, value_32bit_index + 4 );
+			libfsapfs_sha256_round( d, e, f, g, h, a, b, c, value_32bit_index + 5 );
+			libfsapfs_sha256_round( c, d, e, f, g, h, a, b, value_32bit_index + 6 );
+			libfsapfs_sha256_round( b, c, d, e, f, g, h, a, value_32bit_index + 7 );
+		}
+		hash_values[ 0 ] += a;
+		hash_values[ 1 ] += b;
+		hash_values[ 2 ] += c;
+		hash_values[ 3 ] += d;
+		hash_values[ 4 ] += e;
+		hash_values[ 5 ] += f;
+		hash_values[ 6 ] += g;
+		hash_values[ 7 ] += h;
+
+		data             += LIBFSAPFS_SHA256_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+}
+
+#if defined( LIBFSAPFS_SHA256_HAVE_SHA_EXTENSIONS )
+
+/* Calculates the SHA-256 hash of blocks of data using the SHA extensions
+ * Every iteration calculates 4 rounds, where the SHA256MSG1 and SHA256MSG2 instructions
+ * calculate the message schedule 4 values at a time
+ */
+__attribute__((target("sha,sse4.1")))
+static void libfsapfs_sha256_transform_sha_extensions(
+             uint32_t *hash_values,
+             const uint8_t *data,
+             size_t number_of_blocks )
+{
+	__m128i messages[ 4 ];
+
+	__m128i abef_save        = _mm_setzero_si128();
+	__m128i byte_order_mask  = _mm_set_epi64x( 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL );
+	__m128i cdgh_save        = _mm_setzero_si128();
+	__m128i message          = _mm_setzero_si128();
+	__m128i state0           = _mm_setzero_si128();
+	__m128i state1           = _mm_setzero_si128();
+	__m128i temporary_value  = _mm_setzero_si128();
+	uint8_t group_index      = 0;
+
+	/* The SHA256RNDS2 instruction operates on the hash values in the order: ABEF and CDGH
+	 */
+	temporary_value = _mm_loadu_si128(
+	                   (const __m128i *) &( hash_values[ 0 ] ) );
+
+	state1 = _mm_loadu_si128(
+	          (const __m128i *) &( hash_values[ 4 ] ) );
+
+	temporary_value = _mm_shuffle_epi32( temporary_value, 0xb1 );
+	state1          = _mm_shuffle_epi32( state1, 0x1b );
+	state0          = _mm_alignr_epi8( temporary_value, state1, 8 );
+	state1          = _mm_blend_epi16( state1, temporary_value, 0xf0 );
+
+	while( number_of_blocks > 0 )
+	{
+		abef_save = state0;
+		cdgh_save = state1;
+
+		for( group_index = 0;
+		     group_index < 16;
+		     group_index++ )
+		{
+			if( group_index < 4 )
+			{
+				messages[ group_index ] = _mm_shuffle_epi8(
+				                           _mm_loadu_si128(
+				                            (const __m128i *) &( data[ group_index * 16 ] ) ),
+				                           byte_order_mask );
+			}
+			message = _mm_add_epi32(
+			           messages[ group_index % 4 ],
+			           _mm_loadu_si128(
+			            (const __m128i *) &( libfsapfs_sha256_prime_cube_roots[ group_index * 4 ] ) ) );
+
+			state1 = _mm_sha256rnds2_epu32( state1, state0, message );
+
+			if( ( group_index >= 3 )
+			 && ( group_index <= 14 ) )
+			{
+				temporary_value = _mm_alignr_epi8(
+				                   messages[ group_index % 4 ],
+				                   messages[ ( group_index + 3 ) % 4 ],
+				                   4 );
+
+				messages[ ( group_index + 1 ) % 4 ] = _mm_sha256msg2_epu32(
+				                                       _mm_add_epi32( messages[ ( group_index + 1 ) % 4 ], temporary_value ),
+				                                       messages[ group_index % 4 ] );
+			}
+			message = _mm_shuffle_epi32( message, 0x0e );
+			state0  = _mm_sha256rnds2_epu32( state0, state1, message );
+
+			if( ( group_index >= 1 )
+			 && ( group_index <= 12 ) )
+			{
+				messages[ ( group_index + 3 ) % 4 ] = _mm_sha256msg1_epu32(
+				                                       messages[ ( group_index + 3 ) % 4 ],
+				                                       messages[ group_index % 4 ] );
+			}
+		}
+		state0 = _mm_add_epi32( state0, abef_save );
+		state1 = _mm_add_epi32( state1, cdgh_save );
+
+		data             += LIBFSAPFS_SHA256_BLOCK_SIZE;
+		number_of_blocks -= 1;
+	}
+	temporary_value = _mm_shuffle_epi32( state0, 0x1b );
+	state1          = _mm_shuffle_epi32( state1, 0xb1 );
+	state0          = _mm_blend_epi16( temporary_value, state1, 0xf0 );
+	state1          = _mm_alignr_epi8( state1, temporary_value, 8 );
+
+	_mm_storeu_si128(
+	 (__m128i *) &( hash_values[ 0 ] ),
+	 state0 );
+
+	_mm_storeu_si128(
+	 (__m128i *) &( hash_values[ 4 ] ),
+	 state1 );
+}
+
+#endif /* defined( LIBFSAPFS_SHA256_HAVE_SHA_EXTENSIONS ) */
+
+/* Calculates the SHA-256 hash of blocks of data
+ * The hash values are updated in-place and the data must contain number of blocks * 64 bytes
+ */
+void libfsapfs_sha256_transform(
+      uint32_t *hash_values,
+      const uint8_t *data,
+      size_t number_of_blocks )
+{
+#if defined( LIBFSAPFS_SHA256_HAVE_SHA_EXTENSIONS )
+	unsigned int eax        = 0;
+	unsigned int ebx        = 0;
+	unsigned int ecx        = 0;
+	unsigned int edx        = 0;
+	int have_sha_extensions = 0;
+
+	have_sha_extensions = __atomic_load_n(
+	                       &libfsapfs_sha256_have_sha_extensions,
+	                       __ATOMIC_RELAXED );
+
+	if( have_sha_extensions == -1 )
+	{
+		/* CPUID leaf 7 EBX bit 29 indicates support of the SHA extensions
+		 * and leaf 1 ECX bit 19 support of SSE4.1
+		 */
+		if( ( __get_cpuid_count( 7, 0, &eax, &ebx, &ecx, &edx ) != 0 )
+		 && ( ( ebx & 0x20000000UL ) != 0 )
+		 && ( __get_cpuid( 1, &eax, &ebx, &ecx, &edx ) != 0 )
+		 && ( ( ecx & 0x00080000UL ) != 0 ) )
+		{
+			have_sha_extensions = 1;
+		}
+		else
+		{
+			have_sha_extensions = 0;
+		}
+		__atomic_store_n(
+		 &libfsapfs_sha256_have_sha_extensions,
+		 have_sha_extensions,
+		 __ATOMIC_RELAXED );
+	}
+	if( have_sha_extensions != 0 )
+	{
+		libfsapfs_sha256_transform_sha_extensions(
+		 hash_values,
+		 data,
+		 number_of_blocks );
+
+		return;
+	}
+#endif /* defined( LIBFSAPFS_SHA256_HAVE_SHA_EXTENSIONS ) */
+
+	libfsapfs_sha256_transform_generic(
+	 hash_values,
+	 data,
+	 number_of_blocks );
+}
+
+/* Initializes a SHA-256 context
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_sha256_context_initialize(
+     libfsapfs_sha256_context_t *context,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_sha256_context_initialize";
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     context->hash_values,
+	     libfsapfs_sha256_initial_hash_values,
+	     sizeof( uint32_t ) * 8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy initial hash values.",
+		 function );
+
+		return( -1 );
+	}
+	context->hash_count   = 0;
+	context->block_offset = 0;
+
+	return( 1 );
+}
+
+/* Updates the SHA-256 context
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_sha256_context_update(
+     libfsapfs_sha256_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfsapfs_sha256_context_update";
+	size_t number_of_blocks = 0;
+	size_t read_size        = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	context->hash_count += data_size;
+
+	if( context->block_offset > 0 )
+	{
+		read_size = LIBFSAPFS_SHA256_BLOCK_SIZE - context->block_offset;
+
+		if( read_size > data_size )
+		{
+			read_size = data_size;
+		}
+		if( memory_copy(
+		     &( context->block[ context->block_offset ] ),
+		     data,
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_offset += read_size;
+		data                  += read_size;
+		data_size             -= read_size;
+
+		if( context->block_offset < LIBFSAPFS_SHA256_BLOCK_SIZE )
+		{
+			return( 1 );
+		}
+		libfsapfs_sha256_transform(
+		 context->hash_values,
+		 context->block,
+		 1 );
+
+		context->block_offset = 0;
+	}
+	/* Complete blocks are hashed without copying them into the block of the context
+	 */
+	number_of_blocks = data_size / LIBFSAPFS_SHA256_BLOCK_SIZE;
+
+	if( number_of_blocks > 0 )
+	{
+		libfsapfs_sha256_transform(
+		 context->hash_values,
+		 data,
+		 number_of_blocks );
+
+		read_size  = number_of_blocks * LIBFSAPFS_SHA256_BLOCK_SIZE;
+		data      += read_size;
+		data_size -= read_size;
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     context->block,
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data to block.",
+			 function );
+
+			return( -1 );
+		}
+		context->block_offset = data_size;
+	}
+	return( 1 );
+}
+
+/* Finalizes the SHA-256 context
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_sha256_context_finalize(
+     libfsapfs_sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error )
+{
+	static char *function     = "libfsapfs_sha256_context_finalize";
+	uint64_t bit_size         = 0;
+	size_t block_offset       = 0;
+	uint8_t value_32bit_index = 0;
+
+	if( context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid context.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_size < (size_t) LIBFSAPFS_SHA256_HASH_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid hash value too small.",
+		 function );
+
+		return( -1 );
+	}
+	bit_size     = context->hash_count * 8;
+	block_offset = context->block_offset;
+
+	/* The data is padded with a 1-bit, 0-bits and the 64-bit data size in bits
+	 */
+	context->block[ block_offset++ ] = 0x80;
+
+	if( block_offset > ( LIBFSAPFS_SHA256_BLOCK_SIZE - 8 ) )
+	{
+		while( block_offset < LIBFSAPFS_SHA256_BLOCK_SIZE )
+		{
+			context->block[ block_offset++ ] = 0;
+		}
+		libfsapfs_sha256_transform(
+		 context->hash_values,
+		 context->block,
+		 1 );
+
+		block_offset = 0;
+	}
+	while( block_offset < ( LIBFSAPFS_SHA256_BLOCK_SIZE - 8 ) )
+	{
+		context->block[ block_offset++ ] = 0;
+	}
+	byte_stream_copy_from_uint64_big_endian(
+	 &( context->block[ block_offset ] ),
+	 bit_size );
+
+	libfsapfs_sha256_transform(
+	 context->hash_values,
+	 context->block,
+	 1 );
+
+	for( value_32bit_index = 0;
+	     value_32bit_index < 8;
+	     value_32bit_index++ )
+	{
+		byte_stream_copy_from_uint32_big_endian(
+		 &( hash[ value_32bit_index * 4 ] ),
+		 context->hash_values[ value_32bit_index ] );
+	}
+	context->block_offset = 0;
+
+	return( 1 );
+}
+
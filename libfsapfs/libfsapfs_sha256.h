@@ -0,0 +1,88 @@
+/*
+ * SHA-256 functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_SHA256_H )
+#define _LIBFSAPFS_SHA256_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#define LIBFSAPFS_SHA256_BLOCK_SIZE	64
+#define LIBFSAPFS_SHA256_HASH_SIZE	32
+
+typedef struct libfsapfs_sha256_context libfsapfs_sha256_context_t;
+
+/* The SHA-256 context
+ * The context does not contain pointers so that a context with
+ * a partially calculated hash can be copied by assignment
+ */
+struct libfsapfs_sha256_context
+{
+	/* The hash values
+	 */
+	uint32_t hash_values[ 8 ];
+
+	/* The number of bytes hashed
+	 */
+	uint64_t hash_count;
+
+	/* The block data
+	 */
+	uint8_t block[ LIBFSAPFS_SHA256_BLOCK_SIZE ];
+
+	/* The block offset
+	 */
+	size_t block_offset;
+};
+
+int libfsapfs_sha256_context_initialize(
+     libfsapfs_sha256_context_t *context,
+     libcerror_error_t **error );
+
+void libfsapfs_sha256_transform(
+      uint32_t *hash_values,
+      const uint8_t *data,
+      size_t number_of_blocks );
+
+int libfsapfs_sha256_context_update(
+     libfsapfs_sha256_context_t *context,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfsapfs_sha256_context_finalize(
+     libfsapfs_sha256_context_t *context,
+     uint8_t *hash,
+     size_t hash_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_SHA256_H ) */
+
@@ -26,17 +26,14 @@
 
 #include "libfsapfs_btree_entry.h"
 #include "libfsapfs_btree_node.h"
-#include "libfsapfs_data_block.h"
 #include "libfsapfs_debug.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
-#include "libfsapfs_libfcache.h"
-#include "libfsapfs_libfdata.h"
+#include "libfsapfs_node_cache.h"
 #include "libfsapfs_object_map_btree.h"
-#include "libfsapfs_object_map_descriptor.h"
 #include "libfsapfs_snapshot_metadata.h"
 #include "libfsapfs_snapshot_metadata_tree.h"
 
@@ -50,7 +47,6 @@
 int libfsapfs_snapshot_metadata_tree_initialize(
      libfsapfs_snapshot_metadata_tree_t **snapshot_metadata_tree,
      libfsapfs_io_handle_t *io_handle,
-     libfdata_vector_t *data_block_vector,
      libfsapfs_object_map_btree_t *object_map_btree,
      uint64_t root_node_block_number,
      libcerror_error_t **error )
@@ -79,6 +75,17 @@ int libfsapfs_snapshot_metadata_tree_initialize(
 
 		return( -1 );
 	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
 	*snapshot_metadata_tree = memory_allocate_structure(
 	                           libfsapfs_snapshot_metadata_tree_t );
 
@@ -112,23 +119,26 @@ int libfsapfs_snapshot_metadata_tree_initialize(
 
 		return( -1 );
 	}
-	if( libfcache_cache_initialize(
-	     &( ( *snapshot_metadata_tree )->data_block_cache ),
-	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_DATA_BLOCKS,
+	if( libfsapfs_io_handle_reserve_cache_entries(
+	     io_handle,
+	     LIBFSAPFS_CACHE_TYPE_SNAPSHOT_METADATA_NODES,
+	     &( ( *snapshot_metadata_tree )->number_of_cache_entries ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create data block cache.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to reserve node cache entries.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( libfsapfs_node_cache_initialize(
 	     &( ( *snapshot_metadata_tree )->node_cache ),
-	     LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES,
+	     ( *snapshot_metadata_tree )->number_of_cache_entries,
+	     io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_SNAPSHOT_METADATA_NODES - 1 ],
+	     (size64_t) io_handle->block_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -141,7 +151,6 @@ int libfsapfs_snapshot_metadata_tree_initialize(
 		goto on_error;
 	}
 	( *snapshot_metadata_tree )->io_handle              = io_handle;
-	( *snapshot_metadata_tree )->data_block_vector      = data_block_vector;
 	( *snapshot_metadata_tree )->object_map_btree       = object_map_btree;
 	( *snapshot_metadata_tree )->root_node_block_number = root_node_block_number;
 
@@ -150,6 +159,14 @@ int libfsapfs_snapshot_metadata_tree_initialize(
 on_error:
 	if( *snapshot_metadata_tree != NULL )
 	{
+		if( ( *snapshot_metadata_tree )->number_of_cache_entries > 0 )
+		{
+			libfsapfs_io_handle_release_cache_entries(
+			 io_handle,
+			 LIBFSAPFS_CACHE_TYPE_SNAPSHOT_METADATA_NODES,
+			 ( *snapshot_metadata_tree )->number_of_cache_entries,
+			 NULL );
+		}
 		memory_free(
 		 *snapshot_metadata_tree );
 
@@ -181,9 +198,9 @@ int libfsapfs_snapshot_metadata_tree_free(
 	}
 	if( *snapshot_metadata_tree != NULL )
 	{
-		/* The data_block_vector is referenced and freed elsewhere
+		/* The io_handle and object_map_btree are referenced and freed elsewhere
 		 */
-		if( libfcache_cache_free(
+		if( libfsapfs_node_cache_free(
 		     &( ( *snapshot_metadata_tree )->node_cache ),
 		     error ) != 1 )
 		{
@@ -196,15 +213,17 @@ int libfsapfs_snapshot_metadata_tree_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
-		     &( ( *snapshot_metadata_tree )->data_block_cache ),
+		if( libfsapfs_io_handle_release_cache_entries(
+		     ( *snapshot_metadata_tree )->io_handle,
+		     LIBFSAPFS_CACHE_TYPE_SNAPSHOT_METADATA_NODES,
+		     ( *snapshot_metadata_tree )->number_of_cache_entries,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free data block cache.",
+			 "%s: unable to release node cache entries.",
 			 function );
 
 			result = -1;
@@ -228,10 +247,9 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node_block_number_from_entry(
      uint64_t *sub_node_block_number,
      libcerror_error_t **error )
 {
-	libfsapfs_object_map_descriptor_t *object_map_descriptor = NULL;
-	static char *function                                    = "libfsapfs_snapshot_metadata_tree_get_sub_node_block_number_from_entry";
-	uint64_t sub_node_object_identifier                      = 0;
-	int result                                               = 0;
+	static char *function               = "libfsapfs_snapshot_metadata_tree_get_sub_node_block_number_from_entry";
+	uint64_t sub_node_object_identifier = 0;
+	int result                          = 0;
 
 	if( snapshot_metadata_tree == NULL )
 	{
@@ -302,12 +320,12 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node_block_number_from_entry(
 		 transaction_identifier );
 	}
 #endif
-	result = libfsapfs_object_map_btree_get_descriptor_by_object_identifier(
+	result = libfsapfs_object_map_btree_get_physical_address_by_object_identifier(
 	          snapshot_metadata_tree->object_map_btree,
 	          file_io_handle,
 	          sub_node_object_identifier,
 	          transaction_identifier,
-	          &object_map_descriptor,
+	          sub_node_block_number,
 	          error );
 
 	if( result == -1 )
@@ -316,64 +334,30 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node_block_number_from_entry(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve object map descriptor for sub node object identifier: %" PRIu64 " (transaction: %" PRIu64 ").",
+		 "%s: unable to retrieve physical address for sub node object identifier: %" PRIu64 " (transaction: %" PRIu64 ").",
 		 function,
 		 sub_node_object_identifier,
 		 transaction_identifier );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
-	{
-		if( object_map_descriptor == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid object map descriptor.",
-			 function );
-
-			goto on_error;
-		}
 #if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+	if( libcnotify_verbose != 0 )
+	{
+		if( result != 0 )
 		{
 			libcnotify_printf(
 			 "%s: sub node block number: %" PRIu64 "\n",
 			 function,
-			 object_map_descriptor->physical_address );
-		}
-#endif
-		*sub_node_block_number = object_map_descriptor->physical_address;
-
-		if( libfsapfs_object_map_descriptor_free(
-		     &object_map_descriptor,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free object map descriptor.",
-			 function );
-
-			goto on_error;
+			 *sub_node_block_number );
 		}
 	}
+#endif
 	return( result );
-
-on_error:
-	if( object_map_descriptor != NULL )
-	{
-		libfsapfs_object_map_descriptor_free(
-		 &object_map_descriptor,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves the snapshot metadata tree root node
+ * The node is referenced and must be released with libfsapfs_node_cache_release_node
  * Returns 1 if successful or -1 on error
  */
 int libfsapfs_snapshot_metadata_tree_get_root_node(
@@ -383,14 +367,13 @@ int libfsapfs_snapshot_metadata_tree_get_root_node(
      libfsapfs_btree_node_t **root_node,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	libfsapfs_btree_node_t *node         = NULL;
-	libfsapfs_data_block_t *data_block   = NULL;
-	static char *function                = "libfsapfs_snapshot_metadata_tree_get_root_node";
-	int result                           = 0;
+	libfsapfs_btree_node_t *cached_node = NULL;
+	libfsapfs_btree_node_t *node        = NULL;
+	static char *function               = "libfsapfs_snapshot_metadata_tree_get_root_node";
+	int result                          = 0;
 
 #if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
+	int64_t profiler_start_timestamp    = 0;
 #endif
 
 	if( snapshot_metadata_tree == NULL )
@@ -404,17 +387,6 @@ int libfsapfs_snapshot_metadata_tree_get_root_node(
 
 		return( -1 );
 	}
-	if( root_node_block_number > (uint64_t) INT_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid root node block number value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( root_node == NULL )
 	{
 		libcerror_error_set(
@@ -446,12 +418,10 @@ int libfsapfs_snapshot_metadata_tree_get_root_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	result = libfcache_cache_get_value_by_identifier(
+	result = libfsapfs_node_cache_get_node(
 	          snapshot_metadata_tree->node_cache,
-	          0,
-	          (off64_t) root_node_block_number,
-	          0,
-	          &cache_value,
+	          root_node_block_number,
+	          &cached_node,
 	          error );
 
 	if( result == -1 )
@@ -460,44 +430,13 @@ int libfsapfs_snapshot_metadata_tree_get_root_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from cache.",
+		 "%s: unable to retrieve node from cache.",
 		 function );
 
 		goto on_error;
 	}
 	else if( result == 0 )
 	{
-		if( libfdata_vector_get_element_value_by_index(
-		     snapshot_metadata_tree->data_block_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) snapshot_metadata_tree->data_block_cache,
-		     (int) root_node_block_number,
-		     (intptr_t **) &data_block,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data block: %" PRIu64 ".",
-			 function,
-			 root_node_block_number );
-
-			goto on_error;
-		}
-		if( data_block == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data block: %" PRIu64 ".",
-			 function,
-			 root_node_block_number );
-
-			goto on_error;
-		}
 		if( libfsapfs_btree_node_initialize(
 		     &node,
 		     error ) != 1 )
@@ -511,10 +450,12 @@ int libfsapfs_snapshot_metadata_tree_get_root_node(
 
 			goto on_error;
 		}
-		if( libfsapfs_btree_node_read_data(
+		if( libfsapfs_btree_node_read_file_io_handle(
 		     node,
-		     data_block->data,
-		     data_block->data_size,
+		     snapshot_metadata_tree->io_handle,
+		     NULL,
+		     file_io_handle,
+		     root_node_block_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -595,44 +536,22 @@ int libfsapfs_snapshot_metadata_tree_get_root_node(
 
 			goto on_error;
 		}
-		if( libfcache_cache_set_value_by_identifier(
+		if( libfsapfs_node_cache_insert_node(
 		     snapshot_metadata_tree->node_cache,
-		     0,
-		     (off64_t) root_node_block_number,
-		     0,
-		     (intptr_t *) node,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
-		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     &node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value in cache.",
-			 function );
-
-			goto on_error;
-		}
-		node = NULL;
-
-		if( libfcache_cache_get_value_by_identifier(
-		     snapshot_metadata_tree->node_cache,
-		     0,
-		     (off64_t) root_node_block_number,
-		     0,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from cache.",
+			 "%s: unable to insert node into cache.",
 			 function );
 
 			goto on_error;
 		}
+		cached_node = node;
+		node        = NULL;
 	}
 #if defined( HAVE_PROFILER )
 	if( snapshot_metadata_tree->io_handle->profiler != NULL )
@@ -657,23 +576,18 @@ int libfsapfs_snapshot_metadata_tree_get_root_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	if( libfcache_cache_value_get_value(
-	     cache_value,
-	     (intptr_t **) root_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve root node.",
-		 function );
+	*root_node = cached_node;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
+	if( cached_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 snapshot_metadata_tree->node_cache,
+		 &cached_node,
+		 NULL );
+	}
 	if( node != NULL )
 	{
 		libfsapfs_btree_node_free(
@@ -684,6 +598,7 @@ on_error:
 }
 
 /* Retrieves a snapshot metadata tree sub node
+ * The node is referenced and must be released with libfsapfs_node_cache_release_node
  * Returns 1 if successful or -1 on error
  */
 int libfsapfs_snapshot_metadata_tree_get_sub_node(
@@ -693,14 +608,13 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node(
      libfsapfs_btree_node_t **sub_node,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	libfsapfs_btree_node_t *node         = NULL;
-	libfsapfs_data_block_t *data_block   = NULL;
-	static char *function                = "libfsapfs_snapshot_metadata_tree_get_sub_node";
-	int result                           = 0;
+	libfsapfs_btree_node_t *cached_node = NULL;
+	libfsapfs_btree_node_t *node        = NULL;
+	static char *function               = "libfsapfs_snapshot_metadata_tree_get_sub_node";
+	int result                          = 0;
 
 #if defined( HAVE_PROFILER )
-	int64_t profiler_start_timestamp     = 0;
+	int64_t profiler_start_timestamp    = 0;
 #endif
 
 	if( snapshot_metadata_tree == NULL )
@@ -714,17 +628,6 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node(
 
 		return( -1 );
 	}
-	if( sub_node_block_number > (uint64_t) INT_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid sub node block number value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
 	if( sub_node == NULL )
 	{
 		libcerror_error_set(
@@ -756,12 +659,10 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	result = libfcache_cache_get_value_by_identifier(
+	result = libfsapfs_node_cache_get_node(
 	          snapshot_metadata_tree->node_cache,
-	          0,
-	          (off64_t) sub_node_block_number,
-	          0,
-	          &cache_value,
+	          sub_node_block_number,
+	          &cached_node,
 	          error );
 
 	if( result == -1 )
@@ -770,44 +671,13 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value from cache.",
+		 "%s: unable to retrieve node from cache.",
 		 function );
 
 		goto on_error;
 	}
 	else if( result == 0 )
 	{
-		if( libfdata_vector_get_element_value_by_index(
-		     snapshot_metadata_tree->data_block_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) snapshot_metadata_tree->data_block_cache,
-		     (int) sub_node_block_number,
-		     (intptr_t **) &data_block,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve data block: %" PRIu64 ".",
-			 function,
-			 sub_node_block_number );
-
-			goto on_error;
-		}
-		if( data_block == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid data block: %" PRIu64 ".",
-			 function,
-			 sub_node_block_number );
-
-			goto on_error;
-		}
 		if( libfsapfs_btree_node_initialize(
 		     &node,
 		     error ) != 1 )
@@ -821,10 +691,12 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node(
 
 			goto on_error;
 		}
-		if( libfsapfs_btree_node_read_data(
+		if( libfsapfs_btree_node_read_file_io_handle(
 		     node,
-		     data_block->data,
-		     data_block->data_size,
+		     snapshot_metadata_tree->io_handle,
+		     NULL,
+		     file_io_handle,
+		     sub_node_block_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -872,44 +744,22 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node(
 
 			goto on_error;
 		}
-		if( libfcache_cache_set_value_by_identifier(
+		if( libfsapfs_node_cache_insert_node(
 		     snapshot_metadata_tree->node_cache,
-		     0,
-		     (off64_t) sub_node_block_number,
-		     0,
-		     (intptr_t *) node,
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_btree_node_free,
-		     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+		     &node,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value in cache.",
-			 function );
-
-			goto on_error;
-		}
-		node = NULL;
-
-		if( libfcache_cache_get_value_by_identifier(
-		     snapshot_metadata_tree->node_cache,
-		     0,
-		     (off64_t) sub_node_block_number,
-		     0,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve value from cache.",
+			 "%s: unable to insert node into cache.",
 			 function );
 
 			goto on_error;
 		}
+		cached_node = node;
+		node        = NULL;
 	}
 #if defined( HAVE_PROFILER )
 	if( snapshot_metadata_tree->io_handle->profiler != NULL )
@@ -934,23 +784,18 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node(
 	}
 #endif /* defined( HAVE_PROFILER ) */
 
-	if( libfcache_cache_value_get_value(
-	     cache_value,
-	     (intptr_t **) sub_node,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve sub node.",
-		 function );
+	*sub_node = cached_node;
 
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
+	if( cached_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 snapshot_metadata_tree->node_cache,
+		 &cached_node,
+		 NULL );
+	}
 	if( node != NULL )
 	{
 		libfsapfs_btree_node_free(
@@ -960,6 +805,73 @@ on_error:
 	return( -1 );
 }
 
+/* Compares an object identifier with the key data of a snapshot metadata tree entry
+ * The key value contains the lookup object identifier, the data type of the key data is ignored
+ * Returns LIBFSAPFS_COMPARE_LESS, LIBFSAPFS_COMPARE_EQUAL, LIBFSAPFS_COMPARE_GREATER if successful or -1 on error
+ */
+int libfsapfs_snapshot_metadata_tree_compare_identifier_with_key_data(
+     intptr_t *key_value,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error )
+{
+	static char *function                 = "libfsapfs_snapshot_metadata_tree_compare_identifier_with_key_data";
+	uint64_t lookup_identifier            = 0;
+	uint64_t snapshot_metadata_identifier = 0;
+
+	if( key_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key value.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_data_size < 8 )
+	 || ( key_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	lookup_identifier = *( (uint64_t *) key_value );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 key_data,
+	 snapshot_metadata_identifier );
+
+	snapshot_metadata_identifier &= 0x0fffffffffffffffUL;
+
+	if( lookup_identifier < snapshot_metadata_identifier )
+	{
+		return( LIBFSAPFS_COMPARE_LESS );
+	}
+	else if( lookup_identifier > snapshot_metadata_identifier )
+	{
+		return( LIBFSAPFS_COMPARE_GREATER );
+	}
+	return( LIBFSAPFS_COMPARE_EQUAL );
+}
+
 /* Retrieves an entry for a specific identifier from the snapshot metadata tree node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
@@ -970,17 +882,12 @@ int libfsapfs_snapshot_metadata_tree_get_entry_from_node_by_identifier(
      libfsapfs_btree_entry_t **btree_entry,
      libcerror_error_t **error )
 {
-	libfsapfs_btree_entry_t *entry          = NULL;
-	libfsapfs_btree_entry_t *previous_entry = NULL;
-	static char *function                   = "libfsapfs_snapshot_metadata_tree_get_entry_from_node_by_identifier";
-	uint64_t snapshot_metadata_identifier   = 0;
-	int btree_entry_index                   = 0;
-	int is_leaf_node                        = 0;
-	int number_of_entries                   = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t snapshot_metadata_data_type     = 0;
-#endif
+	static char *function      = "libfsapfs_snapshot_metadata_tree_get_entry_from_node_by_identifier";
+	uint64_t lookup_identifier = 0;
+	int btree_entry_index      = 0;
+	int is_leaf_node           = 0;
+	int number_of_entries      = 0;
+	int result                 = 0;
 
 	if( snapshot_metadata_tree == NULL )
 	{
@@ -1042,117 +949,75 @@ int libfsapfs_snapshot_metadata_tree_get_entry_from_node_by_identifier(
 
 		return( -1 );
 	}
-	for( btree_entry_index = 0;
-	     btree_entry_index < number_of_entries;
-	     btree_entry_index++ )
+	if( number_of_entries == 0 )
 	{
-		if( libfsapfs_btree_node_get_entry_by_index(
-		     node,
-		     btree_entry_index,
-		     &entry,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of entries from B-tree node.",
-			 function );
-
-			return( -1 );
-		}
-		if( entry == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d.",
-			 function,
-			 btree_entry_index );
-
-			return( -1 );
-		}
-		if( entry->key_data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid B-tree entry: %d - missing key data.",
-			 function,
-			 btree_entry_index );
-
-			return( -1 );
-		}
-		if( entry->key_data_size < 8 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid B-tree entry: %d - key data size value out of bounds.",
-			 function,
-			 btree_entry_index );
-
-			return( -1 );
-		}
-		byte_stream_copy_to_uint64_little_endian(
-		 entry->key_data,
-		 snapshot_metadata_identifier );
+		return( 0 );
+	}
+	lookup_identifier = object_identifier & 0x0fffffffffffffffUL;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			snapshot_metadata_data_type = (uint8_t) ( snapshot_metadata_identifier >> 60 );
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          node,
+	          (intptr_t *) &lookup_identifier,
+	          &libfsapfs_snapshot_metadata_tree_compare_identifier_with_key_data,
+	          &btree_entry_index,
+	          error );
 
-			libcnotify_printf(
-			 "%s: B-tree entry: %d, identifier: %" PRIu64 ", data type: 0x%" PRIx8 " %s\n",
-			 function,
-			 btree_entry_index,
-			 snapshot_metadata_identifier & 0x0fffffffffffffffUL,
-			 snapshot_metadata_data_type,
-			 libfsapfs_debug_print_file_system_data_type(
-			  snapshot_metadata_data_type ) );
-		}
-#endif
-		snapshot_metadata_identifier &= 0x0fffffffffffffffUL;
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to search B-tree node for identifier: %" PRIu64 ".",
+		 function,
+		 object_identifier );
 
+		return( -1 );
+	}
+	if( result == 0 )
+	{
 		if( is_leaf_node != 0 )
 		{
-			if( snapshot_metadata_identifier == object_identifier )
-			{
-				*btree_entry = entry;
-
-				return( 1 );
-			}
+			return( 0 );
 		}
-		else
+		/* In a branch node the sub node that can contain the identifier
+		 * starts at the last entry with a key that is less than the identifier
+		 */
+		if( btree_entry_index > 0 )
 		{
-			if( snapshot_metadata_identifier >= object_identifier )
-			{
-				if( ( previous_entry == NULL )
-				 || ( snapshot_metadata_identifier == object_identifier ) )
-				{
-					previous_entry = entry;
-				}
-				*btree_entry = previous_entry;
-
-				return( 1 );
-			}
-			previous_entry = entry;
+			btree_entry_index--;
 		}
 	}
-	if( is_leaf_node == 0 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		*btree_entry = previous_entry;
+		libcnotify_printf(
+		 "%s: B-tree entry: %d\n",
+		 function,
+		 btree_entry_index );
+	}
+#endif
+	if( libfsapfs_btree_node_get_entry_by_index(
+	     node,
+	     btree_entry_index,
+	     btree_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d from B-tree node.",
+		 function,
+		 btree_entry_index );
 
-		return( 1 );
+		return( -1 );
 	}
-	return( 0 );
+	return( 1 );
 }
 
 /* Retrieves an entry for a specific identifier from the snapshot metadata tree
+ * The B-tree node is referenced and must be released with libfsapfs_node_cache_release_node
  * Returns 1 if successful, 0 if not found or -1 on error
  */
 int libfsapfs_snapshot_metadata_tree_get_entry_by_identifier(
@@ -1232,7 +1097,7 @@ int libfsapfs_snapshot_metadata_tree_get_entry_by_identifier(
 			 "%s: invalid recursion depth value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		is_leaf_node = libfsapfs_btree_node_is_leaf_node(
 		                node,
@@ -1247,7 +1112,7 @@ int libfsapfs_snapshot_metadata_tree_get_entry_by_identifier(
 			 "%s: unable to determine if B-tree node is a leaf node.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		result = libfsapfs_snapshot_metadata_tree_get_entry_from_node_by_identifier(
 		          snapshot_metadata_tree,
@@ -1265,7 +1130,7 @@ int libfsapfs_snapshot_metadata_tree_get_entry_by_identifier(
 			 "%s: unable to retrieve entry from B-tree node.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		else if( result == 0 )
 		{
@@ -1287,7 +1152,7 @@ int libfsapfs_snapshot_metadata_tree_get_entry_by_identifier(
 			 "%s: invalid B-tree entry.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( entry->value_data == NULL )
 		{
@@ -1298,7 +1163,7 @@ int libfsapfs_snapshot_metadata_tree_get_entry_by_identifier(
 			 "%s: invalid B-tree entry - missing value data.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( entry->value_data_size != 8 )
 		{
@@ -1309,7 +1174,7 @@ int libfsapfs_snapshot_metadata_tree_get_entry_by_identifier(
 			 "%s: invalid B-tree entry - unsupported value data size.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		byte_stream_copy_to_uint64_little_endian(
 		 entry->value_data,
@@ -1324,7 +1189,20 @@ int libfsapfs_snapshot_metadata_tree_get_entry_by_identifier(
 			 sub_node_block_number );
 		}
 #endif
-		node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     snapshot_metadata_tree->node_cache,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 
 		if( libfsapfs_snapshot_metadata_tree_get_sub_node(
 		     snapshot_metadata_tree,
@@ -1341,13 +1219,37 @@ int libfsapfs_snapshot_metadata_tree_get_entry_by_identifier(
 			 function,
 			 sub_node_block_number );
 
-			return( -1 );
+			goto on_error;
 		}
 		recursion_depth++;
 	}
 	while( is_leaf_node == 0 );
 
+	if( libfsapfs_node_cache_release_node(
+	     snapshot_metadata_tree->node_cache,
+	     &node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 	return( 0 );
+
+on_error:
+	if( node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 snapshot_metadata_tree->node_cache,
+		 &node,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Retrieves the snapshot metadata of a specific object identifier
@@ -1484,11 +1386,31 @@ int libfsapfs_snapshot_metadata_tree_get_metadata_by_object_identifier(
 
 			goto on_error;
 		}
-		node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     snapshot_metadata_tree->node_cache,
+		     &node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( result );
 
 on_error:
+	if( node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 snapshot_metadata_tree->node_cache,
+		 &node,
+		 NULL );
+	}
 	if( *metadata != NULL )
 	{
 		libfsapfs_snapshot_metadata_free(
@@ -1996,11 +1918,31 @@ int libfsapfs_snapshot_metadata_tree_get_snapshots_from_branch_node(
 		{
 			found_snapshot_metadata = 1;
 		}
-		sub_node = NULL;
+		if( libfsapfs_node_cache_release_node(
+		     snapshot_metadata_tree->node_cache,
+		     &sub_node,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release B-tree node.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	return( found_snapshot_metadata );
 
 on_error:
+	if( sub_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 snapshot_metadata_tree->node_cache,
+		 &sub_node,
+		 NULL );
+	}
 	libcdata_array_empty(
 	 snapshots,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_snapshot_metadata_free,
@@ -2131,6 +2073,20 @@ int libfsapfs_snapshot_metadata_tree_get_snapshots(
 
 		goto on_error;
 	}
+	if( libfsapfs_node_cache_release_node(
+	     snapshot_metadata_tree->node_cache,
+	     &root_node,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release B-tree node.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_PROFILER )
 	if( snapshot_metadata_tree->io_handle->profiler != NULL )
 	{
@@ -2157,6 +2113,13 @@ int libfsapfs_snapshot_metadata_tree_get_snapshots(
 	return( result );
 
 on_error:
+	if( root_node != NULL )
+	{
+		libfsapfs_node_cache_release_node(
+		 snapshot_metadata_tree->node_cache,
+		 &root_node,
+		 NULL );
+	}
 	libcdata_array_empty(
 	 snapshots,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_snapshot_metadata_free,
@@ -30,8 +30,7 @@
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
-#include "libfsapfs_libfcache.h"
-#include "libfsapfs_libfdata.h"
+#include "libfsapfs_node_cache.h"
 #include "libfsapfs_object_map_btree.h"
 #include "libfsapfs_snapshot_metadata.h"
 
@@ -47,17 +46,13 @@ struct libfsapfs_snapshot_metadata_tree
 	 */
 	libfsapfs_io_handle_t *io_handle;
 
-	/* Data block vector
-	 */
-	libfdata_vector_t *data_block_vector;
-
-	/* Data block cache
+	/* The node cache
 	 */
-	libfcache_cache_t *data_block_cache;
+	libfsapfs_node_cache_t *node_cache;
 
-	/* The node cache
+	/* The number of node cache entries reserved from the IO handle
 	 */
-	libfcache_cache_t *node_cache;
+	int number_of_cache_entries;
 
 	/* The volume object map B-tree
 	 */
@@ -71,7 +66,6 @@ struct libfsapfs_snapshot_metadata_tree
 int libfsapfs_snapshot_metadata_tree_initialize(
      libfsapfs_snapshot_metadata_tree_t **snapshot_metadata_tree,
      libfsapfs_io_handle_t *io_handle,
-     libfdata_vector_t *data_block_vector,
      libfsapfs_object_map_btree_t *object_map_btree,
      uint64_t root_node_block_number,
      libcerror_error_t **error );
@@ -102,6 +96,12 @@ int libfsapfs_snapshot_metadata_tree_get_sub_node(
      libfsapfs_btree_node_t **sub_node,
      libcerror_error_t **error );
 
+int libfsapfs_snapshot_metadata_tree_compare_identifier_with_key_data(
+     intptr_t *key_value,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     libcerror_error_t **error );
+
 int libfsapfs_snapshot_metadata_tree_get_entry_from_node_by_identifier(
      libfsapfs_snapshot_metadata_tree_t *snapshot_metadata_tree,
      libfsapfs_btree_node_t *node,
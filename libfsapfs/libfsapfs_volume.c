@@ -25,23 +25,24 @@
 #include <types.h>
 #include <wide_string.h>
 
-#include "libfsapfs_container_data_handle.h"
+#include "libfsapfs_buffer_pool.h"
+#include "libfsapfs_decryption_pool.h"
 #include "libfsapfs_container_key_bag.h"
 #include "libfsapfs_debug.h"
+#include "libfsapfs_decompressed_data_cache.h"
+#include "libfsapfs_decompression_pool.h"
 #include "libfsapfs_definitions.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_extent_reference_tree.h"
 #include "libfsapfs_file_entry.h"
 #include "libfsapfs_file_system.h"
 #include "libfsapfs_file_system_btree.h"
-#include "libfsapfs_file_system_data_handle.h"
 #include "libfsapfs_inode.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcnotify.h"
 #include "libfsapfs_libcthreads.h"
-#include "libfsapfs_libfdata.h"
 #include "libfsapfs_libuna.h"
 #include "libfsapfs_object_map.h"
 #include "libfsapfs_object_map_btree.h"
@@ -139,8 +140,41 @@ int libfsapfs_volume_initialize(
 
 		goto on_error;
 	}
+	/* The volume has its own copy of the IO handle to maintain cache settings and statistics per volume
+	 * The volume starts with the cache sizes of the container, but its caches reserve cache entries
+	 * from the IO handle of the volume, hence they do not share the cache sizes with the container
+	 */
+	if( libfsapfs_io_handle_clone(
+	     &( internal_volume->io_handle ),
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfsapfs_buffer_pool_initialize(
+	     &( internal_volume->buffer_pool ),
+	     (size_t) internal_volume->io_handle->block_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create buffer pool.",
+		 function );
+
+		goto on_error;
+	}
+	internal_volume->io_handle->buffer_pool = internal_volume->buffer_pool;
+
 /* TODO clone file_io_handle? */
-	internal_volume->io_handle         = io_handle;
 	internal_volume->file_io_handle    = file_io_handle;
 	internal_volume->container_key_bag = container_key_bag;
 	internal_volume->is_locked         = 1;
@@ -167,6 +201,18 @@ int libfsapfs_volume_initialize(
 on_error:
 	if( internal_volume != NULL )
 	{
+		if( internal_volume->io_handle != NULL )
+		{
+			libfsapfs_io_handle_free(
+			 &( internal_volume->io_handle ),
+			 NULL );
+		}
+		if( internal_volume->buffer_pool != NULL )
+		{
+			libfsapfs_buffer_pool_free(
+			 &( internal_volume->buffer_pool ),
+			 NULL );
+		}
 		memory_free(
 		 internal_volume );
 	}
@@ -231,6 +277,32 @@ int libfsapfs_volume_free(
 			result = -1;
 		}
 #endif
+		if( libfsapfs_io_handle_free(
+		     &( internal_volume->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libfsapfs_buffer_pool_free(
+		     &( internal_volume->buffer_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free buffer pool.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 internal_volume );
 	}
@@ -246,13 +318,10 @@ int libfsapfs_internal_volume_open_read(
      off64_t file_offset,
      libcerror_error_t **error )
 {
-	libfsapfs_container_data_handle_t *container_data_handle     = NULL;
-	libfsapfs_file_system_data_handle_t *file_system_data_handle = NULL;
 	libfsapfs_object_map_t *object_map                           = NULL;
 	static char *function                                        = "libfsapfs_internal_volume_open_read";
 	uint64_t key_bag_block_number                                = 0;
 	uint64_t key_bag_number_of_blocks                            = 0;
-	int element_index                                            = 0;
 	int result                                                   = 0;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -292,17 +361,6 @@ int libfsapfs_internal_volume_open_read(
 
 		return( -1 );
 	}
-	if( internal_volume->container_data_block_vector != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - container data block vector value already set.",
-		 function );
-
-		return( -1 );
-	}
 	if( internal_volume->object_map_btree != NULL )
 	{
 		libcerror_error_set(
@@ -347,17 +405,6 @@ int libfsapfs_internal_volume_open_read(
 
 		return( -1 );
 	}
-	if( internal_volume->file_system_data_block_vector != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid volume - file system data block vector value already set.",
-		 function );
-
-		return( -1 );
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -396,61 +443,6 @@ int libfsapfs_internal_volume_open_read(
 
 		goto on_error;
 	}
-	if( libfsapfs_container_data_handle_initialize(
-	     &container_data_handle,
-	     internal_volume->io_handle,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create container data handle.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_initialize(
-	     &( internal_volume->container_data_block_vector ),
-	     (size64_t) internal_volume->io_handle->block_size,
-	     (intptr_t *) container_data_handle,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_container_data_handle_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsapfs_container_data_handle_read_data_block,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create container data block vector.",
-		 function );
-
-		goto on_error;
-	}
-	internal_volume->container_data_handle = container_data_handle;
-	container_data_handle                  = NULL;
-
-	if( libfdata_vector_append_segment(
-	     internal_volume->container_data_block_vector,
-	     &element_index,
-	     0,
-	     0,
-	     internal_volume->io_handle->container_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to container data block vector.",
-		 function );
-
-		goto on_error;
-	}
 /* TODO refactor into function to read object map */
 	if( internal_volume->superblock->object_map_block_number == 0 )
 	{
@@ -523,7 +515,6 @@ int libfsapfs_internal_volume_open_read(
 	if( libfsapfs_object_map_btree_initialize(
 	     &( internal_volume->object_map_btree ),
 	     internal_volume->io_handle,
-	     internal_volume->container_data_block_vector,
 	     object_map->btree_block_number,
 	     error ) != 1 )
 	{
@@ -710,7 +701,6 @@ int libfsapfs_internal_volume_open_read(
 		if( libfsapfs_snapshot_metadata_tree_initialize(
 		     &( internal_volume->snapshot_metadata_tree ),
 		     internal_volume->io_handle,
-		     internal_volume->container_data_block_vector,
 		     internal_volume->object_map_btree,
 		     internal_volume->superblock->snapshot_metadata_tree_block_number,
 		     error ) != 1 )
@@ -752,76 +742,15 @@ int libfsapfs_internal_volume_open_read(
 
 		goto on_error;
 	}
-	if( libfsapfs_file_system_data_handle_initialize(
-	     &file_system_data_handle,
-	     internal_volume->io_handle,
-	     internal_volume->encryption_context,
-	     NULL,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file system data handle.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_initialize(
-	     &( internal_volume->file_system_data_block_vector ),
-	     (size64_t) internal_volume->io_handle->block_size,
-	     (intptr_t *) file_system_data_handle,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_system_data_handle_free,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libfsapfs_file_system_data_handle_read_data_block,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file system data block vector.",
-		 function );
-
-		goto on_error;
-	}
-	internal_volume->file_system_data_handle = file_system_data_handle;
-	file_system_data_handle                  = NULL;
-
-	if( libfdata_vector_append_segment(
-	     internal_volume->file_system_data_block_vector,
-	     &element_index,
-	     0,
-	     0,
-	     internal_volume->io_handle->container_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to file system data block vector.",
-		 function );
-
-		goto on_error;
-	}
 	return( 1 );
 
 on_error:
-	if( internal_volume->file_system_data_block_vector != NULL )
+	if( internal_volume->decryption_pool != NULL )
 	{
-		libfdata_vector_free(
-		 &( internal_volume->file_system_data_block_vector ),
-		 NULL );
-	}
-	if( file_system_data_handle != NULL )
-	{
-		libfsapfs_file_system_data_handle_free(
-		 &file_system_data_handle,
+		internal_volume->io_handle->decryption_pool = NULL;
+
+		libfsapfs_decryption_pool_free(
+		 &( internal_volume->decryption_pool ),
 		 NULL );
 	}
 	if( internal_volume->encryption_context != NULL )
@@ -869,18 +798,6 @@ on_error:
 		 &object_map,
 		 NULL );
 	}
-	if( internal_volume->container_data_block_vector != NULL )
-	{
-		libfdata_vector_free(
-		 &( internal_volume->container_data_block_vector ),
-		 NULL );
-	}
-	if( container_data_handle != NULL )
-	{
-		libfsapfs_container_data_handle_free(
-		 &container_data_handle,
-		 NULL );
-	}
 	if( internal_volume->superblock != NULL )
 	{
 		libfsapfs_volume_superblock_free(
@@ -985,19 +902,6 @@ int libfsapfs_internal_volume_close(
 			result = -1;
 		}
 	}
-	if( libfdata_vector_free(
-	     &( internal_volume->container_data_block_vector ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free container data block vector.",
-		 function );
-
-		result = -1;
-	}
 	if( internal_volume->object_map_btree != NULL )
 	{
 		if( libfsapfs_object_map_btree_free(
@@ -1063,6 +967,24 @@ int libfsapfs_internal_volume_close(
 			result = -1;
 		}
 	}
+	if( internal_volume->decryption_pool != NULL )
+	{
+		internal_volume->io_handle->decryption_pool = NULL;
+
+		if( libfsapfs_decryption_pool_free(
+		     &( internal_volume->decryption_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decryption pool.",
+			 function );
+
+			result = -1;
+		}
+	}
 	if( internal_volume->encryption_context != NULL )
 	{
 		if( libfsapfs_encryption_context_free(
@@ -1079,19 +1001,6 @@ int libfsapfs_internal_volume_close(
 			result = -1;
 		}
 	}
-	if( libfdata_vector_free(
-	     &( internal_volume->file_system_data_block_vector ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file system data block vector.",
-		 function );
-
-		result = -1;
-	}
 	if( internal_volume->file_system != NULL )
 	{
 		if( libfsapfs_file_system_free(
@@ -1108,6 +1017,42 @@ int libfsapfs_internal_volume_close(
 			result = -1;
 		}
 	}
+	if( internal_volume->decompressed_data_cache != NULL )
+	{
+		internal_volume->io_handle->decompressed_data_cache = NULL;
+
+		if( libfsapfs_decompressed_data_cache_free(
+		     &( internal_volume->decompressed_data_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decompressed data cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( internal_volume->decompression_pool != NULL )
+	{
+		internal_volume->io_handle->decompression_pool = NULL;
+
+		if( libfsapfs_decompression_pool_free(
+		     &( internal_volume->decompression_pool ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free decompression pool.",
+			 function );
+
+			result = -1;
+		}
+	}
 	return( result );
 }
 
@@ -1215,6 +1160,32 @@ int libfsapfs_internal_volume_unlock(
 
 				goto on_error;
 			}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+			if( ( internal_volume->decryption_pool == NULL )
+			 && ( internal_volume->io_handle->maximum_number_of_decryption_threads > 1 ) )
+			{
+				if( libfsapfs_decryption_pool_initialize(
+				     &( internal_volume->decryption_pool ),
+				     LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+				     volume_master_key,
+				     16,
+				     &( volume_master_key[ 16 ] ),
+				     16,
+				     internal_volume->io_handle->maximum_number_of_decryption_threads,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create decryption pool.",
+					 function );
+
+					goto on_error;
+				}
+				internal_volume->io_handle->decryption_pool = internal_volume->decryption_pool;
+			}
+#endif
 			memory_set(
 			 volume_master_key,
 			 0,
@@ -2617,16 +2588,23 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the root directory file entry
- * Returns 1 if successful, or 0 if not available or -1 on error
+/* Sets the maximum cache size
+ * The maximum cache size is in bytes, a value of 0 represents the default
+ * Every cache type that has no maximum cache size set gets a fixed share of the maximum cache size:
+ * 2/16 for object map nodes, 1/16 for snapshot metadata nodes, 10/16 for file system nodes,
+ * 1/16 for data blocks and 2/16 for decompressed data
+ * The maximum cache size of a cache type is shared by all the caches of that type of the volume
+ * The caches of the volume do not share the cache sizes with the container or other volumes
+ * The cache sizes only apply to caches that are created after the call
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_root_directory(
+int libfsapfs_volume_set_maximum_cache_size(
      libfsapfs_volume_t *volume,
-     libfsapfs_file_entry_t **file_entry,
+     size64_t maximum_cache_size,
      libcerror_error_t **error )
 {
 	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_root_directory";
+	static char *function                        = "libfsapfs_volume_set_maximum_cache_size";
 	int result                                   = 1;
 
 	if( volume == NULL )
@@ -2642,13 +2620,13 @@ int libfsapfs_volume_get_root_directory(
 	}
 	internal_volume = (libfsapfs_internal_volume_t *) volume;
 
-	if( internal_volume->superblock == NULL )
+	if( internal_volume->io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 "%s: invalid volume - missing IO handle.",
 		 function );
 
 		return( -1 );
@@ -2668,34 +2646,830 @@ int libfsapfs_volume_get_root_directory(
 		return( -1 );
 	}
 #endif
-	if( internal_volume->file_system == NULL )
+	if( libfsapfs_io_handle_set_maximum_cache_size(
+	     internal_volume->io_handle,
+	     maximum_cache_size,
+	     error ) != 1 )
 	{
-		if( libfsapfs_internal_volume_get_file_system(
-		     internal_volume,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine file system.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum cache size.",
+		 function );
 
-			result = -1;
-		}
+		result = -1;
 	}
-	if( result != -1 )
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
-		result = libfsapfs_file_system_get_file_entry_by_identifier(
-		          internal_volume->file_system,
-		          internal_volume->file_io_handle,
-		          2,
-		          internal_volume->superblock->transaction_identifier,
-		          file_entry,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
-		if( result == -1 )
-		{
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum cache size of a specific cache type
+ * The maximum cache size is in bytes, a value of 0 represents not set
+ * The maximum cache size is shared by all the caches of the cache type of the volume
+ * The caches of the volume do not share the cache sizes with the container or other volumes
+ * The cache sizes only apply to caches that are created after the call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_set_maximum_cache_size_by_type(
+     libfsapfs_volume_t *volume,
+     int cache_type,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_set_maximum_cache_size_by_type";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_set_maximum_cache_size_by_type(
+	     internal_volume->io_handle,
+	     cache_type,
+	     maximum_cache_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum cache size by type.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the cache statistics of a specific cache type
+ * The number of cache hits is the number of lookups minus the number of misses
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_cache_statistics(
+     libfsapfs_volume_t *volume,
+     int cache_type,
+     uint64_t *number_of_lookups,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     size64_t *resident_size,
+     size64_t *read_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_cache_statistics_t *cache_statistics = NULL;
+	libfsapfs_internal_volume_t *internal_volume   = NULL;
+	static char *function                          = "libfsapfs_volume_get_cache_statistics";
+	int result                                     = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_lookups == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of lookups.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_evictions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of evictions.",
+		 function );
+
+		return( -1 );
+	}
+	if( resident_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resident size.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_get_cache_statistics(
+	     internal_volume->io_handle,
+	     cache_type,
+	     &cache_statistics,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache statistics.",
+		 function );
+
+		result = -1;
+	}
+	else if( libfsapfs_cache_statistics_get_values(
+	          cache_statistics,
+	          number_of_lookups,
+	          number_of_misses,
+	          number_of_evictions,
+	          resident_size,
+	          read_size,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cache statistics values.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum read-ahead size
+ * The maximum read-ahead size is in bytes, a value of 0 disables read-ahead
+ * The read-ahead size only applies to file entries that are retrieved after the call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_set_maximum_read_ahead_size(
+     libfsapfs_volume_t *volume,
+     size64_t maximum_read_ahead_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_set_maximum_read_ahead_size";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_set_maximum_read_ahead_size(
+	     internal_volume->io_handle,
+	     maximum_read_ahead_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum read-ahead size.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum number of concurrent reads
+ * A value of 1 disables concurrent reads
+ * Concurrent reads require multi-thread support and a file IO handle that can be cloned
+ * The maximum number of concurrent reads only applies to file entries that are retrieved after the call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_set_maximum_number_of_concurrent_reads(
+     libfsapfs_volume_t *volume,
+     int maximum_number_of_concurrent_reads,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_set_maximum_number_of_concurrent_reads";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_set_maximum_number_of_concurrent_reads(
+	     internal_volume->io_handle,
+	     maximum_number_of_concurrent_reads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of concurrent reads.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum number of decryption threads
+ * A value of 1 disables concurrent decryption
+ * Concurrent decryption requires multi-thread support
+ * The maximum number of decryption threads only applies when the volume is unlocked after the call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_set_maximum_number_of_decryption_threads(
+     libfsapfs_volume_t *volume,
+     int maximum_number_of_decryption_threads,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_set_maximum_number_of_decryption_threads";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_set_maximum_number_of_decryption_threads(
+	     internal_volume->io_handle,
+	     maximum_number_of_decryption_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of decryption threads.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the maximum number of decompression threads
+ * A value of 1 disables concurrent decompression
+ * Concurrent decompression requires multi-thread support
+ * The maximum number of decompression threads only applies when the file system of the volume is accessed after the call
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_set_maximum_number_of_decompression_threads(
+     libfsapfs_volume_t *volume,
+     int maximum_number_of_decompression_threads,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_set_maximum_number_of_decompression_threads";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_set_maximum_number_of_decompression_threads(
+	     internal_volume->io_handle,
+	     maximum_number_of_decompression_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum number of decompression threads.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the read-ahead statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_volume_get_read_ahead_statistics(
+     libfsapfs_volume_t *volume,
+     uint64_t *number_of_reads,
+     size64_t *read_size,
+     size64_t *used_size,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_read_ahead_statistics";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_reads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of reads.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	if( used_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid used size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libfsapfs_io_handle_get_read_ahead_statistics(
+	     internal_volume->io_handle,
+	     number_of_reads,
+	     read_size,
+	     used_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve read-ahead statistics.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the root directory file entry
+ * Returns 1 if successful, or 0 if not available or -1 on error
+ */
+int libfsapfs_volume_get_root_directory(
+     libfsapfs_volume_t *volume,
+     libfsapfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_root_directory";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_volume_determine_file_system(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file system.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != -1 )
+	{
+		result = libfsapfs_file_system_get_file_entry_by_identifier(
+		          internal_volume->file_system,
+		          internal_volume->file_io_handle,
+		          2,
+		          internal_volume->superblock->transaction_identifier,
+		          file_entry,
+		          error );
+
+		if( result == -1 )
+		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
@@ -2707,7 +3481,7 @@ int libfsapfs_volume_get_root_directory(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2715,7 +3489,7 @@ int libfsapfs_volume_get_root_directory(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2804,6 +3578,7 @@ int libfsapfs_internal_volume_get_file_system(
 	libfsapfs_file_system_btree_t *file_system_btree         = NULL;
 	libfsapfs_object_map_descriptor_t *object_map_descriptor = NULL;
 	static char *function                                    = "libfsapfs_internal_volume_get_file_system";
+	size64_t maximum_cache_size                              = 0;
 	uint8_t use_case_folding                                 = 0;
 	int result                                               = 0;
 
@@ -2896,7 +3671,6 @@ int libfsapfs_internal_volume_get_file_system(
 	     &file_system_btree,
 	     internal_volume->io_handle,
 	     internal_volume->encryption_context,
-	     internal_volume->file_system_data_block_vector,
 	     internal_volume->object_map_btree,
 	     object_map_descriptor->physical_address,
 	     use_case_folding,
@@ -2911,6 +3685,65 @@ int libfsapfs_internal_volume_get_file_system(
 
 		goto on_error;
 	}
+	if( internal_volume->decompressed_data_cache == NULL )
+	{
+		if( libfsapfs_io_handle_get_maximum_cache_size(
+		     internal_volume->io_handle,
+		     LIBFSAPFS_CACHE_TYPE_DECOMPRESSED_DATA,
+		     &maximum_cache_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve maximum decompressed data cache size.",
+			 function );
+
+			goto on_error;
+		}
+		if( maximum_cache_size == 0 )
+		{
+			maximum_cache_size = LIBFSAPFS_DEFAULT_MAXIMUM_DECOMPRESSED_DATA_CACHE_SIZE;
+		}
+		if( libfsapfs_decompressed_data_cache_initialize(
+		     &( internal_volume->decompressed_data_cache ),
+		     maximum_cache_size,
+		     internal_volume->io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_DECOMPRESSED_DATA - 1 ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decompressed data cache.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->io_handle->decompressed_data_cache = internal_volume->decompressed_data_cache;
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( ( internal_volume->decompression_pool == NULL )
+	 && ( internal_volume->io_handle->maximum_number_of_decompression_threads > 1 ) )
+	{
+		if( libfsapfs_decompression_pool_initialize(
+		     &( internal_volume->decompression_pool ),
+		     internal_volume->io_handle->maximum_number_of_decompression_threads,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create decompression pool.",
+			 function );
+
+			goto on_error;
+		}
+		internal_volume->io_handle->decompression_pool = internal_volume->decompression_pool;
+	}
+#endif
 	if( libfsapfs_file_system_initialize(
 	     &( internal_volume->file_system ),
 	     internal_volume->io_handle,
@@ -2961,23 +3794,38 @@ on_error:
 		 &( internal_volume->file_system ),
 		 NULL );
 	}
+	if( internal_volume->decompressed_data_cache != NULL )
+	{
+		internal_volume->io_handle->decompressed_data_cache = NULL;
+
+		libfsapfs_decompressed_data_cache_free(
+		 &( internal_volume->decompressed_data_cache ),
+		 NULL );
+	}
+	if( internal_volume->decompression_pool != NULL )
+	{
+		internal_volume->io_handle->decompression_pool = NULL;
+
+		libfsapfs_decompression_pool_free(
+		 &( internal_volume->decompression_pool ),
+		 NULL );
+	}
 	return( -1 );
 }
 
-/* Retrieves the file entry for a specific identifier
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Determines the file system if not already determined
+ * The file system is determined while holding the write lock, after which it does not change
+ * until the volume is closed, hence it can be accessed while holding the read lock
+ * Returns 1 if successful or -1 on error
  */
-int libfsapfs_volume_get_file_entry_by_identifier(
-     libfsapfs_volume_t *volume,
-     uint64_t identifier,
-     libfsapfs_file_entry_t **file_entry,
+int libfsapfs_internal_volume_determine_file_system(
+     libfsapfs_internal_volume_t *internal_volume,
      libcerror_error_t **error )
 {
-	libfsapfs_internal_volume_t *internal_volume = NULL;
-	static char *function                        = "libfsapfs_volume_get_file_entry_by_identifier";
-	int result                                   = 1;
+	static char *function = "libfsapfs_internal_volume_determine_file_system";
+	int result            = 1;
 
-	if( volume == NULL )
+	if( internal_volume == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2988,19 +3836,42 @@ int libfsapfs_volume_get_file_entry_by_identifier(
 
 		return( -1 );
 	}
-	internal_volume = (libfsapfs_internal_volume_t *) volume;
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-	if( internal_volume->superblock == NULL )
+		return( -1 );
+	}
+#endif
+	result = (int) ( internal_volume->file_system != NULL );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid volume - missing superblock.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
+#endif
+	if( result != 0 )
+	{
+		return( 1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_volume->read_write_lock,
@@ -3016,6 +3887,10 @@ int libfsapfs_volume_get_file_entry_by_identifier(
 		return( -1 );
 	}
 #endif
+	result = 1;
+
+	/* Another thread could have determined the file system in the meantime
+	 */
 	if( internal_volume->file_system == NULL )
 	{
 		if( libfsapfs_internal_volume_get_file_system(
@@ -3032,6 +3907,89 @@ int libfsapfs_volume_get_file_entry_by_identifier(
 			result = -1;
 		}
 	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file entry for a specific identifier
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfsapfs_volume_get_file_entry_by_identifier(
+     libfsapfs_volume_t *volume,
+     uint64_t identifier,
+     libfsapfs_file_entry_t **file_entry,
+     libcerror_error_t **error )
+{
+	libfsapfs_internal_volume_t *internal_volume = NULL;
+	static char *function                        = "libfsapfs_volume_get_file_entry_by_identifier";
+	int result                                   = 1;
+
+	if( volume == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid volume.",
+		 function );
+
+		return( -1 );
+	}
+	internal_volume = (libfsapfs_internal_volume_t *) volume;
+
+	if( internal_volume->superblock == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid volume - missing superblock.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfsapfs_internal_volume_determine_file_system(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file system.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_volume->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( result != -1 )
 	{
 		result = libfsapfs_file_system_get_file_entry_by_identifier(
@@ -3056,7 +4014,7 @@ int libfsapfs_volume_get_file_entry_by_identifier(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3064,7 +4022,7 @@ int libfsapfs_volume_get_file_entry_by_identifier(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3133,8 +4091,21 @@ int libfsapfs_volume_get_file_entry_by_utf8_path(
 
 		return( -1 );
 	}
+	if( libfsapfs_internal_volume_determine_file_system(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file system.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3142,28 +4113,12 @@ int libfsapfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_volume->file_system == NULL )
-	{
-		if( libfsapfs_internal_volume_get_file_system(
-		     internal_volume,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine file system.",
-			 function );
-
-			result = -1;
-		}
-	}
 	if( result != -1 )
 	{
 		result = libfsapfs_file_system_get_file_entry_by_utf8_path(
@@ -3188,7 +4143,7 @@ int libfsapfs_volume_get_file_entry_by_utf8_path(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3196,7 +4151,7 @@ int libfsapfs_volume_get_file_entry_by_utf8_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -3265,8 +4220,21 @@ int libfsapfs_volume_get_file_entry_by_utf16_path(
 
 		return( -1 );
 	}
+	if( libfsapfs_internal_volume_determine_file_system(
+	     internal_volume,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine file system.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3274,28 +4242,12 @@ int libfsapfs_volume_get_file_entry_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( internal_volume->file_system == NULL )
-	{
-		if( libfsapfs_internal_volume_get_file_system(
-		     internal_volume,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to determine file system.",
-			 function );
-
-			result = -1;
-		}
-	}
 	if( result != -1 )
 	{
 		result = libfsapfs_file_system_get_file_entry_by_utf16_path(
@@ -3320,7 +4272,7 @@ int libfsapfs_volume_get_file_entry_by_utf16_path(
 		}
 	}
 #if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_volume->read_write_lock,
 	     error ) != 1 )
 	{
@@ -3328,7 +4280,7 @@ int libfsapfs_volume_get_file_entry_by_utf16_path(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -25,19 +25,20 @@
 #include <common.h>
 #include <types.h>
 
-#include "libfsapfs_container_data_handle.h"
+#include "libfsapfs_buffer_pool.h"
 #include "libfsapfs_container_key_bag.h"
+#include "libfsapfs_decompressed_data_cache.h"
+#include "libfsapfs_decompression_pool.h"
+#include "libfsapfs_decryption_pool.h"
 #include "libfsapfs_encryption_context.h"
 #include "libfsapfs_extern.h"
 #include "libfsapfs_file_system.h"
 #include "libfsapfs_file_system_btree.h"
-#include "libfsapfs_file_system_data_handle.h"
 #include "libfsapfs_io_handle.h"
 #include "libfsapfs_libbfio.h"
 #include "libfsapfs_libcdata.h"
 #include "libfsapfs_libcerror.h"
 #include "libfsapfs_libcthreads.h"
-#include "libfsapfs_libfdata.h"
 #include "libfsapfs_object_map_btree.h"
 #include "libfsapfs_snapshot_metadata_tree.h"
 #include "libfsapfs_volume_key_bag.h"
@@ -60,14 +61,6 @@ struct libfsapfs_internal_volume
 	 */
 	libfsapfs_container_key_bag_t *container_key_bag;
 
-	/* The container data handle
-	 */
-	libfsapfs_container_data_handle_t *container_data_handle;
-
-	/* The container data block vector
-	 */
-	libfdata_vector_t *container_data_block_vector;
-
 	/* The object map B-tree
 	 */
 	libfsapfs_object_map_btree_t *object_map_btree;
@@ -88,18 +81,22 @@ struct libfsapfs_internal_volume
 	 */
 	libfsapfs_encryption_context_t *encryption_context;
 
-	/* The file system data handle
-	 */
-	libfsapfs_file_system_data_handle_t *file_system_data_handle;
-
-	/* The file system data block vector
+	/* The decryption pool, set if the volume is unlocked and concurrent decryption is enabled
 	 */
-	libfdata_vector_t *file_system_data_block_vector;
+	libfsapfs_decryption_pool_t *decryption_pool;
 
 	/* The file system
 	 */
 	libfsapfs_file_system_t *file_system;
 
+	/* The decompressed data cache, set when the file system is determined
+	 */
+	libfsapfs_decompressed_data_cache_t *decompressed_data_cache;
+
+	/* The decompression pool, set when the file system is determined and concurrent decompression is enabled
+	 */
+	libfsapfs_decompression_pool_t *decompression_pool;
+
 	/* The file system B-tree
 	 */
 	libfsapfs_file_system_btree_t *file_system_btree;
@@ -108,6 +105,10 @@ struct libfsapfs_internal_volume
 	 */
 	libfsapfs_io_handle_t *io_handle;
 
+	/* The data block buffer pool
+	 */
+	libfsapfs_buffer_pool_t *buffer_pool;
+
 	/* The file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
@@ -250,6 +251,62 @@ int libfsapfs_volume_set_utf16_recovery_password(
      size_t utf16_string_length,
      libcerror_error_t **error );
 
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_set_maximum_cache_size(
+     libfsapfs_volume_t *volume,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_set_maximum_cache_size_by_type(
+     libfsapfs_volume_t *volume,
+     int cache_type,
+     size64_t maximum_cache_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_cache_statistics(
+     libfsapfs_volume_t *volume,
+     int cache_type,
+     uint64_t *number_of_lookups,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_evictions,
+     size64_t *resident_size,
+     size64_t *read_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_set_maximum_read_ahead_size(
+     libfsapfs_volume_t *volume,
+     size64_t maximum_read_ahead_size,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_set_maximum_number_of_concurrent_reads(
+     libfsapfs_volume_t *volume,
+     int maximum_number_of_concurrent_reads,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_set_maximum_number_of_decryption_threads(
+     libfsapfs_volume_t *volume,
+     int maximum_number_of_decryption_threads,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_set_maximum_number_of_decompression_threads(
+     libfsapfs_volume_t *volume,
+     int maximum_number_of_decompression_threads,
+     libcerror_error_t **error );
+
+LIBFSAPFS_EXTERN \
+int libfsapfs_volume_get_read_ahead_statistics(
+     libfsapfs_volume_t *volume,
+     uint64_t *number_of_reads,
+     size64_t *read_size,
+     size64_t *used_size,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_volume_get_root_directory(
      libfsapfs_volume_t *volume,
@@ -266,6 +323,10 @@ int libfsapfs_internal_volume_get_file_system(
      libfsapfs_internal_volume_t *internal_volume,
      libcerror_error_t **error );
 
+int libfsapfs_internal_volume_determine_file_system(
+     libfsapfs_internal_volume_t *internal_volume,
+     libcerror_error_t **error );
+
 LIBFSAPFS_EXTERN \
 int libfsapfs_volume_get_file_entry_by_identifier(
      libfsapfs_volume_t *volume,
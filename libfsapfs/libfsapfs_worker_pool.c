@@ -0,0 +1,655 @@
+/*
+ * Worker pool functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcnotify.h"
+#include "libfsapfs_libcthreads.h"
+#include "libfsapfs_worker_pool.h"
+
+/* The result of a job is published atomically, so that it is also published
+ * when the mutex cannot be grabbed
+ */
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) && defined( WINAPI )
+#define libfsapfs_worker_pool_get_job_result( job ) \
+	(int) InterlockedCompareExchange( (LONG volatile *) &( ( job )->result ), 0, 0 )
+
+#define libfsapfs_worker_pool_set_job_result( job, value ) \
+	InterlockedExchange( (LONG volatile *) &( ( job )->result ), (LONG) ( value ) )
+
+#elif defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+#define libfsapfs_worker_pool_get_job_result( job ) \
+	__atomic_load_n( &( ( job )->result ), __ATOMIC_ACQUIRE )
+
+#define libfsapfs_worker_pool_set_job_result( job, value ) \
+	__atomic_store_n( &( ( job )->result ), value, __ATOMIC_RELEASE )
+
+#endif
+
+/* Creates a worker pool
+ * The calling thread acts as one of the workers, hence the pool has number of workers - 1 threads
+ * Make sure the value worker_pool is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_worker_pool_initialize(
+     libfsapfs_worker_pool_t **worker_pool,
+     int number_of_workers,
+     int maximum_number_of_workers,
+     int (*job_function)(
+            intptr_t *value,
+            void *arguments ),
+     void *job_function_arguments,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_worker_pool_initialize";
+
+	if( worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker_pool != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid worker pool value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_workers < 1 )
+	 || ( number_of_workers > maximum_number_of_workers ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of workers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( job_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid job function.",
+		 function );
+
+		return( -1 );
+	}
+	*worker_pool = memory_allocate_structure(
+	                libfsapfs_worker_pool_t );
+
+	if( *worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create worker pool.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *worker_pool,
+	     0,
+	     sizeof( libfsapfs_worker_pool_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear worker pool.",
+		 function );
+
+		memory_free(
+		 *worker_pool );
+
+		*worker_pool = NULL;
+
+		return( -1 );
+	}
+	( *worker_pool )->number_of_workers      = number_of_workers;
+	( *worker_pool )->job_function           = job_function;
+	( *worker_pool )->job_function_arguments = job_function_arguments;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( number_of_workers > 1 )
+	{
+		if( libcthreads_mutex_initialize(
+		     &( ( *worker_pool )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize mutex.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcthreads_condition_initialize(
+		     &( ( *worker_pool )->condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize condition.",
+			 function );
+
+			goto on_error;
+		}
+		/* Every run queues at most number of workers - 1 jobs
+		 */
+		if( libcthreads_thread_pool_create(
+		     &( ( *worker_pool )->thread_pool ),
+		     NULL,
+		     number_of_workers - 1,
+		     ( number_of_workers - 1 ) * maximum_number_of_workers,
+		     (int (*)(intptr_t *, void *)) &libfsapfs_worker_pool_thread_callback,
+		     (void *) *worker_pool,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *worker_pool != NULL )
+	{
+		libfsapfs_worker_pool_free(
+		 worker_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a worker pool
+ * The threads are joined after they have processed the queued jobs
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_worker_pool_free(
+     libfsapfs_worker_pool_t **worker_pool,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_worker_pool_free";
+	int result            = 1;
+
+	if( worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( *worker_pool != NULL )
+	{
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+		if( ( *worker_pool )->thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_join(
+			     &( ( *worker_pool )->thread_pool ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join thread pool.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *worker_pool )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *worker_pool )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *worker_pool )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *worker_pool )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		memory_free(
+		 *worker_pool );
+
+		*worker_pool = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the number of workers that can run jobs concurrently
+ * This is 1 if the worker pool has no threads
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_worker_pool_get_number_of_workers(
+     libfsapfs_worker_pool_t *worker_pool,
+     int *number_of_workers,
+     libcerror_error_t **error )
+{
+	static char *function = "libfsapfs_worker_pool_get_number_of_workers";
+
+	if( worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_workers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of workers.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_workers = 1;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( worker_pool->thread_pool != NULL )
+	{
+		*number_of_workers = worker_pool->number_of_workers;
+	}
+#endif
+	return( 1 );
+}
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+/* Runs a job queued in the thread pool
+ * This function is the callback of the thread pool
+ * The job is not referenced after its result has been published, since the job
+ * is owned by the thread that waits for the result
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_worker_pool_thread_callback(
+     libfsapfs_worker_pool_job_t *job,
+     libfsapfs_worker_pool_t *worker_pool )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	if( ( job == NULL )
+	 || ( worker_pool == NULL ) )
+	{
+		return( -1 );
+	}
+	result = worker_pool->job_function(
+	          job->value,
+	          worker_pool->job_function_arguments );
+
+	if( result != 1 )
+	{
+		result = -1;
+	}
+	/* The result is published before the mutex is grabbed, so that the waiting thread
+	 * does not wait for the job indefinitely if grabbing the mutex fails
+	 */
+	libfsapfs_worker_pool_set_job_result(
+	 job,
+	 result );
+
+	if( libcthreads_mutex_grab(
+	     worker_pool->mutex,
+	     &error ) != 1 )
+	{
+		libcthreads_condition_broadcast(
+		 worker_pool->condition,
+		 NULL );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_broadcast(
+	     worker_pool->condition,
+	     &error ) != 1 )
+	{
+		libcthreads_mutex_release(
+		 worker_pool->mutex,
+		 NULL );
+
+		goto on_error;
+	}
+	if( libcthreads_mutex_release(
+	     worker_pool->mutex,
+	     &error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( error != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_print_error_backtrace(
+			 error );
+		}
+#endif
+		libcerror_error_free(
+		 &error );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+/* Runs jobs concurrently
+ * The first job is run by the calling thread and the other jobs by the threads of the pool.
+ * The jobs are owned by the caller, so that multiple threads can run jobs concurrently
+ * using the same pool. Without threads the jobs are run one after the other by the calling thread
+ * The function only returns after every queued job has finished, also on error,
+ * since the jobs reference data of the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfsapfs_worker_pool_run_jobs(
+     libfsapfs_worker_pool_t *worker_pool,
+     libfsapfs_worker_pool_job_t *jobs,
+     int number_of_jobs,
+     libcerror_error_t **error )
+{
+	libfsapfs_worker_pool_job_t *job = NULL;
+	static char *function            = "libfsapfs_worker_pool_run_jobs";
+	int job_index                    = 0;
+	int number_of_local_jobs         = 0;
+	int result                       = 1;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	int is_locked                    = 0;
+	int number_of_queued_jobs        = 0;
+#endif
+
+	if( worker_pool == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid worker pool.",
+		 function );
+
+		return( -1 );
+	}
+	if( worker_pool->job_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid worker pool - missing job function.",
+		 function );
+
+		return( -1 );
+	}
+	if( jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_jobs < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of jobs value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		jobs[ job_index ].result = 0;
+	}
+	number_of_local_jobs = number_of_jobs;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	if( ( worker_pool->thread_pool != NULL )
+	 && ( number_of_jobs > 1 ) )
+	{
+		/* The first job is run by the calling thread
+		 */
+		number_of_local_jobs = 1;
+
+		for( job_index = 1;
+		     job_index < number_of_jobs;
+		     job_index++ )
+		{
+			if( libcthreads_thread_pool_push(
+			     worker_pool->thread_pool,
+			     (intptr_t *) &( jobs[ job_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push job: %d onto thread pool queue.",
+				 function,
+				 job_index );
+
+				result = -1;
+
+				break;
+			}
+			number_of_queued_jobs++;
+		}
+	}
+#endif
+	for( job_index = 0;
+	     job_index < number_of_local_jobs;
+	     job_index++ )
+	{
+		if( result != 1 )
+		{
+			break;
+		}
+		job = &( jobs[ job_index ] );
+
+		job->result = worker_pool->job_function(
+		               job->value,
+		               worker_pool->job_function_arguments );
+
+		if( job->result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to run job: %d.",
+			 function,
+			 job_index );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The queued jobs are waited for, also on error, since they reference data of the caller
+	 */
+	if( number_of_queued_jobs > 0 )
+	{
+		if( libcthreads_mutex_grab(
+		     worker_pool->mutex,
+		     ( result == 1 ) ? error : NULL ) != 1 )
+		{
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		else
+		{
+			is_locked = 1;
+		}
+		for( job_index = 1;
+		     job_index <= number_of_queued_jobs;
+		     job_index++ )
+		{
+			job = &( jobs[ job_index ] );
+
+			while( libfsapfs_worker_pool_get_job_result( job ) == 0 )
+			{
+				/* Without the mutex the published result is polled,
+				 * which ends since every job publishes a non-zero result
+				 */
+				if( is_locked == 0 )
+				{
+					continue;
+				}
+				if( libcthreads_condition_wait(
+				     worker_pool->condition,
+				     worker_pool->mutex,
+				     ( result == 1 ) ? error : NULL ) != 1 )
+				{
+					if( result == 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to wait for condition.",
+						 function );
+
+						result = -1;
+					}
+					libcthreads_mutex_release(
+					 worker_pool->mutex,
+					 NULL );
+
+					is_locked = 0;
+				}
+			}
+			if( ( libfsapfs_worker_pool_get_job_result( job ) != 1 )
+			 && ( result == 1 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to run job: %d.",
+				 function,
+				 job_index );
+
+				result = -1;
+			}
+		}
+		if( is_locked != 0 )
+		{
+			if( libcthreads_mutex_release(
+			     worker_pool->mutex,
+			     ( result == 1 ) ? error : NULL ) != 1 )
+			{
+				if( result == 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release mutex.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+	}
+#endif
+	return( result );
+}
@@ -0,0 +1,119 @@
+/*
+ * Worker pool functions
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFSAPFS_WORKER_POOL_H )
+#define _LIBFSAPFS_WORKER_POOL_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfsapfs_libcerror.h"
+#include "libfsapfs_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfsapfs_worker_pool libfsapfs_worker_pool_t;
+
+typedef struct libfsapfs_worker_pool_job libfsapfs_worker_pool_job_t;
+
+struct libfsapfs_worker_pool_job
+{
+	/* The value the job function is called with
+	 */
+	intptr_t *value;
+
+	/* The result of the job, which is 0 while the job has not finished
+	 */
+	int result;
+};
+
+struct libfsapfs_worker_pool
+{
+	/* The number of workers, which includes the calling thread
+	 */
+	int number_of_workers;
+
+	/* The job function
+	 */
+	int (*job_function)(
+	       intptr_t *value,
+	       void *arguments );
+
+	/* The job function arguments
+	 */
+	void *job_function_arguments;
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	/* The thread pool, which contains the number of workers - 1 threads
+	 */
+	libcthreads_thread_pool_t *thread_pool;
+
+	/* The mutex, which protects the results of the jobs
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition, which is signalled when a job has finished
+	 */
+	libcthreads_condition_t *condition;
+#endif
+};
+
+int libfsapfs_worker_pool_initialize(
+     libfsapfs_worker_pool_t **worker_pool,
+     int number_of_workers,
+     int maximum_number_of_workers,
+     int (*job_function)(
+            intptr_t *value,
+            void *arguments ),
+     void *job_function_arguments,
+     libcerror_error_t **error );
+
+int libfsapfs_worker_pool_free(
+     libfsapfs_worker_pool_t **worker_pool,
+     libcerror_error_t **error );
+
+int libfsapfs_worker_pool_get_number_of_workers(
+     libfsapfs_worker_pool_t *worker_pool,
+     int *number_of_workers,
+     libcerror_error_t **error );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+int libfsapfs_worker_pool_thread_callback(
+     libfsapfs_worker_pool_job_t *job,
+     libfsapfs_worker_pool_t *worker_pool );
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+int libfsapfs_worker_pool_run_jobs(
+     libfsapfs_worker_pool_t *worker_pool,
+     libfsapfs_worker_pool_job_t *jobs,
+     int number_of_jobs,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFSAPFS_WORKER_POOL_H ) */
+
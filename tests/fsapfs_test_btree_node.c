@@ -28,6 +28,8 @@
 #include <stdlib.h>
 #endif
 
+#include "fsapfs_test_functions.h"
+#include "fsapfs_test_libbfio.h"
 #include "fsapfs_test_libcerror.h"
 #include "fsapfs_test_libfsapfs.h"
 #include "fsapfs_test_macros.h"
@@ -36,6 +38,8 @@
 
 #include "../libfsapfs/libfsapfs_btree_node.h"
 #include "../libfsapfs/libfsapfs_btree_node_header.h"
+#include "../libfsapfs/libfsapfs_file_system_btree.h"
+#include "../libfsapfs/libfsapfs_io_handle.h"
 
 uint8_t fsapfs_test_btree_node_data1[ 4096 ] = {
 	0x2b, 0xd1, 0x61, 0x9d, 0xcc, 0x04, 0x11, 0xae, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -309,7 +313,7 @@ int fsapfs_test_btree_node_initialize(
 	int result                         = 0;
 
 #if defined( HAVE_FSAPFS_TEST_MEMORY )
-	int number_of_malloc_fail_tests    = 2;
+	int number_of_malloc_fail_tests    = 1;
 	int number_of_memset_fail_tests    = 1;
 	int test_number                    = 0;
 #endif
@@ -531,6 +535,237 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_btree_node_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_btree_node_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle   = NULL;
+	libcerror_error_t *error           = NULL;
+	libfsapfs_btree_node_t *btree_node = NULL;
+	libfsapfs_io_handle_t *io_handle   = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size     = 4096;
+	io_handle->container_size = 4096;
+
+	result = libfsapfs_btree_node_initialize(
+	          &btree_node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          fsapfs_test_btree_node_data1,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_btree_node_read_file_io_handle(
+	          btree_node,
+	          io_handle,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_btree_node_read_file_io_handle(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_btree_node_read_file_io_handle(
+	          btree_node,
+	          NULL,
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_btree_node_read_file_io_handle(
+	          btree_node,
+	          io_handle,
+	          NULL,
+	          file_io_handle,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = fsapfs_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_btree_node_free(
+	          &btree_node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( btree_node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &btree_node,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_btree_node_read_data function
  * Returns 1 if successful or 0 if not
  */
@@ -775,7 +1010,7 @@ int fsapfs_test_btree_node_read_data(
 
 #if defined( HAVE_FSAPFS_TEST_MEMORY )
 
-	/* Test libfsapfs_btree_node_read_data with malloc failing in libfsapfs_btree_entry_initialize
+	/* Test libfsapfs_btree_node_read_data with malloc failing
 	 */
 	fsapfs_test_malloc_attempts_before_fail = 2;
 
@@ -805,6 +1040,136 @@ int fsapfs_test_btree_node_read_data(
 	}
 #endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
 
+#if defined( HAVE_FSAPFS_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED )
+
+	/* Test libfsapfs_btree_node_read_data with memcpy failing
+	 */
+	fsapfs_test_memcpy_attempts_before_fail = 0;
+
+	result = libfsapfs_btree_node_read_data(
+	          btree_node,
+	          fsapfs_test_btree_node_data1,
+	          4096,
+	          &error );
+
+	if( fsapfs_test_memcpy_attempts_before_fail != -1 )
+	{
+		fsapfs_test_memcpy_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
+
+	/* Clean up
+	 */
+	result = libfsapfs_btree_node_free(
+	          &btree_node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( btree_node != NULL )
+	{
+		libfsapfs_btree_node_free(
+		 &btree_node,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_btree_node_read_data_with_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_btree_node_read_data_with_flags(
+     void )
+{
+	libcerror_error_t *error           = NULL;
+	libfsapfs_btree_node_t *btree_node = NULL;
+	int result                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_btree_node_initialize(
+	          &btree_node,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "btree_node",
+	 btree_node );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_btree_node_read_data_with_flags(
+	          btree_node,
+	          fsapfs_test_btree_node_data1,
+	          4096,
+	          LIBFSAPFS_BTREE_NODE_READ_FLAG_REFERENCE_DATA,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_GREATER_THAN_INT(
+	 "btree_node->number_of_entries",
+	 btree_node->number_of_entries,
+	 0 );
+
+	/* The key data of the entries reference the node data
+	 */
+	result = ( btree_node->entries[ 0 ].key_data > fsapfs_test_btree_node_data1 )
+	      && ( btree_node->entries[ 0 ].key_data < &( fsapfs_test_btree_node_data1[ 4096 ] ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	/* Clean up
 	 */
 	result = libfsapfs_btree_node_free(
@@ -1254,6 +1619,179 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_btree_node_search_entry_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_btree_node_search_entry_by_key(
+     libfsapfs_btree_node_t *btree_node )
+{
+	libcerror_error_t *error   = NULL;
+	uint64_t lookup_identifier = 0;
+	int entry_index            = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	lookup_identifier = ( (uint64_t) 3 << 60 ) | 27;
+
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          btree_node,
+	          (intptr_t *) &lookup_identifier,
+	          &libfsapfs_file_system_btree_compare_identifier_with_key_data,
+	          &entry_index,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 2 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Keys are ordered by identifier before data type
+	 */
+	lookup_identifier = ( (uint64_t) 3 << 60 ) | 18;
+
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          btree_node,
+	          (intptr_t *) &lookup_identifier,
+	          &libfsapfs_file_system_btree_compare_identifier_with_key_data,
+	          &entry_index,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	lookup_identifier = ( (uint64_t) 3 << 60 ) | 200;
+
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          btree_node,
+	          (intptr_t *) &lookup_identifier,
+	          &libfsapfs_file_system_btree_compare_identifier_with_key_data,
+	          &entry_index,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 6 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          NULL,
+	          (intptr_t *) &lookup_identifier,
+	          &libfsapfs_file_system_btree_compare_identifier_with_key_data,
+	          &entry_index,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          btree_node,
+	          (intptr_t *) &lookup_identifier,
+	          NULL,
+	          &entry_index,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          btree_node,
+	          (intptr_t *) &lookup_identifier,
+	          &libfsapfs_file_system_btree_compare_identifier_with_key_data,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_btree_node_search_entry_by_key(
+	          btree_node,
+	          NULL,
+	          &libfsapfs_file_system_btree_compare_identifier_with_key_data,
+	          &entry_index,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -1289,10 +1827,18 @@ int main(
 	 "libfsapfs_btree_node_free",
 	 fsapfs_test_btree_node_free );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_btree_node_read_file_io_handle",
+	 fsapfs_test_btree_node_read_file_io_handle );
+
 	FSAPFS_TEST_RUN(
 	 "libfsapfs_btree_node_read_data",
 	 fsapfs_test_btree_node_read_data );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_btree_node_read_data_with_flags",
+	 fsapfs_test_btree_node_read_data_with_flags );
+
 	FSAPFS_TEST_RUN(
 	 "libfsapfs_btree_node_read_object_data",
 	 fsapfs_test_btree_node_read_object_data );
@@ -1348,6 +1894,11 @@ int main(
 	 fsapfs_test_btree_node_get_entry_by_index,
 	 btree_node );
 
+	FSAPFS_TEST_RUN_WITH_ARGS(
+	 "libfsapfs_btree_node_search_entry_by_key",
+	 fsapfs_test_btree_node_search_entry_by_key,
+	 btree_node );
+
 	/* Clean up
 	 */
 	result = libfsapfs_btree_node_free(
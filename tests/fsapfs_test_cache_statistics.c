@@ -0,0 +1,914 @@
+/*
+ * Library cache_statistics type test program
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_cache_statistics.h"
+#include "../libfsapfs/libfsapfs_libcthreads.h"
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+#define FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS		8
+#define FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_ITERATIONS	4096
+
+typedef struct fsapfs_test_cache_statistics_thread_arguments fsapfs_test_cache_statistics_thread_arguments_t;
+
+struct fsapfs_test_cache_statistics_thread_arguments
+{
+	/* The cache statistics
+	 */
+	libfsapfs_cache_statistics_t *cache_statistics;
+
+	/* The result
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_cache_statistics_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cache_statistics_initialize(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsapfs_cache_statistics_t *cache_statistics = NULL;
+	int result                                     = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                = 1;
+	int number_of_memset_fail_tests                = 1;
+	int test_number                                = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_cache_statistics_initialize(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_statistics",
+	 cache_statistics );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cache_statistics_free(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "cache_statistics",
+	 cache_statistics );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cache_statistics_initialize(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	cache_statistics = (libfsapfs_cache_statistics_t *) 0x12345678UL;
+
+	result = libfsapfs_cache_statistics_initialize(
+	          &cache_statistics,
+	          &error );
+
+	cache_statistics = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_cache_statistics_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_cache_statistics_initialize(
+		          &cache_statistics,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( cache_statistics != NULL )
+			{
+				libfsapfs_cache_statistics_free(
+				 &cache_statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "cache_statistics",
+			 cache_statistics );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_cache_statistics_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_cache_statistics_initialize(
+		          &cache_statistics,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( cache_statistics != NULL )
+			{
+				libfsapfs_cache_statistics_free(
+				 &cache_statistics,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "cache_statistics",
+			 cache_statistics );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_statistics != NULL )
+	{
+		libfsapfs_cache_statistics_free(
+		 &cache_statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_cache_statistics_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cache_statistics_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cache_statistics_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_cache_statistics_add_lookups, libfsapfs_cache_statistics_update,
+ * libfsapfs_cache_statistics_get_values and libfsapfs_cache_statistics_clear functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cache_statistics_get_values(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsapfs_cache_statistics_t *cache_statistics = NULL;
+	size64_t read_size                             = 0;
+	size64_t resident_size                         = 0;
+	uint64_t number_of_evictions                   = 0;
+	uint64_t number_of_lookups                     = 0;
+	uint64_t number_of_misses                      = 0;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_cache_statistics_initialize(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_statistics",
+	 cache_statistics );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_cache_statistics_add_lookups(
+	          cache_statistics,
+	          3,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cache_statistics_update(
+	          cache_statistics,
+	          2,
+	          4096,
+	          1024,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cache_statistics_get_values(
+	          cache_statistics,
+	          &number_of_lookups,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &read_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_lookups",
+	 number_of_lookups,
+	 (uint64_t) 3 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) 2 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "resident_size",
+	 resident_size,
+	 (uint64_t) 3072 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_size",
+	 read_size,
+	 (uint64_t) 512 );
+
+	/* Removing more than is resident clamps the resident size to 0
+	 */
+	result = libfsapfs_cache_statistics_update(
+	          cache_statistics,
+	          0,
+	          0,
+	          8192,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cache_statistics_get_values(
+	          cache_statistics,
+	          &number_of_lookups,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &read_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "resident_size",
+	 resident_size,
+	 (uint64_t) 0 );
+
+	result = libfsapfs_cache_statistics_clear(
+	          cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_cache_statistics_get_values(
+	          cache_statistics,
+	          &number_of_lookups,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &read_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_lookups",
+	 number_of_lookups,
+	 (uint64_t) 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_size",
+	 read_size,
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_cache_statistics_add_lookups(
+	          NULL,
+	          1,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_statistics_update(
+	          NULL,
+	          0,
+	          0,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_statistics_clear(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_statistics_get_values(
+	          NULL,
+	          &number_of_lookups,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &read_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_statistics_get_values(
+	          cache_statistics,
+	          NULL,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &read_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_cache_statistics_get_values(
+	          cache_statistics,
+	          &number_of_lookups,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_cache_statistics_free(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( cache_statistics != NULL )
+	{
+		libfsapfs_cache_statistics_free(
+		 &cache_statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+/* Updates the cache statistics repeatedly
+ * Callback function for the threads of fsapfs_test_cache_statistics_update_threaded
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_cache_statistics_update_thread(
+     fsapfs_test_cache_statistics_thread_arguments_t *thread_arguments )
+{
+	int iteration = 0;
+
+	if( thread_arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_arguments->result = -1;
+
+	for( iteration = 0;
+	     iteration < FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		if( libfsapfs_cache_statistics_add_lookups(
+		     thread_arguments->cache_statistics,
+		     1,
+		     iteration % 2,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( libfsapfs_cache_statistics_update(
+		     thread_arguments->cache_statistics,
+		     1,
+		     16,
+		     0,
+		     16,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+	}
+	thread_arguments->result = 1;
+
+	return( 1 );
+}
+
+/* Tests the libfsapfs_cache_statistics_add_lookups and libfsapfs_cache_statistics_update functions with concurrent threads
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_cache_statistics_update_threaded(
+     void )
+{
+	fsapfs_test_cache_statistics_thread_arguments_t thread_arguments[ FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error                       = NULL;
+	libfsapfs_cache_statistics_t *cache_statistics = NULL;
+	size64_t read_size                             = 0;
+	size64_t resident_size                         = 0;
+	uint64_t number_of_evictions                   = 0;
+	uint64_t number_of_lookups                     = 0;
+	uint64_t number_of_misses                      = 0;
+	int result                                     = 0;
+	int thread_index                               = 0;
+
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libfsapfs_cache_statistics_initialize(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_statistics",
+	 cache_statistics );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		thread_arguments[ thread_index ].cache_statistics = cache_statistics;
+		thread_arguments[ thread_index ].result           = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &fsapfs_test_cache_statistics_update_thread,
+		          (void *) &( thread_arguments[ thread_index ] ),
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "thread_arguments[ thread_index ].result",
+		 thread_arguments[ thread_index ].result,
+		 1 );
+	}
+	result = libfsapfs_cache_statistics_get_values(
+	          cache_statistics,
+	          &number_of_lookups,
+	          &number_of_misses,
+	          &number_of_evictions,
+	          &resident_size,
+	          &read_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_lookups",
+	 number_of_lookups,
+	 (uint64_t) ( FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS * FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_ITERATIONS ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) ( FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS * FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_ITERATIONS / 2 ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_evictions",
+	 number_of_evictions,
+	 (uint64_t) ( FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS * FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_ITERATIONS ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "resident_size",
+	 resident_size,
+	 (uint64_t) ( FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS * FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_ITERATIONS * 16 ) );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_size",
+	 read_size,
+	 (uint64_t) ( FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS * FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_ITERATIONS * 16 ) );
+
+	/* Clean up
+	 */
+	result = libfsapfs_cache_statistics_free(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_CACHE_STATISTICS_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cache_statistics != NULL )
+	{
+		libfsapfs_cache_statistics_free(
+		 &cache_statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cache_statistics_initialize",
+	 fsapfs_test_cache_statistics_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cache_statistics_free",
+	 fsapfs_test_cache_statistics_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cache_statistics_get_values",
+	 fsapfs_test_cache_statistics_get_values );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_cache_statistics_update (threaded)",
+	 fsapfs_test_cache_statistics_update_threaded );
+
+#endif
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+}
+
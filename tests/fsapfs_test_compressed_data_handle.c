@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -541,6 +542,295 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_compressed_data_handle_read_compressed_block function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_compressed_data_handle_read_compressed_block(
+     void )
+{
+	uint8_t expected_data[ 16 ] = {
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f };
+
+	libcerror_error_t *error                                   = NULL;
+	libfdata_stream_t *compressed_data_stream                  = NULL;
+	libfsapfs_compressed_data_handle_t *compressed_data_handle = NULL;
+	uint8_t *uncompressed_data                                 = NULL;
+	size_t uncompressed_data_size                              = 0;
+	int result                                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_data_stream_initialize_from_data(
+	          &compressed_data_stream,
+	          fsapfs_test_compressed_data_handle_lzvn_compressed_data1,
+	          35,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data_stream",
+	 compressed_data_stream );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_compressed_data_handle_initialize(
+	          &compressed_data_handle,
+	          compressed_data_stream,
+	          16,
+	          LIBFSAPFS_COMPRESSION_METHOD_LZVN,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "compressed_data_handle",
+	 compressed_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_compressed_data_handle_get_compressed_block_offsets(
+	          compressed_data_handle,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * 65536 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "uncompressed_data",
+	 uncompressed_data );
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 65536;
+
+	result = libfsapfs_compressed_data_handle_read_compressed_block(
+	          compressed_data_handle,
+	          NULL,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 16 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          expected_data,
+	          16 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 65536;
+
+	result = libfsapfs_compressed_data_handle_read_compressed_block(
+	          NULL,
+	          NULL,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_compressed_data_handle_read_compressed_block(
+	          compressed_data_handle,
+	          NULL,
+	          1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_compressed_data_handle_read_compressed_block(
+	          compressed_data_handle,
+	          NULL,
+	          0,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_compressed_data_handle_read_compressed_block(
+	          compressed_data_handle,
+	          NULL,
+	          0,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 16;
+
+	result = libfsapfs_compressed_data_handle_read_compressed_block(
+	          compressed_data_handle,
+	          NULL,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 uncompressed_data );
+
+	uncompressed_data = NULL;
+
+	result = libfsapfs_compressed_data_handle_free(
+	          &compressed_data_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "compressed_data_handle",
+	 compressed_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfdata_stream_free(
+	          &compressed_data_stream,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "compressed_data_stream",
+	 compressed_data_stream );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( uncompressed_data != NULL )
+	{
+		memory_free(
+		 uncompressed_data );
+	}
+	if( compressed_data_handle != NULL )
+	{
+		libfsapfs_compressed_data_handle_free(
+		 &compressed_data_handle,
+		 NULL );
+	}
+	if( compressed_data_stream != NULL )
+	{
+		libfdata_stream_free(
+		 &compressed_data_stream,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_compressed_data_handle_read_segment_data function
  * Returns 1 if successful or 0 if not
  */
@@ -976,6 +1266,10 @@ int main(
 	 "libfsapfs_compressed_data_handle_get_compressed_block_offsets",
 	 fsapfs_test_compressed_data_handle_get_compressed_block_offsets );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_compressed_data_handle_read_compressed_block",
+	 fsapfs_test_compressed_data_handle_read_compressed_block );
+
 	FSAPFS_TEST_RUN(
 	 "libfsapfs_compressed_data_handle_read_segment_data",
 	 fsapfs_test_compressed_data_handle_read_segment_data );
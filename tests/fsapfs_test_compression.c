@@ -28,6 +28,7 @@
 #include <stdlib.h>
 #endif
 
+#include "fsapfs_test_compression_data.h"
 #include "fsapfs_test_libcerror.h"
 #include "fsapfs_test_libfsapfs.h"
 #include "fsapfs_test_macros.h"
@@ -45,6 +46,23 @@ uint8_t fsapfs_test_compression_deflate_uncompressed_data1[ 17 ] = {
 	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
 	0x0f };
 
+uint8_t fsapfs_test_compression_lzfse_compressed_data1[ 171 ] = {
+	0x62, 0x76, 0x78, 0x32, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80, 0x00, 0x00, 0x01, 0x00, 0x70,
+	0x12, 0x58, 0xa1, 0x89, 0x37, 0x08, 0x00, 0x10, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x8f, 0x02, 0xf0, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x0e, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x28,
+	0x3c, 0x0a, 0x8f, 0xc2, 0xa3, 0xf0, 0x28, 0x3c, 0x0a, 0x8f, 0xc2, 0xa3, 0xf0, 0x28, 0x3c, 0x0a,
+	0x8f, 0xc2, 0xa3, 0xf0, 0x28, 0x3c, 0x0a, 0x8f, 0xc2, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8c, 0x04, 0xbf, 0x37, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x76, 0x78, 0x24 };
+
+uint8_t fsapfs_test_compression_lzfse_uncompressed_data1[ 17 ] = {
+	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f };
+
 uint8_t fsapfs_test_compression_lzvn_compressed_data1[ 19 ] = {
 	0xe0, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d,
 	0x0e, 0x0f, 0x06 };
@@ -58,6 +76,186 @@ uint8_t fsapfs_test_compression_uncompressed_data1[ 16 ] = {
 
 #if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
 
+/* Tests the libfsapfs_decompress_raw_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decompress_raw_data(
+     void )
+{
+	uint8_t uncompressed_data[ 32 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 32;
+
+	result = libfsapfs_decompress_raw_data(
+	          fsapfs_test_compression_lzvn_uncompressed_data1,
+	          17,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 16 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          fsapfs_test_compression_uncompressed_data1,
+	          16 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	uncompressed_data_size = 32;
+
+	result = libfsapfs_decompress_raw_data(
+	          NULL,
+	          17,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompress_raw_data(
+	          fsapfs_test_compression_lzvn_uncompressed_data1,
+	          0,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompress_raw_data(
+	          fsapfs_test_compression_lzvn_uncompressed_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompress_raw_data(
+	          fsapfs_test_compression_lzvn_uncompressed_data1,
+	          17,
+	          NULL,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompress_raw_data(
+	          fsapfs_test_compression_lzvn_uncompressed_data1,
+	          17,
+	          uncompressed_data,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the uncompressed data is too small
+	 */
+	uncompressed_data_size = 8;
+
+	result = libfsapfs_decompress_raw_data(
+	          fsapfs_test_compression_lzvn_uncompressed_data1,
+	          17,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_decompress_data function
  * Returns 1 if successful or 0 if not
  */
@@ -208,6 +406,74 @@ int fsapfs_test_decompress_data(
 	 result,
 	 0 );
 
+	uncompressed_data_size = 16;
+
+	result = libfsapfs_decompress_data(
+	          fsapfs_test_compression_lzfse_compressed_data1,
+	          171,
+	          LIBFSAPFS_COMPRESSION_METHOD_LZFSE,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 16 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          fsapfs_test_compression_uncompressed_data1,
+	          16 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	uncompressed_data_size = 16;
+
+	result = libfsapfs_decompress_data(
+	          fsapfs_test_compression_lzfse_uncompressed_data1,
+	          17,
+	          LIBFSAPFS_COMPRESSION_METHOD_LZFSE,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 16 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          fsapfs_test_compression_uncompressed_data1,
+	          16 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	uncompressed_data_size = 16;
@@ -517,6 +783,72 @@ int fsapfs_test_decompress_data(
 	}
 #endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) && defined( OPTIMIZATION_DISABLED ) */
 
+	uncompressed_data_size = 16;
+
+	result = libfsapfs_decompress_data(
+	          fsapfs_test_compression_lzfse_compressed_data1,
+	          171 - 4,
+	          LIBFSAPFS_COMPRESSION_METHOD_LZFSE,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 8;
+
+	result = libfsapfs_decompress_data(
+	          fsapfs_test_compression_lzfse_compressed_data1,
+	          171,
+	          LIBFSAPFS_COMPRESSION_METHOD_LZFSE,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	uncompressed_data_size = 8;
+
+	result = libfsapfs_decompress_data(
+	          fsapfs_test_compression_lzfse_uncompressed_data1,
+	          17,
+	          LIBFSAPFS_COMPRESSION_METHOD_LZFSE,
+	          uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -528,6 +860,126 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_decompress_data function with the same data compressed with each compression method
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decompress_data_compression_methods(
+     void )
+{
+	uint8_t deflate_uncompressed_data[ 4096 ];
+	uint8_t lzfse_uncompressed_data[ 4096 ];
+	uint8_t lzvn_uncompressed_data[ 4096 ];
+
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	uncompressed_data_size = 4096;
+
+	result = libfsapfs_decompress_data(
+	          fsapfs_test_compression_data_deflate_compressed_data4096,
+	          1244,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          deflate_uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = 4096;
+
+	result = libfsapfs_decompress_data(
+	          fsapfs_test_compression_data_lzfse_compressed_data4096,
+	          1460,
+	          LIBFSAPFS_COMPRESSION_METHOD_LZFSE,
+	          lzfse_uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	uncompressed_data_size = 4096;
+
+	result = libfsapfs_decompress_data(
+	          fsapfs_test_compression_data_lzvn_compressed_data4096,
+	          1974,
+	          LIBFSAPFS_COMPRESSION_METHOD_LZVN,
+	          lzvn_uncompressed_data,
+	          &uncompressed_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* All compression methods should produce the same uncompressed data
+	 */
+	result = memory_compare(
+	          lzfse_uncompressed_data,
+	          deflate_uncompressed_data,
+	          4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          lzvn_uncompressed_data,
+	          deflate_uncompressed_data,
+	          4096 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -547,10 +999,18 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decompress_raw_data",
+	 fsapfs_test_decompress_raw_data );
+
 	FSAPFS_TEST_RUN(
 	 "libfsapfs_decompress_data",
 	 fsapfs_test_decompress_data );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decompress_data (compression methods)",
+	 fsapfs_test_decompress_data_compression_methods );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,331 @@
+/*
+ * Library compression test data
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FSAPFS_TEST_COMPRESSION_DATA_H )
+#define _FSAPFS_TEST_COMPRESSION_DATA_H
+
+#include <common.h>
+#include <types.h>
+
+/* The same 4096 bytes of data compressed with each of the supported compression methods
+ */
+uint8_t fsapfs_test_compression_data_deflate_compressed_data4096[ 1244 ] = {
+	0x78, 0xda, 0xd5, 0x57, 0x6d, 0x6f, 0xe2, 0x46, 0x10, 0xfe, 0x0c, 0xbf, 0x62, 0x94, 0xaa, 0x27,
+	0x40, 0x04, 0x92, 0x54, 0xaa, 0x4e, 0xc9, 0x25, 0xaa, 0x03, 0x26, 0x71, 0x05, 0x06, 0xd9, 0xf8,
+	0x72, 0x5c, 0x55, 0x59, 0xc6, 0x5e, 0xe3, 0xed, 0xf9, 0x85, 0xee, 0xae, 0x43, 0x48, 0xaf, 0xff,
+	0xbd, 0xb3, 0xb6, 0x09, 0xaf, 0x46, 0xa9, 0x94, 0x4a, 0x29, 0x1f, 0x2c, 0x7b, 0x66, 0xf6, 0xd9,
+	0x67, 0x9e, 0x19, 0xcf, 0x9a, 0x76, 0xa3, 0x0a, 0x0d, 0xe8, 0x24, 0xd1, 0x9c, 0x11, 0xce, 0x69,
+	0x12, 0x83, 0x9f, 0xc6, 0xae, 0xc0, 0x1b, 0x8e, 0x8e, 0xdc, 0x37, 0x5f, 0x32, 0x3a, 0x0b, 0x04,
+	0xd4, 0x3a, 0x75, 0xb8, 0x38, 0x3b, 0xff, 0x78, 0x7a, 0x71, 0x76, 0xf1, 0x73, 0x13, 0x7e, 0x4d,
+	0x1c, 0x37, 0xa0, 0x11, 0x0c, 0x88, 0x78, 0x86, 0x4f, 0x7f, 0xe4, 0x4f, 0xad, 0x08, 0x9f, 0x7e,
+	0x99, 0x45, 0x0e, 0x0d, 0x5b, 0x6e, 0x12, 0xdd, 0x14, 0x20, 0x06, 0xf1, 0x09, 0x03, 0x91, 0x80,
+	0x62, 0x8d, 0xef, 0x87, 0x86, 0x09, 0x7e, 0xc2, 0xc0, 0x71, 0xbf, 0xc5, 0xc9, 0x22, 0x24, 0xde,
+	0x8c, 0x44, 0x24, 0x16, 0xbc, 0x55, 0x04, 0x8f, 0x03, 0xca, 0x61, 0xce, 0x92, 0x19, 0x73, 0x22,
+	0xc0, 0x5b, 0x9f, 0x11, 0x02, 0x3c, 0xf1, 0xc5, 0xc2, 0x61, 0xe4, 0x12, 0x96, 0x49, 0x0a, 0xae,
+	0x13, 0x03, 0x23, 0x1e, 0xe5, 0x82, 0xd1, 0x69, 0x2a, 0x08, 0x50, 0x01, 0x4e, 0xec, 0xb5, 0x11,
+	0x35, 0x4a, 0x3c, 0xea, 0x2f, 0x25, 0x0e, 0xda, 0xd2, 0xd8, 0x93, 0xfb, 0x06, 0x04, 0x04, 0x61,
+	0x11, 0x87, 0xc4, 0xcf, 0x1e, 0xee, 0x74, 0x0b, 0xfa, 0x98, 0x2f, 0xfa, 0xee, 0x48, 0x4c, 0x98,
+	0x13, 0xc2, 0x28, 0x9d, 0x86, 0xd4, 0x85, 0x3e, 0x75, 0x49, 0xcc, 0x09, 0x38, 0xc8, 0x40, 0x5a,
+	0x78, 0x40, 0x3c, 0x98, 0x66, 0x70, 0x72, 0x61, 0x4f, 0x52, 0x31, 0x0b, 0x2a, 0xd0, 0x4b, 0x10,
+	0xdf, 0x91, 0x62, 0x35, 0x81, 0x50, 0xf4, 0x33, 0x78, 0x24, 0x2c, 0x53, 0xf1, 0xa7, 0xd5, 0x56,
+	0x05, 0x60, 0x13, 0x12, 0x26, 0x41, 0x6a, 0x8e, 0x90, 0x09, 0x30, 0x48, 0xe6, 0x72, 0x5d, 0x1d,
+	0x59, 0x2f, 0x21, 0x74, 0xc4, 0x7a, 0x69, 0x99, 0x0a, 0xeb, 0x64, 0x3d, 0xa0, 0x71, 0x86, 0x1d,
+	0x24, 0x73, 0x4c, 0x2c, 0x40, 0x48, 0x4c, 0x75, 0x41, 0xc3, 0x10, 0xa6, 0x04, 0x52, 0x4e, 0xfc,
+	0x34, 0x6c, 0x4a, 0x08, 0x0c, 0x86, 0x07, 0x0d, 0x05, 0xb7, 0xc6, 0xa0, 0xe8, 0x13, 0x78, 0x50,
+	0x0c, 0x43, 0xd1, 0xc7, 0x93, 0x2b, 0x0c, 0x16, 0x41, 0x82, 0x5e, 0xf2, 0x48, 0x72, 0x28, 0x1a,
+	0xcd, 0x43, 0x8a, 0xc8, 0x98, 0x17, 0x73, 0x62, 0xb1, 0x44, 0xfa, 0x12, 0x61, 0xa0, 0x1a, 0x9d,
+	0x7b, 0x5c, 0xa2, 0xdc, 0x6a, 0x7d, 0x6d, 0x3c, 0xc1, 0x24, 0xa0, 0xa7, 0x8d, 0x75, 0xd5, 0x34,
+	0xa1, 0x37, 0x34, 0x40, 0x81, 0x91, 0x62, 0x8c, 0xb5, 0x8e, 0xd5, 0x57, 0x0c, 0x18, 0x59, 0xc6,
+	0x68, 0x68, 0xaa, 0x2d, 0x00, 0x93, 0x48, 0x5a, 0x44, 0x02, 0x48, 0xa5, 0x4b, 0x24, 0xf6, 0xb3,
+	0x62, 0xa1, 0x8c, 0x1e, 0x11, 0xd8, 0x2e, 0x2f, 0xe5, 0x9f, 0x60, 0x7d, 0x39, 0xb2, 0x0b, 0x3d,
+	0x08, 0x9c, 0x47, 0x82, 0x75, 0x76, 0x09, 0x7d, 0x44, 0x6e, 0x0e, 0xb8, 0xd8, 0x8b, 0xaf, 0xae,
+	0xa1, 0xc4, 0x72, 0xc2, 0x24, 0x9e, 0x65, 0xd9, 0xe2, 0x9a, 0xb5, 0x9e, 0xc8, 0x51, 0xf3, 0x21,
+	0x4e, 0x44, 0x13, 0x38, 0x72, 0xfd, 0x14, 0x08, 0x31, 0xe7, 0x97, 0xed, 0xf6, 0x62, 0xb1, 0x68,
+	0xcd, 0xe2, 0xb4, 0x95, 0xb0, 0x59, 0x3b, 0xcc, 0x51, 0x78, 0xfb, 0x46, 0x12, 0x6b, 0x57, 0xab,
+	0x3f, 0xd0, 0xd8, 0x0d, 0x53, 0x0f, 0xc3, 0xb1, 0xb1, 0x23, 0x2c, 0x54, 0x70, 0xb3, 0x61, 0x8b,
+	0x08, 0xe6, 0xb2, 0xdc, 0xb6, 0x89, 0xe5, 0x9c, 0x70, 0x69, 0x42, 0x9b, 0x8f, 0x69, 0xfa, 0x34,
+	0x26, 0x5e, 0x0d, 0xee, 0x95, 0xcf, 0xaa, 0x6d, 0x8e, 0xbb, 0x7d, 0xed, 0xd6, 0xbe, 0x87, 0x3a,
+	0x7c, 0xff, 0xbe, 0xf6, 0x3d, 0x68, 0xba, 0x32, 0xd2, 0xa0, 0xbe, 0x81, 0xc2, 0x85, 0x17, 0xd2,
+	0x69, 0x86, 0x4c, 0x62, 0xec, 0xed, 0x43, 0x68, 0x5f, 0x11, 0x6b, 0x07, 0x49, 0x9a, 0xec, 0x6e,
+	0xbf, 0xbf, 0x85, 0xf5, 0xbc, 0x87, 0x54, 0x78, 0x4e, 0xd0, 0xe1, 0x73, 0x67, 0xee, 0x73, 0xdb,
+	0x5d, 0x0f, 0x83, 0x56, 0x70, 0x72, 0x30, 0x24, 0xdb, 0x84, 0x66, 0x53, 0xe2, 0x48, 0x88, 0x6c,
+	0xeb, 0x32, 0x37, 0xde, 0xb9, 0x84, 0xb1, 0x84, 0x1d, 0x0b, 0xc0, 0x02, 0xe1, 0xab, 0x7c, 0x24,
+	0xc2, 0x8f, 0x92, 0x8c, 0x40, 0xb5, 0xdd, 0x80, 0x2e, 0x59, 0x11, 0x27, 0xf8, 0xb2, 0x38, 0xc2,
+	0xc1, 0x37, 0x81, 0x62, 0xf1, 0x65, 0xaf, 0x6c, 0xa4, 0x04, 0x38, 0xa0, 0x82, 0xc4, 0xcb, 0x87,
+	0x92, 0x48, 0x59, 0xcc, 0xe1, 0x1c, 0xd0, 0xcc, 0x53, 0xd7, 0xc5, 0x88, 0x26, 0x9c, 0xc9, 0x27,
+	0x1f, 0x1b, 0x32, 0xc5, 0xd6, 0xc4, 0x16, 0x3d, 0xcd, 0xdc, 0x19, 0xd7, 0xac, 0x0f, 0x68, 0x2c,
+	0x60, 0x33, 0xcd, 0x15, 0xb6, 0x2d, 0xf7, 0xac, 0x55, 0x41, 0xfe, 0x5c, 0x14, 0x06, 0x87, 0x0f,
+	0x86, 0x7e, 0xb4, 0x05, 0x34, 0x5e, 0x88, 0x79, 0x59, 0x50, 0x33, 0x0f, 0xe2, 0xf4, 0x99, 0xa0,
+	0x77, 0xc7, 0x69, 0x4b, 0x73, 0x11, 0x21, 0xb7, 0xda, 0xa0, 0x6e, 0xe7, 0xd4, 0x0b, 0xe7, 0x0b,
+	0x3a, 0xce, 0xeb, 0x63, 0xf8, 0xfb, 0xfe, 0xcd, 0x2d, 0x5e, 0xea, 0x60, 0xe7, 0x57, 0x8c, 0x6f,
+	0x64, 0x77, 0xd8, 0x36, 0x7f, 0x55, 0x2b, 0x5c, 0xe0, 0x78, 0x73, 0xc1, 0x0d, 0x1c, 0x06, 0x8d,
+	0xd5, 0xc9, 0x00, 0x5b, 0xbf, 0xeb, 0xed, 0xaa, 0x6f, 0xc9, 0x71, 0x72, 0x55, 0xad, 0xc8, 0x24,
+	0xd0, 0x90, 0x86, 0x02, 0xca, 0x7e, 0xd7, 0x70, 0x76, 0x95, 0x77, 0x75, 0xed, 0x70, 0x5f, 0x7f,
+	0xf8, 0x70, 0xc0, 0x6e, 0x5b, 0x7a, 0x67, 0x38, 0x18, 0x19, 0x72, 0x18, 0xd5, 0xcb, 0x9b, 0xbf,
+	0x92, 0xf6, 0x71, 0x06, 0xf8, 0x20, 0x5b, 0xdf, 0x3e, 0xac, 0x45, 0x4e, 0x60, 0xf5, 0x4e, 0x54,
+	0xa8, 0x5f, 0xdb, 0xad, 0x0a, 0x5c, 0x5f, 0x83, 0x6e, 0xe5, 0x78, 0x28, 0x4b, 0x65, 0x57, 0x36,
+	0x4e, 0x44, 0x0d, 0xcd, 0x79, 0x9b, 0x34, 0xe5, 0x1d, 0x12, 0xe8, 0xa8, 0x86, 0x31, 0x34, 0xec,
+	0xfc, 0xda, 0x1d, 0x0e, 0x14, 0x4d, 0xb7, 0x15, 0xe3, 0xce, 0x1a, 0xa8, 0xfa, 0xd8, 0xdc, 0x09,
+	0x5a, 0xd9, 0x8b, 0x68, 0x4d, 0xff, 0xac, 0xf4, 0xb5, 0xae, 0x8d, 0x57, 0x4b, 0xcd, 0x42, 0x4f,
+	0x7e, 0xe4, 0x97, 0xd8, 0x10, 0x8f, 0x4e, 0x48, 0xbd, 0x0d, 0x76, 0x79, 0xa7, 0x4f, 0x53, 0x1f,
+	0xcf, 0xd7, 0xd6, 0x49, 0x16, 0xf9, 0x52, 0xa6, 0x3a, 0x8a, 0x5a, 0xa9, 0xb0, 0xac, 0xcb, 0x6b,
+	0xb2, 0x8f, 0xd1, 0x50, 0xf9, 0x3b, 0xcf, 0x6f, 0x4f, 0x88, 0x77, 0x96, 0xe1, 0x26, 0xbf, 0x37,
+	0xcd, 0x71, 0xd7, 0xf4, 0x9e, 0x0b, 0x0a, 0xe4, 0xcf, 0xd4, 0x09, 0xf9, 0x7f, 0x23, 0x46, 0xd1,
+	0xf9, 0xef, 0xbc, 0xea, 0x92, 0xe4, 0xbf, 0x49, 0x73, 0x7f, 0x5c, 0xca, 0x14, 0x91, 0x4f, 0xcf,
+	0x54, 0x46, 0x3d, 0xd3, 0x5e, 0x4d, 0x0c, 0x6d, 0xa8, 0xdb, 0x03, 0x15, 0x3f, 0x8d, 0xba, 0x76,
+	0x57, 0xed, 0xf5, 0x95, 0xb1, 0xba, 0x92, 0x40, 0xa2, 0xd4, 0x0e, 0x4e, 0x65, 0xb8, 0xb9, 0xc6,
+	0xb3, 0xa2, 0x2e, 0xb9, 0xe0, 0x40, 0xda, 0x8b, 0xf9, 0x0d, 0x8f, 0x8e, 0xdf, 0xe5, 0x6e, 0x67,
+	0x4f, 0xbe, 0x2f, 0x27, 0x12, 0x06, 0x4a, 0xc0, 0x43, 0xf3, 0xa4, 0xc0, 0x83, 0x5a, 0x3e, 0xa4,
+	0xeb, 0x80, 0x8c, 0xbe, 0xaa, 0xf6, 0x40, 0xf9, 0x92, 0x2d, 0xcb, 0xd7, 0x95, 0x55, 0x63, 0xb3,
+	0x1e, 0xaf, 0xac, 0xc8, 0xb1, 0x9a, 0x64, 0xb5, 0xb0, 0xd5, 0x2f, 0x1d, 0x55, 0xed, 0x9a, 0x92,
+	0x82, 0x36, 0xb0, 0x06, 0xc5, 0xa2, 0xa3, 0x4d, 0x9a, 0xe5, 0x80, 0xae, 0x94, 0x00, 0x79, 0x72,
+	0x09, 0xf1, 0x38, 0x44, 0xce, 0x13, 0x8d, 0xd2, 0x28, 0xaf, 0xd8, 0x7e, 0xcd, 0xf6, 0xaa, 0x56,
+	0x91, 0x75, 0xcb, 0x15, 0x2a, 0x39, 0xa7, 0xfe, 0x6f, 0x22, 0x1d, 0x6e, 0xe1, 0xb7, 0x93, 0xa9,
+	0xa4, 0x95, 0x4e, 0x65, 0x67, 0xa2, 0x56, 0x65, 0x2a, 0xbe, 0x95, 0x60, 0x86, 0xa5, 0x8f, 0xb5,
+	0x81, 0xba, 0x17, 0x54, 0xd8, 0xb7, 0xd4, 0xc2, 0xbf, 0x1d, 0xf6, 0xb0, 0x67, 0xdf, 0x0e, 0x2d,
+	0xbd, 0x6b, 0x6e, 0x6a, 0xf5, 0x0a, 0x85, 0x8e, 0x4d, 0x82, 0xd7, 0x0b, 0xd6, 0x28, 0x3d, 0xef,
+	0xcb, 0x44, 0xcc, 0xe1, 0xa4, 0xd0, 0xf9, 0x07, 0xbd, 0x2d, 0xff, 0x72, 0x64, 0xf2, 0xe4, 0x1f,
+	0x5d, 0xfb, 0xdf, 0x5a, 0x2b, 0xd7, 0x87, 0x03, 0x03, 0xe1, 0x1c, 0x07, 0x42, 0x7d, 0x1d, 0x52,
+	0x5a, 0x9c, 0xcd, 0x31, 0xfc, 0x26, 0x65, 0x1a, 0xa8, 0x83, 0xa1, 0x31, 0xd9, 0x8b, 0xc9, 0xcd,
+	0x45, 0x68, 0x67, 0x38, 0x9a, 0xd8, 0xff, 0x00, 0xab, 0x0b, 0xea, 0xe0 };
+
+uint8_t fsapfs_test_compression_data_lzfse_compressed_data4096[ 1460 ] = {
+	0x62, 0x76, 0x78, 0x32, 0x00, 0x10, 0x00, 0x00, 0x40, 0x04, 0xe0, 0x2f, 0x00, 0xd8, 0x00, 0x00,
+	0x09, 0xb9, 0xd3, 0x81, 0x1c, 0xf5, 0x01, 0x40, 0xbd, 0x00, 0x00, 0x00, 0x3e, 0x94, 0xa0, 0x01,
+	0x5f, 0xc0, 0x45, 0xd2, 0xd4, 0xa8, 0x8a, 0x1a, 0x05, 0x8e, 0x4f, 0xc6, 0x48, 0x12, 0xd5, 0xb9,
+	0xc2, 0x12, 0x14, 0x93, 0x8e, 0x93, 0x65, 0x2f, 0xf6, 0xde, 0x07, 0x6b, 0x1f, 0x9c, 0x1d, 0x5c,
+	0x8c, 0xf3, 0xcb, 0x35, 0x1e, 0x83, 0x5e, 0xe4, 0x24, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+	0x00, 0x80, 0x0f, 0xe0, 0x14, 0x00, 0x00, 0x00, 0x00, 0x80, 0x57, 0x84, 0x11, 0x1c, 0x1c, 0x1c,
+	0x6d, 0xf6, 0xb8, 0x38, 0x58, 0x2b, 0x82, 0x48, 0x46, 0xd6, 0xc2, 0xc3, 0xb5, 0x0f, 0xce, 0x76,
+	0xd6, 0xa5, 0x5c, 0xdd, 0x5c, 0x5d, 0x6d, 0x0e, 0x8f, 0xce, 0x8e, 0x12, 0x97, 0x22, 0xe7, 0x3c,
+	0x01, 0x07, 0x97, 0xd7, 0x4f, 0xc2, 0xf9, 0xc1, 0xe1, 0x3b, 0xa0, 0xc7, 0xa7, 0x5f, 0xc0, 0x2f,
+	0x70, 0xe2, 0x23, 0xf0, 0x0b, 0xfc, 0x03, 0x0f, 0xc0, 0xda, 0xd9, 0x55, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x40, 0xb1, 0x7f, 0xb3, 0x0c, 0x3e, 0x94, 0xdb, 0x23, 0x6b, 0x5d, 0xf3, 0x5f, 0xae,
+	0x17, 0x20, 0x80, 0xd1, 0xd8, 0x99, 0xf3, 0x49, 0x64, 0xc3, 0x02, 0x40, 0x65, 0xca, 0x08, 0xcb,
+	0x12, 0x2e, 0x36, 0x5e, 0xec, 0x3e, 0x8a, 0xfd, 0x9e, 0x7a, 0x31, 0x21, 0x84, 0x14, 0x2d, 0x8a,
+	0x32, 0x03, 0xfb, 0x9c, 0x94, 0x4e, 0x6e, 0x2e, 0x22, 0xc1, 0x4d, 0x22, 0xc5, 0x0e, 0xc6, 0xb6,
+	0x82, 0x6b, 0x54, 0x9e, 0xdf, 0xed, 0x14, 0xce, 0x97, 0xbc, 0x65, 0xb2, 0x14, 0x5f, 0xef, 0xa6,
+	0x13, 0x39, 0x31, 0x47, 0x64, 0x15, 0xf1, 0xfc, 0x6f, 0x09, 0x16, 0x07, 0x6b, 0xc9, 0x46, 0xf6,
+	0xab, 0x2f, 0xb7, 0xb3, 0x2d, 0xe7, 0x0f, 0x0a, 0x80, 0x62, 0x6d, 0xec, 0xa2, 0xca, 0x8c, 0xdd,
+	0x85, 0x0b, 0x9d, 0xab, 0x63, 0x17, 0xb5, 0xb3, 0x8a, 0x8f, 0x2d, 0xf1, 0xdc, 0x09, 0x83, 0xab,
+	0xfc, 0x57, 0x85, 0xd0, 0xc0, 0x7c, 0x68, 0xeb, 0x83, 0xb3, 0x51, 0x86, 0x72, 0x86, 0x95, 0xb3,
+	0x4e, 0xb2, 0x50, 0xb9, 0xcf, 0x7c, 0xdc, 0xf6, 0x09, 0xcc, 0x50, 0x0e, 0x57, 0x55, 0x51, 0xcf,
+	0x41, 0xd4, 0xda, 0xd1, 0x67, 0xf2, 0xae, 0x8a, 0xa5, 0xbb, 0x48, 0x5e, 0x05, 0x3c, 0x40, 0xe2,
+	0xad, 0x24, 0x43, 0xd3, 0x20, 0x13, 0x2e, 0xbe, 0xa5, 0x30, 0xbb, 0x65, 0x43, 0x9b, 0x81, 0x32,
+	0x74, 0x77, 0x84, 0x45, 0xac, 0x3f, 0xa1, 0x4e, 0xd7, 0xf6, 0x26, 0xf9, 0x2d, 0x8c, 0x25, 0xaf,
+	0x36, 0xe2, 0x99, 0x18, 0x87, 0xb6, 0xf5, 0x2e, 0x95, 0xc6, 0x01, 0xac, 0x72, 0x07, 0xf5, 0x17,
+	0x92, 0x5a, 0x12, 0xa6, 0xb7, 0x69, 0xd4, 0x52, 0xb0, 0xff, 0xb1, 0x6f, 0x1b, 0x32, 0xdc, 0xc5,
+	0x6e, 0x19, 0xf4, 0x9b, 0xb2, 0x6c, 0xcb, 0x3b, 0x17, 0xa2, 0xad, 0x8b, 0xc2, 0x1e, 0x86, 0xae,
+	0xe6, 0x61, 0x73, 0x78, 0x67, 0xda, 0x89, 0xdb, 0x9a, 0xed, 0xe0, 0xfc, 0xc8, 0x13, 0x73, 0xc5,
+	0xfa, 0xa1, 0x09, 0xe2, 0xd2, 0xb4, 0x0a, 0x7e, 0x29, 0x92, 0xf2, 0x0a, 0x51, 0x3c, 0x73, 0xd1,
+	0x42, 0x8e, 0x9f, 0xf6, 0x15, 0xdb, 0x95, 0xaa, 0x87, 0xad, 0x14, 0x45, 0x7e, 0x3e, 0x9e, 0x87,
+	0x9d, 0x09, 0x6d, 0x21, 0xe1, 0xf4, 0xd9, 0xf4, 0xc1, 0x1c, 0x99, 0x29, 0x38, 0x8d, 0x30, 0x9f,
+	0x3e, 0xdf, 0x0c, 0xce, 0x87, 0xb7, 0x60, 0x19, 0x44, 0x68, 0x5d, 0xad, 0xe2, 0x40, 0x71, 0x54,
+	0xf9, 0x50, 0x9d, 0x90, 0x78, 0x12, 0x14, 0x97, 0xe9, 0xf0, 0x64, 0xea, 0x73, 0xad, 0x1e, 0xb0,
+	0xa5, 0x48, 0xfd, 0xb6, 0x6b, 0x02, 0xcd, 0xb5, 0xfd, 0x31, 0x3b, 0x79, 0x17, 0xc6, 0xcc, 0x48,
+	0xe0, 0x2d, 0x80, 0xce, 0xb3, 0x57, 0xfe, 0x29, 0xa7, 0x6f, 0x49, 0x19, 0x00, 0xa7, 0x55, 0x8d,
+	0x04, 0xba, 0x67, 0x3f, 0x4a, 0x1a, 0x47, 0x67, 0x08, 0x73, 0x7f, 0x88, 0x2d, 0xcc, 0xc2, 0x9e,
+	0x0f, 0x38, 0xb4, 0xe2, 0x69, 0x88, 0x1a, 0x18, 0x42, 0x48, 0x05, 0x0d, 0x24, 0x01, 0xcf, 0x19,
+	0x38, 0x80, 0x5a, 0x3d, 0x54, 0x3c, 0xf0, 0x61, 0x3d, 0x42, 0x63, 0x18, 0xa6, 0xd4, 0xec, 0x00,
+	0x92, 0x97, 0x37, 0x54, 0x99, 0xa3, 0x37, 0x9c, 0x63, 0xf1, 0x17, 0xf3, 0xa8, 0x59, 0x90, 0x31,
+	0x7d, 0x83, 0x79, 0xed, 0x5b, 0xd9, 0x5f, 0xe3, 0x72, 0x48, 0x44, 0x8b, 0x78, 0x47, 0x23, 0x8b,
+	0x23, 0x5a, 0x9b, 0x87, 0xdd, 0x06, 0x9f, 0xd4, 0x8a, 0x20, 0xeb, 0x01, 0x31, 0x6f, 0xd8, 0xa5,
+	0x1e, 0xe2, 0xb9, 0x91, 0x63, 0x68, 0x4f, 0x0b, 0xbb, 0xba, 0x11, 0xf8, 0x3e, 0x79, 0x6f, 0xef,
+	0xd9, 0xfd, 0x81, 0x0b, 0x37, 0x61, 0xf2, 0x6e, 0xd7, 0xe0, 0x06, 0x02, 0xf5, 0x52, 0x6c, 0x23,
+	0xc0, 0x9e, 0xa6, 0x16, 0x23, 0xb4, 0x7c, 0xf4, 0xa4, 0xe5, 0xa4, 0x46, 0xe3, 0x15, 0x57, 0x87,
+	0x64, 0xae, 0x81, 0x36, 0x49, 0x8c, 0xd7, 0xe2, 0x63, 0xae, 0x11, 0x63, 0xd8, 0x11, 0xb8, 0x8e,
+	0x73, 0xc1, 0xba, 0x38, 0xe5, 0xb9, 0xb0, 0x2f, 0x99, 0x00, 0x70, 0xc5, 0x1e, 0x45, 0x0f, 0x9c,
+	0x7d, 0xfe, 0xf9, 0x09, 0x5c, 0x18, 0x30, 0x67, 0xd9, 0x09, 0x17, 0x62, 0x2a, 0x5f, 0xeb, 0xf7,
+	0x63, 0x3b, 0x3b, 0xa6, 0xed, 0x35, 0xc1, 0x9f, 0x19, 0x14, 0x42, 0xcd, 0x1d, 0x4a, 0x07, 0x11,
+	0x5d, 0x9a, 0x12, 0x85, 0xd2, 0xe2, 0x4a, 0xf9, 0x6a, 0x02, 0x28, 0xae, 0xc2, 0x96, 0xb2, 0xc3,
+	0xd1, 0x26, 0x5c, 0xc9, 0x62, 0xc7, 0x8c, 0x95, 0x36, 0x84, 0x57, 0x6e, 0x21, 0x00, 0x51, 0x10,
+	0x7d, 0x71, 0xaf, 0xfb, 0xda, 0x46, 0xfd, 0xb3, 0x88, 0xdc, 0x4c, 0x13, 0xa3, 0xc3, 0xd4, 0x8c,
+	0x19, 0xbf, 0x23, 0xc7, 0x84, 0x1c, 0xca, 0x0b, 0xf4, 0x28, 0x1a, 0xfe, 0xda, 0x66, 0x3c, 0xfa,
+	0x60, 0x09, 0xc2, 0xc2, 0x6f, 0x23, 0xf9, 0xc0, 0xf8, 0x6b, 0x53, 0xff, 0x6b, 0x71, 0x5e, 0x6a,
+	0x72, 0xa0, 0xe6, 0x1f, 0x5e, 0x56, 0x4d, 0xd1, 0x12, 0xe2, 0x5e, 0xbd, 0x17, 0x26, 0x1e, 0xd1,
+	0xb5, 0x9e, 0xf0, 0x94, 0x1e, 0x25, 0x8d, 0x90, 0xc0, 0xe1, 0x06, 0x89, 0x49, 0x1e, 0xa5, 0xe5,
+	0x14, 0x00, 0xe8, 0xbd, 0x65, 0x81, 0x2e, 0xd6, 0xdf, 0xfe, 0x08, 0x05, 0xd0, 0x56, 0xda, 0xf6,
+	0x4a, 0xa4, 0x0b, 0xec, 0x2c, 0x48, 0x0f, 0x8e, 0xe6, 0xeb, 0xd0, 0x68, 0x42, 0x83, 0x9f, 0x2b,
+	0x88, 0xa6, 0xa4, 0x6c, 0xcb, 0xfc, 0x66, 0x05, 0xf2, 0x76, 0xec, 0x63, 0xd5, 0xdc, 0x4b, 0x21,
+	0x11, 0x0a, 0xb9, 0x94, 0xe5, 0xbc, 0x4a, 0xf8, 0xa8, 0xb7, 0x01, 0x00, 0x00, 0x96, 0x06, 0x8e,
+	0x9f, 0x8f, 0x3a, 0x4c, 0xe2, 0xac, 0x01, 0x63, 0x28, 0x18, 0xa3, 0x7f, 0x61, 0x0d, 0x6f, 0x43,
+	0x5f, 0x9f, 0xbc, 0x52, 0x45, 0xe7, 0x9e, 0x5f, 0x80, 0x2b, 0x93, 0xdd, 0xf3, 0xfc, 0x7d, 0xcf,
+	0x9d, 0x78, 0x55, 0xff, 0x3b, 0x03, 0xfd, 0x6e, 0xee, 0x66, 0xbd, 0xb1, 0x1d, 0xf6, 0xc0, 0xe5,
+	0x36, 0xde, 0x8b, 0xf1, 0x6a, 0xce, 0x68, 0xeb, 0x42, 0x29, 0x52, 0xa1, 0x7a, 0x0c, 0x7d, 0x83,
+	0x71, 0x55, 0x24, 0x9e, 0x41, 0xd4, 0xfa, 0x5f, 0xe9, 0x12, 0xa2, 0xb4, 0xea, 0x12, 0x30, 0x03,
+	0x59, 0xa2, 0x23, 0x1c, 0xa7, 0x6c, 0xb0, 0xee, 0x11, 0xf0, 0x81, 0xf3, 0x3a, 0x16, 0x76, 0x6f,
+	0x7a, 0xe9, 0xb7, 0xa3, 0x89, 0x35, 0xfc, 0xd9, 0xa5, 0x69, 0x4a, 0x66, 0x49, 0x64, 0xff, 0x8f,
+	0x89, 0xb2, 0x53, 0xd7, 0xf1, 0x29, 0xb3, 0x78, 0x84, 0x1e, 0x4b, 0x05, 0x72, 0x40, 0x87, 0x53,
+	0x68, 0x0e, 0x38, 0x57, 0xe6, 0xcb, 0xdd, 0x66, 0x40, 0xd8, 0xb6, 0x53, 0x6b, 0xf8, 0x68, 0x13,
+	0xda, 0x52, 0x12, 0xba, 0x5d, 0x3a, 0x21, 0x15, 0x2c, 0x30, 0x58, 0xfd, 0xb4, 0xe5, 0x20, 0xca,
+	0x42, 0x57, 0xeb, 0x5c, 0x9c, 0x8a, 0xe0, 0x9c, 0x80, 0xe9, 0xf8, 0xa5, 0x62, 0x93, 0xb3, 0xff,
+	0x6a, 0x9c, 0x91, 0xe9, 0xb8, 0x44, 0x6b, 0xca, 0x69, 0x3a, 0x99, 0xb6, 0xb6, 0xcd, 0x23, 0xea,
+	0xd0, 0xa5, 0x72, 0xc5, 0xfc, 0x84, 0x04, 0x7f, 0x24, 0x2b, 0xe4, 0xac, 0xff, 0x8c, 0xbf, 0x7a,
+	0x72, 0xcd, 0x23, 0x99, 0x87, 0xba, 0x73, 0xaf, 0xde, 0x72, 0x1d, 0xee, 0x16, 0x8c, 0x6b, 0xc0,
+	0xd1, 0x31, 0xae, 0x1a, 0x8c, 0x91, 0x0c, 0x44, 0x19, 0x84, 0xc8, 0xee, 0x40, 0x5f, 0x91, 0xd8,
+	0x15, 0xa4, 0xd1, 0x16, 0x4e, 0x5b, 0xd0, 0x13, 0xef, 0xa8, 0xb2, 0x1c, 0x48, 0x7d, 0xfc, 0x6f,
+	0x10, 0xf8, 0x84, 0x18, 0xc9, 0x04, 0xf9, 0x48, 0xb9, 0x62, 0x55, 0x9a, 0x69, 0x2d, 0x8b, 0xeb,
+	0x10, 0xb8, 0xba, 0x49, 0x57, 0x71, 0xaa, 0x08, 0xb3, 0xeb, 0xd0, 0xf9, 0x1a, 0x42, 0xc7, 0x88,
+	0x47, 0xc6, 0x3b, 0x1c, 0xfa, 0x64, 0x7f, 0xa9, 0x49, 0x06, 0x6f, 0x97, 0x53, 0xdc, 0x3c, 0xa9,
+	0x97, 0xe9, 0x82, 0xb7, 0xc9, 0xea, 0x9f, 0xb2, 0x14, 0xc3, 0xc7, 0xf6, 0xe2, 0xbb, 0x11, 0x2f,
+	0x3a, 0x2d, 0xca, 0x90, 0x7a, 0xb8, 0xa0, 0x51, 0x1a, 0xcb, 0xe8, 0x87, 0x89, 0x21, 0x81, 0xf0,
+	0x64, 0x6b, 0x80, 0x4e, 0x92, 0x6a, 0x4c, 0xd6, 0x17, 0x7f, 0x0d, 0x8a, 0x2e, 0x95, 0xeb, 0x31,
+	0xce, 0xc8, 0xf9, 0x5d, 0x1b, 0x56, 0x45, 0xc2, 0xaf, 0x31, 0xd8, 0xb6, 0xbf, 0xef, 0xb1, 0x2a,
+	0x96, 0x97, 0xe8, 0xa5, 0xbd, 0x69, 0x6b, 0x11, 0x31, 0x14, 0x6b, 0x8c, 0xcb, 0x54, 0x80, 0x66,
+	0xb2, 0x0c, 0xbe, 0x09, 0x8a, 0x83, 0x70, 0x92, 0x6c, 0xd8, 0x04, 0xf4, 0x87, 0x6f, 0x84, 0xae,
+	0xe3, 0x03, 0xe2, 0x20, 0xa2, 0x5e, 0x8e, 0xe5, 0x0e, 0xc5, 0x94, 0xb4, 0xf8, 0xbd, 0x34, 0x3d,
+	0xdd, 0x06, 0xe2, 0xb9, 0xf1, 0x02, 0x01, 0x07, 0x61, 0xfd, 0xe1, 0xfa, 0x3c, 0x3f, 0x77, 0xd6,
+	0x2b, 0xd8, 0x45, 0x5e, 0x3a, 0xb9, 0xff, 0xb7, 0xd3, 0xde, 0xd4, 0xfd, 0x01, 0xe8, 0x6b, 0x5d,
+	0xa3, 0xf5, 0x94, 0x05, 0xeb, 0xa8, 0x7e, 0x52, 0x43, 0x2d, 0x90, 0x72, 0x6d, 0xa9, 0x62, 0x78,
+	0x3a, 0xa0, 0x64, 0x7c, 0x31, 0x80, 0xab, 0xa3, 0x07, 0x56, 0x8b, 0xc6, 0x3c, 0xca, 0xd4, 0x91,
+	0x17, 0xaf, 0x7f, 0x84, 0xd7, 0x28, 0xa9, 0x9f, 0x81, 0xf0, 0x45, 0x95, 0xda, 0xc8, 0x08, 0x1e,
+	0x62, 0x76, 0x78, 0x24 };
+
+uint8_t fsapfs_test_compression_data_lzvn_compressed_data4096[ 1974 ] = {
+	0xe0, 0x0d, 0x2f, 0x2a, 0x0a, 0x20, 0x2a, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73,
+	0x69, 0x6f, 0x6e, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x73, 0x0a, 0x20, 0x27,
+	0x1c, 0x00, 0xe0, 0x16, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x28, 0x43, 0x29, 0x20,
+	0x32, 0x30, 0x31, 0x38, 0x2d, 0x32, 0x30, 0x32, 0x36, 0x2c, 0x20, 0x4a, 0x6f, 0x61, 0x63, 0x68,
+	0x69, 0x6d, 0x20, 0x4d, 0x65, 0x74, 0x7a, 0x20, 0x3c, 0x6a, 0x1f, 0x0e, 0x00, 0xe0, 0x00, 0x2e,
+	0x6d, 0x65, 0x74, 0x7a, 0x40, 0x67, 0x6d, 0x61, 0x69, 0x6c, 0x2e, 0x63, 0x6f, 0x6d, 0x3e, 0x27,
+	0x45, 0x00, 0xe0, 0x16, 0x52, 0x65, 0x66, 0x65, 0x72, 0x20, 0x74, 0x6f, 0x20, 0x41, 0x55, 0x54,
+	0x48, 0x4f, 0x52, 0x53, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x61, 0x63, 0x6b, 0x6e, 0x6f, 0x77, 0x6c,
+	0x65, 0x64, 0x67, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x73, 0x2e, 0x27, 0x72, 0x00, 0xe0, 0x34, 0x54,
+	0x68, 0x69, 0x73, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x20, 0x69, 0x73, 0x20, 0x66,
+	0x72, 0x65, 0x65, 0x20, 0x73, 0x6f, 0x66, 0x74, 0x77, 0x61, 0x72, 0x65, 0x3a, 0x20, 0x79, 0x6f,
+	0x75, 0x20, 0x63, 0x61, 0x6e, 0x20, 0x72, 0x65, 0x64, 0x69, 0x73, 0x74, 0x72, 0x69, 0x62, 0x75,
+	0x74, 0x65, 0x20, 0x69, 0x74, 0x20, 0x61, 0x6e, 0x64, 0x2f, 0x6f, 0x72, 0x20, 0x6d, 0x6f, 0x64,
+	0x69, 0x66, 0x79, 0x0f, 0xd6, 0x00, 0xe6, 0x69, 0x74, 0x20, 0x75, 0x6e, 0x64, 0x0f, 0x78, 0x00,
+	0xe0, 0x26, 0x68, 0x65, 0x20, 0x74, 0x65, 0x72, 0x6d, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x47, 0x4e, 0x55, 0x20, 0x4c, 0x65, 0x73, 0x73, 0x65, 0x72, 0x20, 0x47, 0x65, 0x6e,
+	0x65, 0x72, 0x61, 0x6c, 0x20, 0x50, 0x75, 0x62, 0x6c, 0x69, 0x63, 0x20, 0x4c, 0x69, 0x63, 0x65,
+	0x6e, 0x73, 0x65, 0x20, 0x61, 0x73, 0x20, 0x70, 0x0f, 0x12, 0x00, 0xe6, 0x73, 0x68, 0x65, 0x64,
+	0x20, 0x62, 0x17, 0x4f, 0x00, 0x0f, 0x39, 0x00, 0xe1, 0x46, 0x0f, 0x8b, 0x00, 0xe1, 0x53, 0x27,
+	0x8b, 0x00, 0xe7, 0x20, 0x46, 0x6f, 0x75, 0x6e, 0x64, 0x61, 0x0f, 0x2d, 0x01, 0xec, 0x2c, 0x20,
+	0x65, 0x69, 0x74, 0x68, 0x65, 0x72, 0x20, 0x76, 0x65, 0x72, 0x17, 0x46, 0x01, 0xe1, 0x33, 0x2f,
+	0x6b, 0x00, 0x27, 0x51, 0x00, 0xe4, 0x2c, 0x20, 0x6f, 0x72, 0x0f, 0x6a, 0x01, 0xe3, 0x28, 0x61,
+	0x74, 0x0f, 0xc1, 0x00, 0xe4, 0x72, 0x20, 0x6f, 0x70, 0x0f, 0x65, 0x01, 0xe9, 0x29, 0x20, 0x61,
+	0x6e, 0x79, 0x20, 0x6c, 0x61, 0x74, 0x3f, 0x3b, 0x00, 0x3f, 0x06, 0x01, 0xfe, 0x3f, 0xed, 0x00,
+	0xe4, 0x64, 0x20, 0x69, 0x6e, 0x17, 0xc7, 0x00, 0xe9, 0x68, 0x6f, 0x70, 0x65, 0x20, 0x74, 0x68,
+	0x61, 0x74, 0x0f, 0xff, 0x00, 0xef, 0x77, 0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x75, 0x73,
+	0x65, 0x66, 0x75, 0x6c, 0x2c, 0x0f, 0xd7, 0x01, 0xe0, 0x15, 0x62, 0x75, 0x74, 0x20, 0x57, 0x49,
+	0x54, 0x48, 0x4f, 0x55, 0x54, 0x20, 0x41, 0x4e, 0x59, 0x20, 0x57, 0x41, 0x52, 0x52, 0x41, 0x4e,
+	0x54, 0x59, 0x3b, 0x20, 0x77, 0x69, 0x74, 0x68, 0x6f, 0x75, 0x74, 0x20, 0x65, 0x76, 0x65, 0x1f,
+	0x4b, 0x00, 0xe0, 0x03, 0x69, 0x6d, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x77, 0x61, 0x72, 0x72,
+	0x61, 0x6e, 0x74, 0x79, 0x20, 0x6f, 0x66, 0x0f, 0x19, 0x02, 0xe0, 0x28, 0x4d, 0x45, 0x52, 0x43,
+	0x48, 0x41, 0x4e, 0x54, 0x41, 0x42, 0x49, 0x4c, 0x49, 0x54, 0x59, 0x20, 0x6f, 0x72, 0x20, 0x46,
+	0x49, 0x54, 0x4e, 0x45, 0x53, 0x53, 0x20, 0x46, 0x4f, 0x52, 0x20, 0x41, 0x20, 0x50, 0x41, 0x52,
+	0x54, 0x49, 0x43, 0x55, 0x4c, 0x41, 0x52, 0x20, 0x50, 0x55, 0x52, 0x50, 0x4f, 0x53, 0x45, 0x2e,
+	0x20, 0x20, 0x53, 0x65, 0x0f, 0x97, 0x00, 0xe1, 0x65, 0x0f, 0x5a, 0x02, 0x0f, 0x6a, 0x01, 0x3f,
+	0x63, 0x01, 0xfd, 0x0f, 0x03, 0x02, 0xeb, 0x6d, 0x6f, 0x72, 0x65, 0x20, 0x64, 0x65, 0x74, 0x61,
+	0x69, 0x6c, 0x37, 0xff, 0x01, 0xe0, 0x0e, 0x59, 0x6f, 0x75, 0x20, 0x73, 0x68, 0x6f, 0x75, 0x6c,
+	0x64, 0x20, 0x68, 0x61, 0x76, 0x65, 0x20, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20,
+	0x61, 0x20, 0x63, 0x6f, 0x70, 0x0f, 0x9a, 0x00, 0x3f, 0xc4, 0x01, 0xf0, 0x0c, 0x0f, 0xd9, 0x02,
+	0xe5, 0x61, 0x6c, 0x6f, 0x6e, 0x67, 0x17, 0xee, 0x00, 0xe2, 0x20, 0x74, 0x3f, 0x56, 0x02, 0xf1,
+	0xe0, 0x15, 0x2e, 0x20, 0x20, 0x49, 0x66, 0x20, 0x6e, 0x6f, 0x74, 0x2c, 0x20, 0x73, 0x65, 0x65,
+	0x20, 0x3c, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x77, 0x77, 0x77, 0x2e, 0x67, 0x6e,
+	0x75, 0x2e, 0x6f, 0x72, 0x67, 0x2f, 0x6c, 0x1f, 0x0a, 0x02, 0xe3, 0x73, 0x2f, 0x3e, 0x0f, 0x98,
+	0x02, 0xe0, 0x06, 0x2f, 0x0a, 0x0a, 0x23, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x20, 0x3c,
+	0x63, 0x6f, 0x6d, 0x6d, 0x6f, 0x6e, 0x2e, 0x68, 0x3e, 0x3f, 0x14, 0x00, 0xf1, 0xe6, 0x6d, 0x65,
+	0x6d, 0x6f, 0x72, 0x79, 0x3f, 0x14, 0x00, 0xf4, 0xe5, 0x74, 0x79, 0x70, 0x65, 0x73, 0x0f, 0x27,
+	0x00, 0xe0, 0x10, 0x0a, 0x23, 0x69, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6e, 0x65, 0x64, 0x28,
+	0x20, 0x48, 0x41, 0x56, 0x45, 0x5f, 0x53, 0x54, 0x44, 0x4c, 0x49, 0x42, 0x5f, 0x48, 0x20, 0x29,
+	0x20, 0x7c, 0x7c, 0x3f, 0x1c, 0x00, 0xe8, 0x57, 0x49, 0x4e, 0x41, 0x50, 0x49, 0x20, 0x29, 0x3f,
+	0x6e, 0x00, 0xf1, 0xe6, 0x73, 0x74, 0x64, 0x6c, 0x69, 0x62, 0x17, 0x6e, 0x00, 0xe5, 0x65, 0x6e,
+	0x64, 0x69, 0x66, 0x0f, 0x8a, 0x00, 0x3f, 0x4e, 0x00, 0xf6, 0xe4, 0x5a, 0x4c, 0x49, 0x42, 0x3f,
+	0x4a, 0x00, 0xf5, 0x0f, 0x13, 0x00, 0xe4, 0x5f, 0x44, 0x4c, 0x4c, 0x3f, 0x4c, 0x00, 0xf3, 0xe1,
+	0x7a, 0x3f, 0x4a, 0x00, 0xf7, 0x27, 0xd4, 0x00, 0xec, 0x22, 0x6c, 0x69, 0x62, 0x66, 0x73, 0x61,
+	0x70, 0x66, 0x73, 0x5f, 0x63, 0x3f, 0x0d, 0x04, 0xe3, 0x2e, 0x68, 0x22, 0x3f, 0xf7, 0x00, 0x3f,
+	0x23, 0x00, 0xf1, 0x17, 0xcb, 0x00, 0xe1, 0x69, 0x17, 0x26, 0x04, 0x3f, 0x23, 0x00, 0xf0, 0x01,
+	0x0f, 0xd7, 0x02, 0x3f, 0x42, 0x00, 0xfe, 0xe9, 0x6c, 0x69, 0x62, 0x63, 0x65, 0x72, 0x72, 0x6f,
+	0x72, 0x3f, 0x21, 0x00, 0xf0, 0x02, 0xe6, 0x6e, 0x6f, 0x74, 0x69, 0x66, 0x79, 0x3f, 0x43, 0x00,
+	0xf0, 0x01, 0xe4, 0x66, 0x6d, 0x6f, 0x73, 0x0f, 0xa4, 0x00, 0xe6, 0x0a, 0x2f, 0x2a, 0x20, 0x44,
+	0x65, 0x2f, 0xb9, 0x00, 0xed, 0x65, 0x73, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x75, 0x73, 0x69,
+	0x6e, 0x67, 0x17, 0xf0, 0x03, 0x3f, 0xd3, 0x00, 0xf1, 0xe7, 0x20, 0x6d, 0x65, 0x74, 0x68, 0x6f,
+	0x64, 0x0f, 0xf6, 0x04, 0xe0, 0x07, 0x52, 0x65, 0x74, 0x75, 0x72, 0x6e, 0x73, 0x20, 0x31, 0x20,
+	0x6f, 0x6e, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x2c, 0x20, 0x30, 0x0f, 0x0e, 0x00,
+	0xe7, 0x66, 0x61, 0x69, 0x6c, 0x75, 0x72, 0x65, 0x0f, 0xf0, 0x02, 0xe1, 0x2d, 0x17, 0x1f, 0x00,
+	0x17, 0xac, 0x00, 0xe9, 0x0a, 0x20, 0x2a, 0x2f, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x3f, 0x2d, 0x01,
+	0xe1, 0x64, 0x37, 0x76, 0x00, 0xe1, 0x5f, 0x0f, 0x74, 0x00, 0xe3, 0x28, 0x0a, 0x20, 0x0f, 0x01,
+	0x00, 0xef, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x38, 0x5f, 0x74, 0x20,
+	0x2a, 0x37, 0x99, 0x00, 0xe1, 0x64, 0x17, 0x25, 0x00, 0xe1, 0x2c, 0x1f, 0x25, 0x00, 0xe7, 0x73,
+	0x69, 0x7a, 0x65, 0x5f, 0x74, 0x20, 0x3f, 0x1d, 0x00, 0xf5, 0xe1, 0x5f, 0x0f, 0x17, 0x00, 0x27,
+	0x22, 0x00, 0x0f, 0x6b, 0x00, 0x3f, 0x8e, 0x01, 0xf1, 0xe1, 0x5f, 0x1f, 0xbb, 0x00, 0x27, 0x3f,
+	0x00, 0x37, 0x5e, 0x00, 0xe2, 0x75, 0x6e, 0x3f, 0x60, 0x00, 0xf0, 0x03, 0xe1, 0x2a, 0x3f, 0x20,
+	0x00, 0xf7, 0x3f, 0x63, 0x00, 0xf2, 0x37, 0x88, 0x01, 0xe1, 0x5f, 0x17, 0x8e, 0x01, 0x0f, 0xae,
+	0x00, 0xe1, 0x2a, 0x17, 0x98, 0x01, 0xe0, 0x03, 0x20, 0x29, 0x0a, 0x7b, 0x0a, 0x09, 0x73, 0x74,
+	0x61, 0x74, 0x69, 0x63, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2a, 0x2f, 0x1a, 0x06, 0x17, 0xe3,
+	0x00, 0x37, 0x05, 0x00, 0xe2, 0x3d, 0x20, 0x3f, 0x19, 0x02, 0xf3, 0x2f, 0x3e, 0x02, 0x17, 0x0f,
+	0x01, 0xe4, 0x22, 0x3b, 0x0a, 0x09, 0x0f, 0x30, 0x01, 0xe6, 0x72, 0x65, 0x73, 0x75, 0x6c, 0x74,
+	0x3f, 0x38, 0x00, 0xf4, 0x3f, 0x46, 0x00, 0xf1, 0xe4, 0x3d, 0x20, 0x30, 0x3b, 0x1f, 0xd6, 0x02,
+	0xe1, 0x28, 0x3f, 0x26, 0x03, 0xf5, 0x27, 0xd8, 0x02, 0xe2, 0x26, 0x26, 0x3f, 0x18, 0x00, 0xf9,
+	0xe8, 0x5f, 0x55, 0x4e, 0x43, 0x4f, 0x4d, 0x50, 0x52, 0x0f, 0x8d, 0x04, 0xe1, 0x29, 0x3f, 0xfd,
+	0x02, 0xf0, 0x00, 0xe8, 0x09, 0x75, 0x4c, 0x6f, 0x6e, 0x67, 0x66, 0x20, 0x0f, 0xfb, 0x02, 0xe1,
+	0x5f, 0x3f, 0x0c, 0x01, 0xfc, 0xe1, 0x20, 0x17, 0x81, 0x00, 0xe1, 0x23, 0x27, 0x5e, 0x03, 0xe4,
+	0x09, 0x69, 0x66, 0x28, 0x3f, 0x96, 0x01, 0xf6, 0xe6, 0x20, 0x3d, 0x3d, 0x20, 0x4e, 0x55, 0x17,
+	0x4d, 0x03, 0xe5, 0x09, 0x7b, 0x0a, 0x09, 0x09, 0x3f, 0x37, 0x01, 0xf6, 0xe8, 0x73, 0x65, 0x74,
+	0x28, 0x0a, 0x09, 0x09, 0x20, 0x17, 0xd3, 0x02, 0xe1, 0x2c, 0x0f, 0x0a, 0x00, 0xea, 0x4c, 0x49,
+	0x42, 0x43, 0x45, 0x52, 0x52, 0x4f, 0x52, 0x5f, 0x1f, 0x06, 0x00, 0xe0, 0x00, 0x44, 0x4f, 0x4d,
+	0x41, 0x49, 0x4e, 0x5f, 0x41, 0x52, 0x47, 0x55, 0x4d, 0x45, 0x4e, 0x54, 0x53, 0x3f, 0x25, 0x00,
+	0xf5, 0x2f, 0x18, 0x00, 0x27, 0x2e, 0x00, 0xed, 0x49, 0x4e, 0x56, 0x41, 0x4c, 0x49, 0x44, 0x5f,
+	0x56, 0x41, 0x4c, 0x55, 0x45, 0x17, 0x50, 0x00, 0xec, 0x22, 0x25, 0x73, 0x3a, 0x20, 0x69, 0x6e,
+	0x76, 0x61, 0x6c, 0x69, 0x64, 0x3f, 0x34, 0x02, 0xf1, 0x1f, 0xea, 0x02, 0xe8, 0x62, 0x75, 0x66,
+	0x66, 0x65, 0x72, 0x2e, 0x22, 0x17, 0x7a, 0x00, 0x37, 0xa7, 0x01, 0xe7, 0x29, 0x3b, 0x0a, 0x0a,
+	0x09, 0x09, 0x72, 0x17, 0xe6, 0x02, 0xeb, 0x28, 0x20, 0x2d, 0x31, 0x20, 0x29, 0x3b, 0x0a, 0x09,
+	0x7d, 0x0a, 0x17, 0xe0, 0x00, 0x3f, 0x35, 0x02, 0xf7, 0x3f, 0xe2, 0x00, 0xf0, 0x75, 0x3f, 0xd5,
+	0x02, 0xf2, 0x3f, 0xe4, 0x00, 0xf0, 0x33, 0x3f, 0x8c, 0x03, 0xf5, 0xe3, 0x20, 0x29, 0x0a, 0x3f,
+	0xd1, 0x01, 0xf0, 0x80, 0xe8, 0x20, 0x65, 0x71, 0x75, 0x61, 0x6c, 0x73, 0x20, 0x3f, 0x0d, 0x01,
+	0xf0, 0x3b, 0x17, 0x69, 0x04, 0x3f, 0xf6, 0x01, 0xf0, 0x87, 0x0f, 0x25, 0x05, 0x3f, 0xd8, 0x02,
+	0xf0, 0x12, 0x3f, 0x2f, 0x05, 0xf8, 0x0f, 0xbb, 0x03, 0xea, 0x4c, 0x49, 0x42, 0x46, 0x53, 0x41,
+	0x50, 0x46, 0x53, 0x5f, 0x2f, 0x32, 0x04, 0xe0, 0x02, 0x49, 0x4f, 0x4e, 0x5f, 0x4d, 0x45, 0x54,
+	0x48, 0x4f, 0x44, 0x5f, 0x44, 0x45, 0x46, 0x4c, 0x41, 0x54, 0x45, 0x2f, 0x0a, 0x02, 0x0f, 0xfe,
+	0x03, 0x3f, 0x00, 0x04, 0xf7, 0x1f, 0x2d, 0x01, 0xe4, 0x3e, 0x3d, 0x20, 0x31, 0x0f, 0x31, 0x02,
+	0xe5, 0x09, 0x20, 0x26, 0x26, 0x20, 0x3f, 0x24, 0x04, 0xf7, 0xe5, 0x5b, 0x20, 0x30, 0x20, 0x5d,
+	0x0f, 0x29, 0x04, 0xe6, 0x30, 0x78, 0x66, 0x66, 0x20, 0x29, 0x17, 0x29, 0x00, 0x0f, 0x2c, 0x04,
+	0x3f, 0x50, 0x04, 0xfa, 0x27, 0x50, 0x00, 0xe2, 0x20, 0x28, 0x1f, 0x05, 0x06, 0xeb, 0x29, 0x20,
+	0x53, 0x53, 0x49, 0x5a, 0x45, 0x5f, 0x4d, 0x41, 0x58, 0x17, 0x60, 0x00, 0x17, 0x64, 0x04, 0x3f,
+	0x66, 0x04, 0xff, 0x3f, 0x68, 0x04, 0xf2, 0xe3, 0x09, 0x09, 0x20, 0x3f, 0x6a, 0x04, 0xf0, 0x0a,
+	0x3f, 0x27, 0x00, 0xf3, 0x3f, 0x6c, 0x04, 0xf5, 0x17, 0x64, 0x04, 0xe8, 0x5f, 0x45, 0x58, 0x43,
+	0x45, 0x45, 0x44, 0x53, 0x0f, 0x83, 0x00, 0xe4, 0x49, 0x4d, 0x55, 0x4d, 0x0f, 0xc4, 0x04, 0xe3,
+	0x09, 0x09, 0x20, 0x3f, 0x76, 0x04, 0xf0, 0x03, 0x0f, 0xc1, 0x06, 0xe0, 0x06, 0x20, 0x76, 0x61,
+	0x6c, 0x75, 0x65, 0x20, 0x65, 0x78, 0x63, 0x65, 0x65, 0x64, 0x73, 0x20, 0x6d, 0x61, 0x78, 0x69,
+	0x6d, 0x75, 0x6d, 0x1f, 0x8a, 0x04, 0xe2, 0x09, 0x09, 0x37, 0x4d, 0x0c, 0x0f, 0x7b, 0x04, 0xe3,
+	0x0a, 0x09, 0x09, 0x3f, 0x8e, 0x04, 0xf7, 0xe1, 0x09, 0x0f, 0x90, 0x04, 0xe1, 0x09, 0x17, 0x72,
+	0x05, 0x3f, 0xa8, 0x06, 0xfd, 0xe2, 0x20, 0x3e, 0x3f, 0x25, 0x01, 0xf0, 0x94, 0x3f, 0xb9, 0x04,
+	0xf8, 0x3f, 0x27, 0x01, 0xf0, 0x34, 0x3f, 0x9b, 0x02, 0xfd, 0xe1, 0x2d, 0x0f, 0x9a, 0x02, 0xe3,
+	0x20, 0x3e, 0x20, 0x3f, 0x46, 0x01, 0xfe, 0xe1, 0x29, 0x0f, 0x7e, 0x01, 0x17, 0x8e, 0x02, 0x3f,
+	0xbc, 0x06, 0xfe, 0x3f, 0x56, 0x02, 0xf0, 0x0c, 0xe6, 0x52, 0x55, 0x4e, 0x54, 0x49, 0x4d, 0x17,
+	0x93, 0x06, 0x3f, 0x7b, 0x02, 0xf3, 0x27, 0x18, 0x00, 0x27, 0xed, 0x06, 0x1f, 0x53, 0x02, 0xec,
+	0x4f, 0x55, 0x54, 0x5f, 0x4f, 0x46, 0x5f, 0x42, 0x4f, 0x55, 0x4e, 0x44, 0x17, 0xf0, 0x06, 0x2f,
+	0x51, 0x02, 0x3f, 0x10, 0x09, 0x1f, 0xa9, 0x09, 0x3f, 0x49, 0x02, 0xf9, 0x3f, 0x47, 0x01, 0xfc,
+	0x3f, 0x58, 0x02, 0xf0, 0x16, 0x3f, 0x54, 0x02, 0xfe, 0xe1, 0x3d, 0x3f, 0x76, 0x09, 0xfb, 0xe4,
+	0x20, 0x2d, 0x20, 0x31, 0x17, 0x33, 0x07, 0x17, 0x02, 0x08, 0x1f, 0xd1, 0x0b, 0xe1, 0x5f, 0x0f,
+	0x73, 0x0c, 0x0f, 0xdb, 0x07, 0xe1, 0x09, 0x17, 0xd9, 0x09, 0x3f, 0x6c, 0x09, 0xf9, 0xe2, 0x09,
+	0x09, 0x1f, 0x1b, 0x00, 0xe1, 0x26, 0x3f, 0x11, 0x04, 0xf9, 0xe5, 0x31, 0x20, 0x5d, 0x20, 0x29,
+	0x17, 0x4b, 0x03, 0x17, 0x17, 0x0a, 0x3f, 0x9d, 0x01, 0xff, 0x3f, 0x5f, 0x08, 0xf2, 0xe1, 0x09,
+	0x3f, 0xfd, 0x03, 0xf0, 0x2a, 0xe6, 0x4d, 0x45, 0x4d, 0x4f, 0x52, 0x59, 0x27, 0xc5, 0x03, 0x3f,
+	0x8b, 0x08, 0x1f, 0x17, 0x00, 0x27, 0x92, 0x08, 0xe5, 0x43, 0x4f, 0x50, 0x59, 0x5f, 0x06, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#endif /* !defined( _FSAPFS_TEST_COMPRESSION_DATA_H ) */
+
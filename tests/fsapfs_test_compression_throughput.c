@@ -0,0 +1,162 @@
+/*
+ * Library compression throughput program
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include <time.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_compression_data.h"
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_compression.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
+
+/* The number of times the data is decompressed
+ */
+#define FSAPFS_TEST_COMPRESSION_THROUGHPUT_ITERATIONS	2048
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Decompresses data repeatedly and prints the decompression throughput
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_compression_throughput_run(
+     const char *name,
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     int compression_method,
+     int number_of_iterations )
+{
+	uint8_t uncompressed_data[ 4096 ];
+
+	libcerror_error_t *error      = NULL;
+	clock_t end_time              = 0;
+	clock_t start_time            = 0;
+	double elapsed_seconds        = 0.0;
+	size_t uncompressed_data_size = 0;
+	int iteration                 = 0;
+
+	start_time = clock();
+
+	for( iteration = 0;
+	     iteration < number_of_iterations;
+	     iteration++ )
+	{
+		uncompressed_data_size = 4096;
+
+		if( libfsapfs_decompress_data(
+		     compressed_data,
+		     compressed_data_size,
+		     compression_method,
+		     uncompressed_data,
+		     &uncompressed_data_size,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to decompress %s compressed data.\n",
+			 name );
+
+			libcerror_error_backtrace_fprint(
+			 error,
+			 stderr );
+
+			libcerror_error_free(
+			 &error );
+
+			return( -1 );
+		}
+	}
+	end_time = clock();
+
+	elapsed_seconds = (double) ( end_time - start_time ) / CLOCKS_PER_SEC;
+
+	if( elapsed_seconds > 0.0 )
+	{
+		fprintf(
+		 stdout,
+		 "%s decompression throughput: %.1f MiB/s\n",
+		 name,
+		 ( (double) uncompressed_data_size * number_of_iterations ) / ( elapsed_seconds * 1024.0 * 1024.0 ) );
+	}
+	return( 1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	if( fsapfs_test_compression_throughput_run(
+	     "DEFLATE",
+	     fsapfs_test_compression_data_deflate_compressed_data4096,
+	     1244,
+	     LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	     FSAPFS_TEST_COMPRESSION_THROUGHPUT_ITERATIONS ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	if( fsapfs_test_compression_throughput_run(
+	     "LZFSE",
+	     fsapfs_test_compression_data_lzfse_compressed_data4096,
+	     1460,
+	     LIBFSAPFS_COMPRESSION_METHOD_LZFSE,
+	     FSAPFS_TEST_COMPRESSION_THROUGHPUT_ITERATIONS ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+	if( fsapfs_test_compression_throughput_run(
+	     "LZVN",
+	     fsapfs_test_compression_data_lzvn_compressed_data4096,
+	     1974,
+	     LIBFSAPFS_COMPRESSION_METHOD_LZVN,
+	     FSAPFS_TEST_COMPRESSION_THROUGHPUT_ITERATIONS ) != 1 )
+	{
+		return( EXIT_FAILURE );
+	}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+}
+
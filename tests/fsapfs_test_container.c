@@ -1200,6 +1200,165 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_container_set_maximum_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_set_maximum_cache_size(
+     libfsapfs_container_t *container )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_set_maximum_cache_size(
+	          container,
+	          64 * 1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_set_maximum_cache_size(
+	          container,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_set_maximum_cache_size(
+	          NULL,
+	          64 * 1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_container_set_maximum_cache_size_by_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_container_set_maximum_cache_size_by_type(
+     libfsapfs_container_t *container )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_container_set_maximum_cache_size_by_type(
+	          container,
+	          LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+	          1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_container_set_maximum_cache_size_by_type(
+	          container,
+	          LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_container_set_maximum_cache_size_by_type(
+	          NULL,
+	          LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+	          1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_container_set_maximum_cache_size_by_type(
+	          container,
+	          0,
+	          1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_container_get_number_of_volumes function
  * Returns 1 if successful or 0 if not
  */
@@ -1504,6 +1663,16 @@ int main(
 
 		/* TODO: add tests for libfsapfs_container_get_identifier */
 
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "libfsapfs_container_set_maximum_cache_size",
+		 fsapfs_test_container_set_maximum_cache_size,
+		 container );
+
+		FSAPFS_TEST_RUN_WITH_ARGS(
+		 "libfsapfs_container_set_maximum_cache_size_by_type",
+		 fsapfs_test_container_set_maximum_cache_size_by_type,
+		 container );
+
 		FSAPFS_TEST_RUN_WITH_ARGS(
 		 "libfsapfs_container_get_number_of_volumes",
 		 fsapfs_test_container_get_number_of_volumes,
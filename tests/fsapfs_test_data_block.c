@@ -35,6 +35,7 @@
 #include "fsapfs_test_memory.h"
 #include "fsapfs_test_unused.h"
 
+#include "../libfsapfs/libfsapfs_buffer_pool.h"
 #include "../libfsapfs/libfsapfs_data_block.h"
 #include "../libfsapfs/libfsapfs_io_handle.h"
 
@@ -323,6 +324,176 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_data_block_initialize_with_buffer_pool function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_data_block_initialize_with_buffer_pool(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsapfs_buffer_pool_t *buffer_pool = NULL;
+	libfsapfs_data_block_t *data_block   = NULL;
+	uint8_t *data                        = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_buffer_pool_initialize(
+	          &buffer_pool,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "buffer_pool",
+	 buffer_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_data_block_initialize_with_buffer_pool(
+	          &data_block,
+	          buffer_pool,
+	          1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = data_block->data;
+
+	result = libfsapfs_data_block_free(
+	          &data_block,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The data should have been returned to the buffer pool
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "buffer_pool->number_of_buffers[ 1 ]",
+	 buffer_pool->number_of_buffers[ 1 ],
+	 1 );
+
+	result = libfsapfs_data_block_initialize_with_buffer_pool(
+	          &data_block,
+	          buffer_pool,
+	          1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block",
+	 data_block );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "data_block->data == data",
+	 (int) ( data_block->data == data ),
+	 1 );
+
+	result = libfsapfs_data_block_free(
+	          &data_block,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_data_block_initialize_with_buffer_pool(
+	          NULL,
+	          buffer_pool,
+	          1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_buffer_pool_free(
+	          &buffer_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_block != NULL )
+	{
+		libfsapfs_data_block_free(
+		 &data_block,
+		 NULL );
+	}
+	if( buffer_pool != NULL )
+	{
+		libfsapfs_buffer_pool_free(
+		 &buffer_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_data_block_free function
  * Returns 1 if successful or 0 if not
  */
@@ -803,6 +974,10 @@ int main(
 	 "libfsapfs_data_block_initialize",
 	 fsapfs_test_data_block_initialize );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_data_block_initialize_with_buffer_pool",
+	 fsapfs_test_data_block_initialize_with_buffer_pool );
+
 	FSAPFS_TEST_RUN(
 	 "libfsapfs_data_block_free",
 	 fsapfs_test_data_block_free );
@@ -38,6 +38,7 @@
 #include "fsapfs_test_unused.h"
 
 #include "../libfsapfs/libfsapfs_data_block_data_handle.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
 #include "../libfsapfs/libfsapfs_file_extent.h"
 #include "../libfsapfs/libfsapfs_io_handle.h"
 
@@ -1090,6 +1091,572 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_data_block_data_handle_read_segment_data function with a read that bypasses the data block cache
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_data_block_data_handle_read_segment_data_direct(
+     void )
+{
+	libbfio_handle_t *file_io_handle                           = NULL;
+	libcdata_array_t *file_extents                             = NULL;
+	libcerror_error_t *error                                   = NULL;
+	libfsapfs_data_block_data_handle_t *data_block_data_handle = NULL;
+	libfsapfs_file_extent_t *file_extent                       = NULL;
+	libfsapfs_io_handle_t *io_handle                           = NULL;
+	uint8_t *data_block_data                                   = NULL;
+	uint8_t *segment_data                                      = NULL;
+	size_t data_offset                                         = 0;
+	ssize_t read_count                                         = 0;
+	uint8_t byte_value                                         = 0;
+	int entry_index                                            = 0;
+	int result                                                 = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libcdata_array_initialize(
+	          &file_extents,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_extents",
+	 file_extents );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_extent_initialize(
+	          &file_extent,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_extent",
+	 file_extent );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_extent->physical_block_number = 1;
+	file_extent->data_size             = 16384;
+
+	result = libcdata_array_append_entry(
+	          file_extents,
+	          &entry_index,
+	          (intptr_t *) file_extent,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_extent = NULL;
+
+	result = libfsapfs_data_block_data_handle_initialize(
+	          &data_block_data_handle,
+	          io_handle,
+	          NULL,
+	          file_extents,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block_data_handle",
+	 data_block_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	data_block_data = (uint8_t *) memory_allocate(
+	                               20480 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block_data",
+	 data_block_data );
+
+	for( data_offset = 0;
+	     data_offset < 20480;
+	     data_offset++ )
+	{
+		data_block_data[ data_offset ] = byte_value;
+
+		if( byte_value < 15 )
+		{
+			byte_value++;
+		}
+		else
+		{
+			byte_value = 0;
+		}
+	}
+	result = fsapfs_test_open_file_io_handle(
+	          &file_io_handle,
+	          data_block_data,
+	          20480,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	segment_data = (uint8_t *) memory_allocate(
+	                            16384 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "segment_data",
+	 segment_data );
+
+	/* Test regular cases
+	 */
+	read_count = libfsapfs_data_block_data_handle_read_segment_data(
+	              data_block_data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              16384,
+	              0,
+	              0,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 16384 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          segment_data,
+	          &( data_block_data[ 4096 ] ),
+	          16384 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test that the read bypassed the data block cache
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_lookups",
+	 io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS - 1 ]->number_of_lookups,
+	 (uint64_t) 0 );
+
+	memory_free(
+	 segment_data );
+
+	segment_data = NULL;
+
+	/* Clean up
+	 */
+	result = libfsapfs_data_block_data_handle_free(
+	          &data_block_data_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "data_block_data_handle",
+	 data_block_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Create a new data block data handle to prevent the data block cache
+	 * affecting the tests.
+	 */
+	result = libfsapfs_data_block_data_handle_initialize(
+	          &data_block_data_handle,
+	          io_handle,
+	          NULL,
+	          file_extents,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data_block_data_handle",
+	 data_block_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	read_count = libfsapfs_data_block_data_handle_read_segment_data(
+	              NULL,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	data_block_data_handle->current_offset = -1;
+
+	read_count = libfsapfs_data_block_data_handle_read_segment_data(
+	              data_block_data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	data_block_data_handle->current_offset = 0;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_data_block_data_handle_read_segment_data(
+	              data_block_data_handle,
+	              NULL,
+	              0,
+	              0,
+	              segment_data,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_data_block_data_handle_read_segment_data(
+	              data_block_data_handle,
+	              file_io_handle,
+	              -1,
+	              0,
+	              segment_data,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_data_block_data_handle_read_segment_data(
+	              data_block_data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              NULL,
+	              16,
+	              0,
+	              0,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libfsapfs_data_block_data_handle_read_segment_data(
+	              data_block_data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              (size_t) SSIZE_MAX + 1,
+	              0,
+	              0,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT64(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+#if defined( OPTIMIZATION_DISABLED )
+	/* Test libfsapfs_data_block_data_handle_read_segment_data with memcpy failing
+	 */
+	fsapfs_test_memcpy_attempts_before_fail = 0;
+
+	read_count = libfsapfs_data_block_data_handle_read_segment_data(
+	              data_block_data_handle,
+	              file_io_handle,
+	              0,
+	              0,
+	              segment_data,
+	              12,
+	              0,
+	              0,
+	              &error );
+
+	if( fsapfs_test_memcpy_attempts_before_fail != -1 )
+	{
+		fsapfs_test_memcpy_attempts_before_fail = -1;
+	}
+	else
+	{
+		FSAPFS_TEST_ASSERT_EQUAL_INT64(
+		 "read_count",
+		 read_count,
+		 (ssize_t) -1 );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( OPTIMIZATION_DISABLED ) */
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	/* Clean up file IO handle
+	 */
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data_block_data );
+
+	data_block_data = NULL;
+
+	/* Clean up
+	 */
+	result = libfsapfs_data_block_data_handle_free(
+	          &data_block_data_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "data_block_data_handle",
+	 data_block_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &file_extents,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_extents",
+	 file_extents );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( segment_data != NULL )
+	{
+		memory_free(
+		 segment_data );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data_block_data != NULL )
+	{
+		memory_free(
+		 data_block_data );
+	}
+	if( data_block_data_handle != NULL )
+	{
+		libfsapfs_data_block_data_handle_free(
+		 &data_block_data_handle,
+		 NULL );
+	}
+	if( file_extent != NULL )
+	{
+		libfsapfs_file_extent_free(
+		 &file_extent,
+		 NULL );
+	}
+	if( file_extents != NULL )
+	{
+		libcdata_array_free(
+		 &file_extents,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_data_block_data_handle_seek_segment_offset function
  * Returns 1 if successful or 0 if not
  */
@@ -1404,6 +1971,10 @@ int main(
 	 "libfsapfs_data_block_data_handle_read_segment_data",
 	 fsapfs_test_data_block_data_handle_read_segment_data );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_data_block_data_handle_read_segment_data_direct",
+	 fsapfs_test_data_block_data_handle_read_segment_data_direct );
+
 	FSAPFS_TEST_RUN(
 	 "libfsapfs_data_block_data_handle_seek_segment_offset",
 	 fsapfs_test_data_block_data_handle_seek_segment_offset );
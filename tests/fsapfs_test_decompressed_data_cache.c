@@ -0,0 +1,1076 @@
+/*
+ * Library decompressed_data_cache type test program
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_cache_statistics.h"
+#include "../libfsapfs/libfsapfs_decompressed_data_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_decompressed_data_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decompressed_data_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                                     = NULL;
+	libfsapfs_cache_statistics_t *cache_statistics               = NULL;
+	libfsapfs_decompressed_data_cache_t *decompressed_data_cache = NULL;
+	int result                                                   = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                              = 2;
+	int number_of_memset_fail_tests                              = 2;
+	int test_number                                              = 0;
+#endif
+
+	result = libfsapfs_cache_statistics_initialize(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_statistics",
+	 cache_statistics );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_decompressed_data_cache_initialize(
+	          &decompressed_data_cache,
+	          4 * 1024 * 1024,
+	          cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "decompressed_data_cache",
+	 decompressed_data_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_decompressed_data_cache_free(
+	          &decompressed_data_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decompressed_data_cache",
+	 decompressed_data_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decompressed_data_cache_initialize(
+	          NULL,
+	          48,
+	          cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decompressed_data_cache = (libfsapfs_decompressed_data_cache_t *) 0x12345678UL;
+
+	result = libfsapfs_decompressed_data_cache_initialize(
+	          &decompressed_data_cache,
+	          48,
+	          cache_statistics,
+	          &error );
+
+	decompressed_data_cache = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompressed_data_cache_initialize(
+	          &decompressed_data_cache,
+	          0,
+	          cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompressed_data_cache_initialize(
+	          &decompressed_data_cache,
+	          48,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_decompressed_data_cache_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_decompressed_data_cache_initialize(
+		          &decompressed_data_cache,
+		          48,
+		          cache_statistics,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( decompressed_data_cache != NULL )
+			{
+				libfsapfs_decompressed_data_cache_free(
+				 &decompressed_data_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "decompressed_data_cache",
+			 decompressed_data_cache );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_decompressed_data_cache_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_decompressed_data_cache_initialize(
+		          &decompressed_data_cache,
+		          48,
+		          cache_statistics,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( decompressed_data_cache != NULL )
+			{
+				libfsapfs_decompressed_data_cache_free(
+				 &decompressed_data_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "decompressed_data_cache",
+			 decompressed_data_cache );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfsapfs_cache_statistics_free(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "cache_statistics",
+	 cache_statistics );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decompressed_data_cache != NULL )
+	{
+		libfsapfs_decompressed_data_cache_free(
+		 &decompressed_data_cache,
+		 NULL );
+	}
+	if( cache_statistics != NULL )
+	{
+		libfsapfs_cache_statistics_free(
+		 &cache_statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_decompressed_data_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decompressed_data_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decompressed_data_cache_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_decompressed_data_cache_get_data and libfsapfs_decompressed_data_cache_insert_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decompressed_data_cache_get_data(
+     void )
+{
+	uint8_t cached_data[ 32 ];
+	uint8_t data[ 64 ];
+
+	libcerror_error_t *error                                     = NULL;
+	libfsapfs_cache_statistics_t *cache_statistics               = NULL;
+	libfsapfs_decompressed_data_cache_entry_t *evicted_entry     = NULL;
+	libfsapfs_decompressed_data_cache_t *decompressed_data_cache = NULL;
+	size_t cached_data_size                                      = 0;
+	int result                                                   = 0;
+
+	result = libfsapfs_cache_statistics_initialize(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cache_statistics",
+	 cache_statistics );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( memory_set(
+	     data,
+	     'A',
+	     64 ) == NULL )
+	{
+		goto on_error;
+	}
+	/* Initialize test, 3 blocks of 16 bytes fit in the cache
+	 */
+	result = libfsapfs_decompressed_data_cache_initialize(
+	          &decompressed_data_cache,
+	          48,
+	          cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "decompressed_data_cache",
+	 decompressed_data_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving a block that is not cached
+	 */
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          cached_data,
+	          32,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting blocks
+	 */
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          data,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 0 ] = 'B';
+
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          1,
+	          data,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 0 ] = 'C';
+
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          2,
+	          1,
+	          0,
+	          data,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting a block that is already cached
+	 */
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          2,
+	          1,
+	          0,
+	          data,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_statistics->resident_size",
+	 (uint64_t) cache_statistics->resident_size,
+	 (uint64_t) 48 );
+
+	/* Test retrieving a cached block, which becomes the most recently used block
+	 */
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          cached_data,
+	          32,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "cached_data_size",
+	 cached_data_size,
+	 (size_t) 16 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "cached_data[ 0 ]",
+	 (int) cached_data[ 0 ],
+	 (int) 'A' );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieving a block of another transaction
+	 */
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          1,
+	          2,
+	          0,
+	          cached_data,
+	          32,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting a block that evicts the least recently used block
+	 */
+	data[ 0 ] = 'D';
+
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          3,
+	          1,
+	          0,
+	          data,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          1,
+	          cached_data,
+	          32,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          2,
+	          1,
+	          0,
+	          cached_data,
+	          32,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "cached_data[ 0 ]",
+	 (int) cached_data[ 0 ],
+	 (int) 'C' );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test inserting a block that is larger than the cache, which is not cached
+	 */
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          4,
+	          1,
+	          0,
+	          data,
+	          64,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_statistics->number_of_lookups",
+	 (uint64_t) cache_statistics->number_of_lookups,
+	 (uint64_t) 5 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_statistics->number_of_misses",
+	 (uint64_t) cache_statistics->number_of_misses,
+	 (uint64_t) 3 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_statistics->number_of_evictions",
+	 (uint64_t) cache_statistics->number_of_evictions,
+	 (uint64_t) 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_statistics->resident_size",
+	 (uint64_t) cache_statistics->resident_size,
+	 (uint64_t) 48 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_statistics->read_size",
+	 (uint64_t) cache_statistics->read_size,
+	 (uint64_t) 64 );
+
+	/* Test evicting a block that is referenced by a reader, which is not freed
+	 */
+	evicted_entry = decompressed_data_cache->last_entry;
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "evicted_entry",
+	 evicted_entry );
+
+	evicted_entry->number_of_references = 1;
+
+	data[ 0 ] = 'E';
+
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          5,
+	          1,
+	          0,
+	          data,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "evicted_entry->is_evicted",
+	 (int) evicted_entry->is_evicted,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "evicted_entry->data[ 0 ]",
+	 (int) evicted_entry->data[ 0 ],
+	 (int) 'A' );
+
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          evicted_entry->identifier,
+	          evicted_entry->transaction_identifier,
+	          evicted_entry->compressed_block_index,
+	          cached_data,
+	          32,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The last reader frees the evicted entry
+	 */
+	memory_free(
+	 evicted_entry->data );
+	memory_free(
+	 evicted_entry );
+
+	evicted_entry = NULL;
+
+	/* Insert the evicted block again for the error cases
+	 */
+	data[ 0 ] = 'A';
+
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          data,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          NULL,
+	          1,
+	          1,
+	          0,
+	          cached_data,
+	          32,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          NULL,
+	          32,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          cached_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          cached_data,
+	          8,
+	          &cached_data_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompressed_data_cache_get_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          cached_data,
+	          32,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          NULL,
+	          1,
+	          1,
+	          0,
+	          data,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          NULL,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompressed_data_cache_insert_data(
+	          decompressed_data_cache,
+	          1,
+	          1,
+	          0,
+	          data,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_decompressed_data_cache_free(
+	          &decompressed_data_cache,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decompressed_data_cache",
+	 decompressed_data_cache );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "cache_statistics->resident_size",
+	 (uint64_t) cache_statistics->resident_size,
+	 (uint64_t) 0 );
+
+	/* Clean up
+	 */
+	result = libfsapfs_cache_statistics_free(
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "cache_statistics",
+	 cache_statistics );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( evicted_entry != NULL )
+	 && ( evicted_entry->is_evicted != 0 ) )
+	{
+		memory_free(
+		 evicted_entry->data );
+		memory_free(
+		 evicted_entry );
+	}
+	if( decompressed_data_cache != NULL )
+	{
+		libfsapfs_decompressed_data_cache_free(
+		 &decompressed_data_cache,
+		 NULL );
+	}
+	if( cache_statistics != NULL )
+	{
+		libfsapfs_cache_statistics_free(
+		 &cache_statistics,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decompressed_data_cache_initialize",
+	 fsapfs_test_decompressed_data_cache_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decompressed_data_cache_free",
+	 fsapfs_test_decompressed_data_cache_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decompressed_data_cache_get_data",
+	 fsapfs_test_decompressed_data_cache_get_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+}
+
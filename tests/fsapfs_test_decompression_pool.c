@@ -0,0 +1,1029 @@
+/*
+ * Library decompression_pool type test program
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_decompression_pool.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
+#include "../libfsapfs/libfsapfs_libcthreads.h"
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+#define FSAPFS_TEST_DECOMPRESSION_POOL_NUMBER_OF_THREADS	8
+#define FSAPFS_TEST_DECOMPRESSION_POOL_NUMBER_OF_ITERATIONS	256
+
+typedef struct fsapfs_test_decompression_pool_thread_arguments fsapfs_test_decompression_pool_thread_arguments_t;
+
+struct fsapfs_test_decompression_pool_thread_arguments
+{
+	/* The decompression pool
+	 */
+	libfsapfs_decompression_pool_t *decompression_pool;
+
+	/* The result
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+/* Deflate compressed blocks that are stored uncompressed, which is indicated by the 0xff byte
+ */
+uint8_t fsapfs_test_decompression_pool_compressed_data[ 45 ] = {
+	0xff, 0x03, 0x0a, 0x11, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65,
+	0x6c, 0xff, 0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce,
+	0xd5, 0xdc, 0xff, 0xe3, 0xea, 0xf1, 0xf8, 0xff, 0x06, 0x0d, 0x14, 0x1b, 0x22 };
+
+uint32_t fsapfs_test_decompression_pool_compressed_block_offsets[ 4 ] = {
+	100, 117, 134, 145 };
+
+uint8_t fsapfs_test_decompression_pool_uncompressed_data[ 42 ] = {
+	0x03, 0x0a, 0x11, 0x18, 0x1f, 0x26, 0x2d, 0x34, 0x3b, 0x42, 0x49, 0x50, 0x57, 0x5e, 0x65, 0x6c,
+	0x73, 0x7a, 0x81, 0x88, 0x8f, 0x96, 0x9d, 0xa4, 0xab, 0xb2, 0xb9, 0xc0, 0xc7, 0xce, 0xd5, 0xdc,
+	0xe3, 0xea, 0xf1, 0xf8, 0xff, 0x06, 0x0d, 0x14, 0x1b, 0x22 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_decompression_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decompression_pool_initialize(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsapfs_decompression_pool_t *decompression_pool = NULL;
+	int result                                         = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests                    = 2;
+	int number_of_memset_fail_tests                    = 2;
+	int test_number                                    = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_decompression_pool_initialize(
+	          &decompression_pool,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "decompression_pool",
+	 decompression_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_decompression_pool_free(
+	          &decompression_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decompression_pool",
+	 decompression_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decompression_pool_initialize(
+	          NULL,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decompression_pool = (libfsapfs_decompression_pool_t *) 0x12345678UL;
+
+	result = libfsapfs_decompression_pool_initialize(
+	          &decompression_pool,
+	          4,
+	          &error );
+
+	decompression_pool = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_initialize(
+	          &decompression_pool,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decompression_pool",
+	 decompression_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_initialize(
+	          &decompression_pool,
+	          LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSION_THREADS + 1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decompression_pool",
+	 decompression_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_decompression_pool_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_decompression_pool_initialize(
+		          &decompression_pool,
+		          4,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( decompression_pool != NULL )
+			{
+				libfsapfs_decompression_pool_free(
+				 &decompression_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "decompression_pool",
+			 decompression_pool );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_decompression_pool_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_decompression_pool_initialize(
+		          &decompression_pool,
+		          4,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( decompression_pool != NULL )
+			{
+				libfsapfs_decompression_pool_free(
+				 &decompression_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "decompression_pool",
+			 decompression_pool );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decompression_pool != NULL )
+	{
+		libfsapfs_decompression_pool_free(
+		 &decompression_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_decompression_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decompression_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decompression_pool_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_decompression_pool_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decompression_pool_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 48 ];
+
+	size_t uncompressed_block_sizes[ 3 ];
+
+	libcerror_error_t *error                           = NULL;
+	libfsapfs_decompression_pool_t *decompression_pool = NULL;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_decompression_pool_initialize(
+	          &decompression_pool,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "decompression_pool",
+	 decompression_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          48,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_block_sizes[ 0 ]",
+	 uncompressed_block_sizes[ 0 ],
+	 (size_t) 16 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_block_sizes[ 1 ]",
+	 uncompressed_block_sizes[ 1 ],
+	 (size_t) 16 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_block_sizes[ 2 ]",
+	 uncompressed_block_sizes[ 2 ],
+	 (size_t) 10 );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          fsapfs_test_decompression_pool_uncompressed_data,
+	          42 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decompression_pool_decompress(
+	          NULL,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          48,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          NULL,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          48,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          48,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          NULL,
+	          3,
+	          uncompressed_data,
+	          48,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          -1,
+	          uncompressed_data,
+	          48,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          NULL,
+	          48,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          48,
+	          0,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          32,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          48,
+	          16,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          40,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          48,
+	          16,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test decompress with a compressed block that exceeds the block size
+	 */
+	result = libfsapfs_decompression_pool_decompress(
+	          decompression_pool,
+	          LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+	          fsapfs_test_decompression_pool_compressed_data,
+	          45,
+	          fsapfs_test_decompression_pool_compressed_block_offsets,
+	          3,
+	          uncompressed_data,
+	          48,
+	          8,
+	          uncompressed_block_sizes,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_decompression_pool_free(
+	          &decompression_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decompression_pool",
+	 decompression_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decompression_pool != NULL )
+	{
+		libfsapfs_decompression_pool_free(
+		 &decompression_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+/* Decompresses the test data repeatedly
+ * Callback function for the threads of fsapfs_test_decompression_pool_decompress_threaded
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_decompression_pool_decompress_thread(
+     fsapfs_test_decompression_pool_thread_arguments_t *thread_arguments )
+{
+	uint8_t uncompressed_data[ 48 ];
+
+	size_t uncompressed_block_sizes[ 3 ];
+
+	int iteration = 0;
+
+	if( thread_arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_arguments->result = -1;
+
+	for( iteration = 0;
+	     iteration < FSAPFS_TEST_DECOMPRESSION_POOL_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		if( memory_set(
+		     uncompressed_data,
+		     0,
+		     48 ) == NULL )
+		{
+			return( -1 );
+		}
+		if( libfsapfs_decompression_pool_decompress(
+		     thread_arguments->decompression_pool,
+		     LIBFSAPFS_COMPRESSION_METHOD_DEFLATE,
+		     fsapfs_test_decompression_pool_compressed_data,
+		     45,
+		     fsapfs_test_decompression_pool_compressed_block_offsets,
+		     3,
+		     uncompressed_data,
+		     48,
+		     16,
+		     uncompressed_block_sizes,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		if( ( uncompressed_block_sizes[ 0 ] != 16 )
+		 || ( uncompressed_block_sizes[ 1 ] != 16 )
+		 || ( uncompressed_block_sizes[ 2 ] != 10 ) )
+		{
+			return( -1 );
+		}
+		if( memory_compare(
+		     uncompressed_data,
+		     fsapfs_test_decompression_pool_uncompressed_data,
+		     42 ) != 0 )
+		{
+			return( -1 );
+		}
+	}
+	thread_arguments->result = 1;
+
+	return( 1 );
+}
+
+/* Tests the libfsapfs_decompression_pool_decompress function with concurrent callers
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decompression_pool_decompress_threaded(
+     void )
+{
+	fsapfs_test_decompression_pool_thread_arguments_t thread_arguments[ FSAPFS_TEST_DECOMPRESSION_POOL_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ FSAPFS_TEST_DECOMPRESSION_POOL_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error                           = NULL;
+	libfsapfs_decompression_pool_t *decompression_pool = NULL;
+	int result                                         = 0;
+	int thread_index                                   = 0;
+
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_DECOMPRESSION_POOL_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libfsapfs_decompression_pool_initialize(
+	          &decompression_pool,
+	          3,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "decompression_pool",
+	 decompression_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_DECOMPRESSION_POOL_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		thread_arguments[ thread_index ].decompression_pool = decompression_pool;
+		thread_arguments[ thread_index ].result             = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &fsapfs_test_decompression_pool_decompress_thread,
+		          (void *) &( thread_arguments[ thread_index ] ),
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_DECOMPRESSION_POOL_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "thread_arguments[ thread_index ].result",
+		 thread_arguments[ thread_index ].result,
+		 1 );
+	}
+	/* Clean up
+	 */
+	result = libfsapfs_decompression_pool_free(
+	          &decompression_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_DECOMPRESSION_POOL_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( decompression_pool != NULL )
+	{
+		libfsapfs_decompression_pool_free(
+		 &decompression_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decompression_pool_initialize",
+	 fsapfs_test_decompression_pool_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decompression_pool_free",
+	 fsapfs_test_decompression_pool_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decompression_pool_decompress",
+	 fsapfs_test_decompression_pool_decompress );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decompression_pool_decompress (threaded)",
+	 fsapfs_test_decompression_pool_decompress_threaded );
+
+#endif
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,997 @@
+/*
+ * Library decryption_pool type test program
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_decryption_pool.h"
+#include "../libfsapfs/libfsapfs_definitions.h"
+#include "../libfsapfs/libfsapfs_encryption_context.h"
+
+uint8_t fsapfs_test_decryption_pool_key1[ 16 ] = {
+	0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45, 0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26 };
+
+uint8_t fsapfs_test_decryption_pool_tweak_key1[ 16 ] = {
+	0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93, 0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95 };
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_decryption_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decryption_pool_initialize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libfsapfs_decryption_pool_t *decryption_pool = NULL;
+	int result                                   = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests              = 2;
+	int number_of_memset_fail_tests              = 2;
+	int test_number                              = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_decryption_pool_initialize(
+	          &decryption_pool,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          fsapfs_test_decryption_pool_key1,
+	          16,
+	          fsapfs_test_decryption_pool_tweak_key1,
+	          16,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "decryption_pool",
+	 decryption_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_decryption_pool_free(
+	          &decryption_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decryption_pool",
+	 decryption_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decryption_pool_initialize(
+	          NULL,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          fsapfs_test_decryption_pool_key1,
+	          16,
+	          fsapfs_test_decryption_pool_tweak_key1,
+	          16,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	decryption_pool = (libfsapfs_decryption_pool_t *) 0x12345678UL;
+
+	result = libfsapfs_decryption_pool_initialize(
+	          &decryption_pool,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          fsapfs_test_decryption_pool_key1,
+	          16,
+	          fsapfs_test_decryption_pool_tweak_key1,
+	          16,
+	          4,
+	          &error );
+
+	decryption_pool = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decryption_pool_initialize(
+	          &decryption_pool,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          fsapfs_test_decryption_pool_key1,
+	          16,
+	          fsapfs_test_decryption_pool_tweak_key1,
+	          16,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decryption_pool",
+	 decryption_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decryption_pool_initialize(
+	          &decryption_pool,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          fsapfs_test_decryption_pool_key1,
+	          16,
+	          fsapfs_test_decryption_pool_tweak_key1,
+	          16,
+	          LIBFSAPFS_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS + 1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decryption_pool",
+	 decryption_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_decryption_pool_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_decryption_pool_initialize(
+		          &decryption_pool,
+		          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+		          fsapfs_test_decryption_pool_key1,
+		          16,
+		          fsapfs_test_decryption_pool_tweak_key1,
+		          16,
+		          4,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( decryption_pool != NULL )
+			{
+				libfsapfs_decryption_pool_free(
+				 &decryption_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "decryption_pool",
+			 decryption_pool );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_decryption_pool_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_decryption_pool_initialize(
+		          &decryption_pool,
+		          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+		          fsapfs_test_decryption_pool_key1,
+		          16,
+		          fsapfs_test_decryption_pool_tweak_key1,
+		          16,
+		          4,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( decryption_pool != NULL )
+			{
+				libfsapfs_decryption_pool_free(
+				 &decryption_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "decryption_pool",
+			 decryption_pool );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decryption_pool != NULL )
+	{
+		libfsapfs_decryption_pool_free(
+		 &decryption_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_decryption_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decryption_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decryption_pool_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_decryption_pool_grab_encryption_context and libfsapfs_decryption_pool_release_encryption_context functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decryption_pool_grab_encryption_context(
+     void )
+{
+	libcerror_error_t *error                            = NULL;
+	libfsapfs_decryption_pool_t *decryption_pool        = NULL;
+	libfsapfs_encryption_context_t *encryption_context1 = NULL;
+	libfsapfs_encryption_context_t *encryption_context2 = NULL;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_decryption_pool_initialize(
+	          &decryption_pool,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          fsapfs_test_decryption_pool_key1,
+	          16,
+	          fsapfs_test_decryption_pool_tweak_key1,
+	          16,
+	          2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "decryption_pool",
+	 decryption_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_decryption_pool_grab_encryption_context(
+	          decryption_pool,
+	          &encryption_context1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context1",
+	 encryption_context1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_decryption_pool_grab_encryption_context(
+	          decryption_pool,
+	          &encryption_context2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context2",
+	 encryption_context2 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_NOT_EQUAL_INTPTR(
+	 "encryption_context2",
+	 (intptr_t) encryption_context2,
+	 (intptr_t) encryption_context1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "decryption_pool->number_of_available_encryption_contexts",
+	 decryption_pool->number_of_available_encryption_contexts,
+	 0 );
+
+	result = libfsapfs_decryption_pool_release_encryption_context(
+	          decryption_pool,
+	          encryption_context2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	encryption_context2 = NULL;
+
+	result = libfsapfs_decryption_pool_release_encryption_context(
+	          decryption_pool,
+	          encryption_context1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "decryption_pool->number_of_available_encryption_contexts",
+	 decryption_pool->number_of_available_encryption_contexts,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decryption_pool_grab_encryption_context(
+	          NULL,
+	          &encryption_context2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decryption_pool_grab_encryption_context(
+	          decryption_pool,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decryption_pool_release_encryption_context(
+	          NULL,
+	          encryption_context1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decryption_pool_release_encryption_context(
+	          decryption_pool,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where all encryption contexts are available
+	 */
+	result = libfsapfs_decryption_pool_release_encryption_context(
+	          decryption_pool,
+	          encryption_context1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	encryption_context1 = NULL;
+
+	/* Clean up
+	 */
+	result = libfsapfs_decryption_pool_free(
+	          &decryption_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decryption_pool",
+	 decryption_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( decryption_pool != NULL )
+	{
+		if( encryption_context2 != NULL )
+		{
+			libfsapfs_decryption_pool_release_encryption_context(
+			 decryption_pool,
+			 encryption_context2,
+			 NULL );
+		}
+		if( encryption_context1 != NULL )
+		{
+			libfsapfs_decryption_pool_release_encryption_context(
+			 decryption_pool,
+			 encryption_context1,
+			 NULL );
+		}
+		libfsapfs_decryption_pool_free(
+		 &decryption_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_decryption_pool_decrypt function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_decryption_pool_decrypt(
+     void )
+{
+	libcerror_error_t *error                           = NULL;
+	libfsapfs_decryption_pool_t *decryption_pool       = NULL;
+	libfsapfs_encryption_context_t *encryption_context = NULL;
+	uint8_t *data                                      = NULL;
+	uint8_t *expected_data                             = NULL;
+	size_t data_offset                                 = 0;
+	size_t data_size                                   = 256 * 1024;
+	int result                                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_decryption_pool_initialize(
+	          &decryption_pool,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          fsapfs_test_decryption_pool_key1,
+	          16,
+	          fsapfs_test_decryption_pool_tweak_key1,
+	          16,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "decryption_pool",
+	 decryption_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_set_keys(
+	          encryption_context,
+	          fsapfs_test_decryption_pool_key1,
+	          16,
+	          fsapfs_test_decryption_pool_tweak_key1,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	expected_data = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * data_size );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "expected_data",
+	 expected_data );
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		data[ data_offset ]          = (uint8_t) ( ( data_offset * 7 ) ^ ( data_offset >> 9 ) );
+		expected_data[ data_offset ] = data[ data_offset ];
+	}
+	result = libfsapfs_encryption_context_crypt(
+	          encryption_context,
+	          LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          expected_data,
+	          data_size,
+	          expected_data,
+	          data_size,
+	          1234,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_decryption_pool_decrypt(
+	          decryption_pool,
+	          data,
+	          data_size,
+	          1234,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          expected_data,
+	          data_size );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_decryption_pool_decrypt(
+	          NULL,
+	          data,
+	          data_size,
+	          1234,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decryption_pool_decrypt(
+	          decryption_pool,
+	          NULL,
+	          data_size,
+	          1234,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decryption_pool_decrypt(
+	          decryption_pool,
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          1234,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decryption_pool_decrypt(
+	          decryption_pool,
+	          data,
+	          data_size - 1,
+	          1234,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_decryption_pool_decrypt(
+	          decryption_pool,
+	          data,
+	          data_size,
+	          1234,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 expected_data );
+
+	expected_data = NULL;
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libfsapfs_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_decryption_pool_free(
+	          &decryption_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "decryption_pool",
+	 decryption_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( expected_data != NULL )
+	{
+		memory_free(
+		 expected_data );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( encryption_context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	if( decryption_pool != NULL )
+	{
+		libfsapfs_decryption_pool_free(
+		 &decryption_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decryption_pool_initialize",
+	 fsapfs_test_decryption_pool_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decryption_pool_free",
+	 fsapfs_test_decryption_pool_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decryption_pool_grab_encryption_context",
+	 fsapfs_test_decryption_pool_grab_encryption_context );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_decryption_pool_decrypt",
+	 fsapfs_test_decryption_pool_decrypt );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+}
+
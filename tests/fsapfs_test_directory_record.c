@@ -590,6 +590,184 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_directory_record_get_name_from_key_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_directory_record_get_name_from_key_data(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	const uint8_t *name      = NULL;
+	uint32_t name_hash       = 0;
+	uint16_t name_size       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_directory_record_get_name_from_key_data(
+	          fsapfs_test_directory_record_key_data1,
+	          23,
+	          &name,
+	          &name_size,
+	          &name_hash,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "name",
+	 name );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT16(
+	 "name_size",
+	 name_size,
+	 11 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 (uint32_t) 0x00272f85UL );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_directory_record_get_name_from_key_data(
+	          NULL,
+	          23,
+	          &name,
+	          &name_size,
+	          &name_hash,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_directory_record_get_name_from_key_data(
+	          fsapfs_test_directory_record_key_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &name,
+	          &name_size,
+	          &name_hash,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_directory_record_get_name_from_key_data(
+	          fsapfs_test_directory_record_key_data1,
+	          0,
+	          &name,
+	          &name_size,
+	          &name_hash,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_directory_record_get_name_from_key_data(
+	          fsapfs_test_directory_record_key_data1,
+	          23,
+	          NULL,
+	          &name_size,
+	          &name_hash,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_directory_record_get_name_from_key_data(
+	          fsapfs_test_directory_record_key_data1,
+	          23,
+	          &name,
+	          NULL,
+	          &name_hash,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_directory_record_get_name_from_key_data(
+	          fsapfs_test_directory_record_key_data1,
+	          23,
+	          &name,
+	          &name_size,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -625,6 +803,10 @@ int main(
 	 "libfsapfs_directory_record_read_value_data",
 	 fsapfs_test_directory_record_read_value_data );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_directory_record_get_name_from_key_data",
+	 fsapfs_test_directory_record_get_name_from_key_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
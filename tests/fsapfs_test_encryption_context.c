@@ -33,10 +33,206 @@
 #include "fsapfs_test_memory.h"
 #include "fsapfs_test_unused.h"
 
+#include "../libfsapfs/libfsapfs_definitions.h"
 #include "../libfsapfs/libfsapfs_encryption_context.h"
+#include "../libfsapfs/libfsapfs_libcthreads.h"
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+#define FSAPFS_TEST_ENCRYPTION_CONTEXT_NUMBER_OF_THREADS	8
+#define FSAPFS_TEST_ENCRYPTION_CONTEXT_NUMBER_OF_ITERATIONS	256
+
+typedef struct fsapfs_test_encryption_context_thread_arguments fsapfs_test_encryption_context_thread_arguments_t;
+
+struct fsapfs_test_encryption_context_thread_arguments
+{
+	/* The encryption context
+	 */
+	libfsapfs_encryption_context_t *context;
+
+	/* The result
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
+uint8_t fsapfs_test_encryption_context_key1[ 16 ] = {
+	0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45, 0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26 };
+
+uint8_t fsapfs_test_encryption_context_tweak_key1[ 16 ] = {
+	0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93, 0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95 };
+
+/* The IEEE 1619 AES-XTS-128 test vectors 4 and 5, sectors 0 and 1
+ */
+uint8_t fsapfs_test_encryption_context_encrypted_data1[ 1024 ] = {
+	0x27, 0xa7, 0x47, 0x9b, 0xef, 0xa1, 0xd4, 0x76, 0x48, 0x9f, 0x30, 0x8c, 0xd4, 0xcf, 0xa6, 0xe2,
+	0xa9, 0x6e, 0x4b, 0xbe, 0x32, 0x08, 0xff, 0x25, 0x28, 0x7d, 0xd3, 0x81, 0x96, 0x16, 0xe8, 0x9c,
+	0xc7, 0x8c, 0xf7, 0xf5, 0xe5, 0x43, 0x44, 0x5f, 0x83, 0x33, 0xd8, 0xfa, 0x7f, 0x56, 0x00, 0x00,
+	0x05, 0x27, 0x9f, 0xa5, 0xd8, 0xb5, 0xe4, 0xad, 0x40, 0xe7, 0x36, 0xdd, 0xb4, 0xd3, 0x54, 0x12,
+	0x32, 0x80, 0x63, 0xfd, 0x2a, 0xab, 0x53, 0xe5, 0xea, 0x1e, 0x0a, 0x9f, 0x33, 0x25, 0x00, 0xa5,
+	0xdf, 0x94, 0x87, 0xd0, 0x7a, 0x5c, 0x92, 0xcc, 0x51, 0x2c, 0x88, 0x66, 0xc7, 0xe8, 0x60, 0xce,
+	0x93, 0xfd, 0xf1, 0x66, 0xa2, 0x49, 0x12, 0xb4, 0x22, 0x97, 0x61, 0x46, 0xae, 0x20, 0xce, 0x84,
+	0x6b, 0xb7, 0xdc, 0x9b, 0xa9, 0x4a, 0x76, 0x7a, 0xae, 0xf2, 0x0c, 0x0d, 0x61, 0xad, 0x02, 0x65,
+	0x5e, 0xa9, 0x2d, 0xc4, 0xc4, 0xe4, 0x1a, 0x89, 0x52, 0xc6, 0x51, 0xd3, 0x31, 0x74, 0xbe, 0x51,
+	0xa1, 0x0c, 0x42, 0x11, 0x10, 0xe6, 0xd8, 0x15, 0x88, 0xed, 0xe8, 0x21, 0x03, 0xa2, 0x52, 0xd8,
+	0xa7, 0x50, 0xe8, 0x76, 0x8d, 0xef, 0xff, 0xed, 0x91, 0x22, 0x81, 0x0a, 0xae, 0xb9, 0x9f, 0x91,
+	0x72, 0xaf, 0x82, 0xb6, 0x04, 0xdc, 0x4b, 0x8e, 0x51, 0xbc, 0xb0, 0x82, 0x35, 0xa6, 0xf4, 0x34,
+	0x13, 0x32, 0xe4, 0xca, 0x60, 0x48, 0x2a, 0x4b, 0xa1, 0xa0, 0x3b, 0x3e, 0x65, 0x00, 0x8f, 0xc5,
+	0xda, 0x76, 0xb7, 0x0b, 0xf1, 0x69, 0x0d, 0xb4, 0xea, 0xe2, 0x9c, 0x5f, 0x1b, 0xad, 0xd0, 0x3c,
+	0x5c, 0xcf, 0x2a, 0x55, 0xd7, 0x05, 0xdd, 0xcd, 0x86, 0xd4, 0x49, 0x51, 0x1c, 0xeb, 0x7e, 0xc3,
+	0x0b, 0xf1, 0x2b, 0x1f, 0xa3, 0x5b, 0x91, 0x3f, 0x9f, 0x74, 0x7a, 0x8a, 0xfd, 0x1b, 0x13, 0x0e,
+	0x94, 0xbf, 0xf9, 0x4e, 0xff, 0xd0, 0x1a, 0x91, 0x73, 0x5c, 0xa1, 0x72, 0x6a, 0xcd, 0x0b, 0x19,
+	0x7c, 0x4e, 0x5b, 0x03, 0x39, 0x36, 0x97, 0xe1, 0x26, 0x82, 0x6f, 0xb6, 0xbb, 0xde, 0x8e, 0xcc,
+	0x1e, 0x08, 0x29, 0x85, 0x16, 0xe2, 0xc9, 0xed, 0x03, 0xff, 0x3c, 0x1b, 0x78, 0x60, 0xf6, 0xde,
+	0x76, 0xd4, 0xce, 0xcd, 0x94, 0xc8, 0x11, 0x98, 0x55, 0xef, 0x52, 0x97, 0xca, 0x67, 0xe9, 0xf3,
+	0xe7, 0xff, 0x72, 0xb1, 0xe9, 0x97, 0x85, 0xca, 0x0a, 0x7e, 0x77, 0x20, 0xc5, 0xb3, 0x6d, 0xc6,
+	0xd7, 0x2c, 0xac, 0x95, 0x74, 0xc8, 0xcb, 0xbc, 0x2f, 0x80, 0x1e, 0x23, 0xe5, 0x6f, 0xd3, 0x44,
+	0xb0, 0x7f, 0x22, 0x15, 0x4b, 0xeb, 0xa0, 0xf0, 0x8c, 0xe8, 0x89, 0x1e, 0x64, 0x3e, 0xd9, 0x95,
+	0xc9, 0x4d, 0x9a, 0x69, 0xc9, 0xf1, 0xb5, 0xf4, 0x99, 0x02, 0x7a, 0x78, 0x57, 0x2a, 0xee, 0xbd,
+	0x74, 0xd2, 0x0c, 0xc3, 0x98, 0x81, 0xc2, 0x13, 0xee, 0x77, 0x0b, 0x10, 0x10, 0xe4, 0xbe, 0xa7,
+	0x18, 0x84, 0x69, 0x77, 0xae, 0x11, 0x9f, 0x7a, 0x02, 0x3a, 0xb5, 0x8c, 0xca, 0x0a, 0xd7, 0x52,
+	0xaf, 0xe6, 0x56, 0xbb, 0x3c, 0x17, 0x25, 0x6a, 0x9f, 0x6e, 0x9b, 0xf1, 0x9f, 0xdd, 0x5a, 0x38,
+	0xfc, 0x82, 0xbb, 0xe8, 0x72, 0xc5, 0x53, 0x9e, 0xdb, 0x60, 0x9e, 0xf4, 0xf7, 0x9c, 0x20, 0x3e,
+	0xbb, 0x14, 0x0f, 0x2e, 0x58, 0x3c, 0xb2, 0xad, 0x15, 0xb4, 0xaa, 0x5b, 0x65, 0x50, 0x16, 0xa8,
+	0x44, 0x92, 0x77, 0xdb, 0xd4, 0x77, 0xef, 0x2c, 0x8d, 0x6c, 0x01, 0x7d, 0xb7, 0x38, 0xb1, 0x8d,
+	0xeb, 0x4a, 0x42, 0x7d, 0x19, 0x23, 0xce, 0x3f, 0xf2, 0x62, 0x73, 0x57, 0x79, 0xa4, 0x18, 0xf2,
+	0x0a, 0x28, 0x2d, 0xf9, 0x20, 0x14, 0x7b, 0xea, 0xbe, 0x42, 0x1e, 0xe5, 0x31, 0x9d, 0x05, 0x68,
+	0xbb, 0xf9, 0xd6, 0xa7, 0x4a, 0x74, 0x65, 0xfe, 0xe2, 0x0f, 0x42, 0xad, 0xf9, 0xa6, 0x23, 0xfc,
+	0x95, 0x4f, 0x3b, 0x55, 0x58, 0x7e, 0x8e, 0x42, 0x9e, 0xec, 0x6f, 0x71, 0xe7, 0x38, 0xa3, 0x90,
+	0xda, 0x57, 0x6c, 0xcc, 0x19, 0x67, 0x0f, 0x29, 0xe7, 0x47, 0xf6, 0xe9, 0xff, 0x39, 0xf6, 0xc6,
+	0x80, 0x5e, 0x32, 0x9d, 0xdf, 0xa4, 0x7f, 0xa1, 0x40, 0x55, 0x09, 0x2c, 0x83, 0xc0, 0xd8, 0xfc,
+	0x38, 0x77, 0x27, 0x9c, 0x19, 0xc9, 0xcd, 0xf8, 0xa3, 0x05, 0xb1, 0x67, 0x3e, 0x89, 0xb0, 0x83,
+	0x33, 0xd5, 0x62, 0xa1, 0xa1, 0xb3, 0x8e, 0x35, 0x08, 0x59, 0x32, 0xf2, 0x9c, 0xb5, 0x54, 0x50,
+	0xd9, 0xfb, 0xa2, 0x7e, 0xae, 0x1c, 0x46, 0xd4, 0x96, 0xc3, 0x55, 0x20, 0xe7, 0x9e, 0x53, 0x50,
+	0x32, 0x60, 0x7e, 0xdf, 0x76, 0x9f, 0x06, 0x02, 0x78, 0x7f, 0x73, 0x9a, 0x22, 0x2c, 0x8e, 0x2a,
+	0x3e, 0x30, 0x94, 0xa9, 0x59, 0xaf, 0xea, 0x6d, 0xac, 0x53, 0xbe, 0x6e, 0x38, 0x8f, 0x21, 0xd4,
+	0xcc, 0xbe, 0x2b, 0x72, 0xe2, 0x92, 0x9d, 0x42, 0xb6, 0x6d, 0x10, 0x16, 0x7c, 0xa1, 0x1d, 0xc1,
+	0x45, 0x7a, 0xe1, 0xbf, 0x1f, 0x72, 0xf3, 0x33, 0xe1, 0x8e, 0x84, 0x26, 0xa7, 0xf6, 0x26, 0x66,
+	0x5c, 0xa6, 0xde, 0x8e, 0xff, 0x8e, 0xfd, 0x6e, 0x61, 0xa6, 0xec, 0x33, 0xf0, 0xf4, 0xda, 0x51,
+	0xdc, 0x87, 0x4f, 0x75, 0xb1, 0x1e, 0x9a, 0x78, 0x80, 0xe6, 0xdd, 0x9c, 0x2c, 0x17, 0xcf, 0x77,
+	0x02, 0x38, 0x62, 0x63, 0x97, 0xf9, 0x00, 0xdd, 0x6c, 0x72, 0x4b, 0x85, 0xec, 0x0c, 0xa8, 0xb7,
+	0x33, 0xd2, 0x7d, 0x7b, 0x89, 0x87, 0xa6, 0x5b, 0x0f, 0x93, 0x2f, 0x89, 0x2f, 0x2e, 0x33, 0x65,
+	0xa3, 0xc2, 0x6b, 0xde, 0x98, 0x7e, 0x98, 0x2a, 0xb5, 0x6c, 0xab, 0x63, 0x76, 0x95, 0x42, 0xf4,
+	0xac, 0xf3, 0xd3, 0xf1, 0x20, 0x02, 0x98, 0xff, 0x25, 0xee, 0x2a, 0xa0, 0xe3, 0x10, 0x48, 0x43,
+	0xa2, 0x75, 0x41, 0xad, 0x9c, 0xf9, 0x52, 0x35, 0x2f, 0xa9, 0x17, 0x74, 0xd1, 0x64, 0x1a, 0x1e,
+	0xa2, 0x75, 0x69, 0x59, 0xc4, 0x57, 0x99, 0x37, 0x5c, 0xc1, 0x4b, 0x97, 0x15, 0xee, 0x21, 0x86,
+	0x8d, 0x21, 0x79, 0xf9, 0xeb, 0x9a, 0xe1, 0x8b, 0x35, 0xc7, 0x36, 0x6e, 0x4b, 0x4e, 0x28, 0xd8,
+	0xf9, 0x4e, 0x42, 0xc7, 0xfa, 0xf5, 0xa8, 0xf5, 0x68, 0xf3, 0xb6, 0x6d, 0x4d, 0x2e, 0x29, 0xce,
+	0xea, 0x32, 0x79, 0x25, 0xd1, 0xc6, 0xd8, 0xe6, 0xd6, 0xba, 0x93, 0xc0, 0x62, 0xc5, 0x29, 0x4c,
+	0xb8, 0x7c, 0x29, 0x21, 0x33, 0xfa, 0x11, 0xa4, 0x72, 0x08, 0xf1, 0x2f, 0xbd, 0x92, 0x73, 0x98,
+	0xb8, 0x8a, 0x66, 0x0a, 0xb2, 0x93, 0xf4, 0x0c, 0xe9, 0x7f, 0x28, 0x06, 0x7e, 0x3e, 0x5d, 0x90,
+	0x2d, 0xc3, 0xd6, 0xfa, 0x49, 0xf0, 0x82, 0xd5, 0xf3, 0xe0, 0x71, 0x85, 0xe3, 0x50, 0x4a, 0x3c,
+	0x86, 0xb1, 0x21, 0x54, 0xa8, 0xc2, 0xe8, 0x62, 0xb3, 0xdc, 0xc8, 0x7a, 0x8d, 0xa0, 0x47, 0xe7,
+	0x78, 0xd4, 0x9c, 0xee, 0xbf, 0x87, 0x02, 0x52, 0x1b, 0xbd, 0xf3, 0xdb, 0x83, 0xff, 0x99, 0x6b,
+	0xc1, 0x18, 0x9a, 0xbd, 0x28, 0x89, 0xbd, 0x15, 0x0f, 0x6f, 0xb4, 0xb5, 0x4a, 0x4a, 0xac, 0xad,
+	0xbb, 0x25, 0x38, 0xe2, 0x40, 0xe0, 0xd3, 0xab, 0x1d, 0x22, 0xb0, 0xdf, 0x4f, 0x65, 0xf7, 0x65,
+	0x4f, 0x03, 0x64, 0xba, 0x25, 0xf2, 0x5f, 0x78, 0x0f, 0x98, 0xc7, 0xa7, 0x4c, 0x6f, 0x40, 0xa1,
+	0x42, 0x15, 0xc1, 0xda, 0x70, 0xbf, 0x06, 0x7c, 0x79, 0xab, 0x21, 0xd9, 0x28, 0x39, 0xeb, 0x95,
+	0x9b, 0x1c, 0x84, 0xa5, 0x2a, 0x6a, 0x5d, 0xc0, 0x65, 0xdb, 0x24, 0x96, 0xfc, 0x4e, 0x84, 0xcb };
 
 #if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
 
+/* Tests the libfsapfs_encryption_context_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_encryption_context_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfsapfs_encryption_context_t *context = NULL;
+	int result                              = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_encryption_context_initialize(
+	          &context,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_free(
+	          &context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "context",
+	 context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_encryption_context_initialize(
+	          NULL,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_encryption_context_initialize(
+	          &context,
+	          0xffffffffUL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_encryption_context_free function
  * Returns 1 if successful or 0 if not
  */
@@ -75,6 +271,662 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_encryption_context_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_encryption_context_clone(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error                            = NULL;
+	libfsapfs_encryption_context_t *destination_context = NULL;
+	libfsapfs_encryption_context_t *source_context      = NULL;
+	size_t data_offset                                  = 0;
+	int result                                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_encryption_context_initialize(
+	          &source_context,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "source_context",
+	 source_context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_set_keys(
+	          source_context,
+	          fsapfs_test_encryption_context_key1,
+	          16,
+	          fsapfs_test_encryption_context_tweak_key1,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_encryption_context_clone(
+	          &destination_context,
+	          source_context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_context",
+	 destination_context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Free the source context to make sure the clone does not depend on it
+	 */
+	result = libfsapfs_encryption_context_free(
+	          &source_context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_crypt(
+	          destination_context,
+	          LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fsapfs_test_encryption_context_encrypted_data1,
+	          1024,
+	          data,
+	          1024,
+	          0,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+		 "data[ data_offset ]",
+		 data[ data_offset ],
+		 (uint8_t) ( data_offset % 256 ) );
+	}
+	result = libfsapfs_encryption_context_free(
+	          &destination_context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_clone(
+	          &destination_context,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "destination_context",
+	 destination_context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_encryption_context_clone(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 &destination_context,
+		 NULL );
+	}
+	if( source_context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 &source_context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_encryption_context_crypt function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_encryption_context_crypt(
+     void )
+{
+	uint8_t data[ 1024 ];
+
+	libcerror_error_t *error                = NULL;
+	libfsapfs_encryption_context_t *context = NULL;
+	size_t data_offset                      = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_encryption_context_initialize(
+	          &context,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_set_keys(
+	          context,
+	          fsapfs_test_encryption_context_key1,
+	          16,
+	          fsapfs_test_encryption_context_tweak_key1,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_encryption_context_crypt(
+	          context,
+	          LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fsapfs_test_encryption_context_encrypted_data1,
+	          1024,
+	          data,
+	          1024,
+	          0,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 1024;
+	     data_offset++ )
+	{
+		FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+		 "data[ data_offset ]",
+		 data[ data_offset ],
+		 (uint8_t) ( data_offset % 256 ) );
+	}
+	/* Test decrypting the second sector in-place
+	 */
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		data[ data_offset ] = fsapfs_test_encryption_context_encrypted_data1[ 512 + data_offset ];
+	}
+	result = libfsapfs_encryption_context_crypt(
+	          context,
+	          LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          data,
+	          512,
+	          data,
+	          512,
+	          1,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 512;
+	     data_offset++ )
+	{
+		FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+		 "data[ data_offset ]",
+		 data[ data_offset ],
+		 (uint8_t) ( data_offset % 256 ) );
+	}
+	/* Test error cases
+	 */
+	result = libfsapfs_encryption_context_crypt(
+	          NULL,
+	          LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fsapfs_test_encryption_context_encrypted_data1,
+	          1024,
+	          data,
+	          1024,
+	          0,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_encryption_context_crypt(
+	          context,
+	          LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fsapfs_test_encryption_context_encrypted_data1,
+	          1024,
+	          data,
+	          1024,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_encryption_context_crypt(
+	          context,
+	          LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+	          fsapfs_test_encryption_context_encrypted_data1,
+	          1000,
+	          data,
+	          1024,
+	          0,
+	          512,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_encryption_context_free(
+	          &context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+/* Decrypts the test data repeatedly
+ * Callback function for the threads of fsapfs_test_encryption_context_crypt_threaded
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_encryption_context_crypt_thread(
+     fsapfs_test_encryption_context_thread_arguments_t *thread_arguments )
+{
+	uint8_t data[ 1024 ];
+
+	size_t data_offset = 0;
+	int iteration      = 0;
+
+	if( thread_arguments == NULL )
+	{
+		return( -1 );
+	}
+	thread_arguments->result = -1;
+
+	for( iteration = 0;
+	     iteration < FSAPFS_TEST_ENCRYPTION_CONTEXT_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		if( libfsapfs_encryption_context_crypt(
+		     thread_arguments->context,
+		     LIBFSAPFS_ENCRYPTION_CRYPT_MODE_DECRYPT,
+		     fsapfs_test_encryption_context_encrypted_data1,
+		     1024,
+		     data,
+		     1024,
+		     0,
+		     512,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		for( data_offset = 0;
+		     data_offset < 1024;
+		     data_offset++ )
+		{
+			if( data[ data_offset ] != (uint8_t) ( data_offset % 256 ) )
+			{
+				return( -1 );
+			}
+		}
+	}
+	thread_arguments->result = 1;
+
+	return( 1 );
+}
+
+/* Tests the libfsapfs_encryption_context_crypt function with concurrent threads
+ * Half of the threads share an encryption context and the other half a clone of it
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_encryption_context_crypt_threaded(
+     void )
+{
+	fsapfs_test_encryption_context_thread_arguments_t thread_arguments[ FSAPFS_TEST_ENCRYPTION_CONTEXT_NUMBER_OF_THREADS ];
+	libcthreads_thread_t *threads[ FSAPFS_TEST_ENCRYPTION_CONTEXT_NUMBER_OF_THREADS ];
+
+	libcerror_error_t *error                       = NULL;
+	libfsapfs_encryption_context_t *cloned_context = NULL;
+	libfsapfs_encryption_context_t *context        = NULL;
+	int result                                     = 0;
+	int thread_index                               = 0;
+
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_ENCRYPTION_CONTEXT_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libfsapfs_encryption_context_initialize(
+	          &context,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "context",
+	 context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_set_keys(
+	          context,
+	          fsapfs_test_encryption_context_key1,
+	          16,
+	          fsapfs_test_encryption_context_tweak_key1,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_clone(
+	          &cloned_context,
+	          context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "cloned_context",
+	 cloned_context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_ENCRYPTION_CONTEXT_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( ( thread_index % 2 ) == 0 )
+		{
+			thread_arguments[ thread_index ].context = context;
+		}
+		else
+		{
+			thread_arguments[ thread_index ].context = cloned_context;
+		}
+		thread_arguments[ thread_index ].result = 0;
+
+		result = libcthreads_thread_create(
+		          &( threads[ thread_index ] ),
+		          NULL,
+		          (int (*)(void *)) &fsapfs_test_encryption_context_crypt_thread,
+		          (void *) &( thread_arguments[ thread_index ] ),
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_ENCRYPTION_CONTEXT_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		result = libcthreads_thread_join(
+		          &( threads[ thread_index ] ),
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "thread_arguments[ thread_index ].result",
+		 thread_arguments[ thread_index ].result,
+		 1 );
+	}
+	/* Clean up
+	 */
+	result = libfsapfs_encryption_context_free(
+	          &cloned_context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_free(
+	          &context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( thread_index = 0;
+	     thread_index < FSAPFS_TEST_ENCRYPTION_CONTEXT_NUMBER_OF_THREADS;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] != NULL )
+		{
+			libcthreads_thread_join(
+			 &( threads[ thread_index ] ),
+			 NULL );
+		}
+	}
+	if( cloned_context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 &cloned_context,
+		 NULL );
+	}
+	if( context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 &context,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT ) */
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -94,15 +946,31 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
 
-	/* TODO: add tests for libfsapfs_encryption_context_initialize */
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_encryption_context_initialize",
+	 fsapfs_test_encryption_context_initialize );
 
 	FSAPFS_TEST_RUN(
 	 "libfsapfs_encryption_context_free",
 	 fsapfs_test_encryption_context_free );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_encryption_context_clone",
+	 fsapfs_test_encryption_context_clone );
+
 	/* TODO: add tests for libfsapfs_encryption_context_set_keys */
 
-	/* TODO: add tests for libfsapfs_encryption_context_crypt */
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_encryption_context_crypt",
+	 fsapfs_test_encryption_context_crypt );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_encryption_context_crypt (threaded)",
+	 fsapfs_test_encryption_context_crypt_threaded );
+
+#endif
 
 	/* TODO: add tests for libfsapfs_encryption_aes_key_unwrap */
 
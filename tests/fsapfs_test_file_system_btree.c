@@ -34,6 +34,7 @@
 #include "fsapfs_test_memory.h"
 #include "fsapfs_test_unused.h"
 
+#include "../libfsapfs/libfsapfs_io_handle.h"
 #include "../libfsapfs/libfsapfs_file_system_btree.h"
 
 uint8_t fsapfs_test_file_system_btree_data1[ 4096 ] = {
@@ -303,6 +304,7 @@ int fsapfs_test_file_system_btree_initialize(
      void )
 {
 	libcerror_error_t *error                         = NULL;
+	libfsapfs_io_handle_t *io_handle                 = NULL;
 	libfsapfs_file_system_btree_t *file_system_btree = NULL;
 	int result                                       = 0;
 
@@ -312,12 +314,30 @@ int fsapfs_test_file_system_btree_initialize(
 	int test_number                                  = 0;
 #endif
 
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
 	result = libfsapfs_file_system_btree_initialize(
 	          &file_system_btree,
-	          NULL,
-	          NULL,
+	          io_handle,
 	          NULL,
 	          NULL,
 	          0,
@@ -361,7 +381,6 @@ int fsapfs_test_file_system_btree_initialize(
 	          NULL,
 	          NULL,
 	          NULL,
-	          NULL,
 	          0,
 	          0,
 	          &error );
@@ -382,8 +401,7 @@ int fsapfs_test_file_system_btree_initialize(
 
 	result = libfsapfs_file_system_btree_initialize(
 	          &file_system_btree,
-	          NULL,
-	          NULL,
+	          io_handle,
 	          NULL,
 	          NULL,
 	          0,
@@ -404,6 +422,27 @@ int fsapfs_test_file_system_btree_initialize(
 	libcerror_error_free(
 	 &error );
 
+	result = libfsapfs_file_system_btree_initialize(
+	          &file_system_btree,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 #if defined( HAVE_FSAPFS_TEST_MEMORY )
 
 	for( test_number = 0;
@@ -416,8 +455,7 @@ int fsapfs_test_file_system_btree_initialize(
 
 		result = libfsapfs_file_system_btree_initialize(
 		          &file_system_btree,
-		          NULL,
-		          NULL,
+		          io_handle,
 		          NULL,
 		          NULL,
 		          0,
@@ -464,8 +502,7 @@ int fsapfs_test_file_system_btree_initialize(
 
 		result = libfsapfs_file_system_btree_initialize(
 		          &file_system_btree,
-		          NULL,
-		          NULL,
+		          io_handle,
 		          NULL,
 		          NULL,
 		          0,
@@ -504,6 +541,25 @@ int fsapfs_test_file_system_btree_initialize(
 	}
 #endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
 
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -518,6 +574,12 @@ on_error:
 		 &file_system_btree,
 		 NULL );
 	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -21,22 +21,289 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "fsapfs_test_libcdata.h"
 #include "fsapfs_test_libcerror.h"
 #include "fsapfs_test_libfsapfs.h"
 #include "fsapfs_test_macros.h"
 #include "fsapfs_test_memory.h"
 #include "fsapfs_test_unused.h"
 
+#include "../libfsapfs/libfsapfs_definitions.h"
+#include "../libfsapfs/libfsapfs_encryption_context.h"
+#include "../libfsapfs/libfsapfs_file_extent.h"
 #include "../libfsapfs/libfsapfs_file_system_data_handle.h"
+#include "../libfsapfs/libfsapfs_io_handle.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
 
+/* Tests the libfsapfs_file_system_data_handle_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_system_data_handle_initialize(
+     void )
+{
+	uint8_t key[ 16 ] = {
+		0x27, 0x18, 0x28, 0x18, 0x28, 0x45, 0x90, 0x45, 0x23, 0x53, 0x60, 0x28, 0x74, 0x71, 0x35, 0x26 };
+
+	uint8_t tweak_key[ 16 ] = {
+		0x31, 0x41, 0x59, 0x26, 0x53, 0x58, 0x97, 0x93, 0x23, 0x84, 0x62, 0x64, 0x33, 0x83, 0x27, 0x95 };
+
+	libcerror_error_t *error                                     = NULL;
+	libfsapfs_encryption_context_t *encryption_context           = NULL;
+	libfsapfs_file_system_data_handle_t *file_system_data_handle = NULL;
+	libfsapfs_io_handle_t *io_handle                             = NULL;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_initialize(
+	          &encryption_context,
+	          LIBFSAPFS_ENCRYPTION_METHOD_AES_128_XTS,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "encryption_context",
+	 encryption_context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_encryption_context_set_keys(
+	          encryption_context,
+	          key,
+	          16,
+	          tweak_key,
+	          16,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_file_system_data_handle_initialize(
+	          &file_system_data_handle,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_data_handle",
+	 file_system_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_system_data_handle->encryption_context",
+	 file_system_data_handle->encryption_context );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_data_handle_free(
+	          &file_system_data_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the data handle uses its own clone of the encryption context
+	 */
+	result = libfsapfs_file_system_data_handle_initialize(
+	          &file_system_data_handle,
+	          io_handle,
+	          encryption_context,
+	          NULL,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_data_handle",
+	 file_system_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_data_handle->encryption_context",
+	 file_system_data_handle->encryption_context );
+
+	FSAPFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "file_system_data_handle->encryption_context",
+	 (int) ( file_system_data_handle->encryption_context == encryption_context ),
+	 1 );
+
+	FSAPFS_TEST_ASSERT_NOT_EQUAL_INT(
+	 "file_system_data_handle->encryption_context->keys_are_set",
+	 (int) file_system_data_handle->encryption_context->keys_are_set,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_system_data_handle_free(
+	          &file_system_data_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_file_system_data_handle_initialize(
+	          NULL,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_file_system_data_handle_initialize(
+	          &file_system_data_handle,
+	          NULL,
+	          NULL,
+	          NULL,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_encryption_context_free(
+	          &encryption_context,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_system_data_handle != NULL )
+	{
+		libfsapfs_file_system_data_handle_free(
+		 &file_system_data_handle,
+		 NULL );
+	}
+	if( encryption_context != NULL )
+	{
+		libfsapfs_encryption_context_free(
+		 &encryption_context,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfsapfs_file_system_data_handle_free function
  * Returns 1 if successful or 0 if not
  */
@@ -75,6 +342,326 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_file_system_data_handle_read_extent_data function on sparse file extents
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_file_system_data_handle_read_extent_data_sparse(
+     void )
+{
+	uint8_t data[ 16384 ];
+
+	libcdata_array_t *file_extents                               = NULL;
+	libcerror_error_t *error                                     = NULL;
+	libfsapfs_file_extent_t *file_extent                         = NULL;
+	libfsapfs_file_system_data_handle_t *file_system_data_handle = NULL;
+	libfsapfs_io_handle_t *io_handle                             = NULL;
+	size_t data_offset                                           = 0;
+	ssize_t read_count                                           = 0;
+	int entry_index                                              = 0;
+	int extent_index                                             = 0;
+	int result                                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size = 4096;
+
+	result = libcdata_array_initialize(
+	          &file_extents,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_extents",
+	 file_extents );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_file_extent_initialize(
+	          &file_extent,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_extent",
+	 file_extent );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_extent->logical_offset        = 0;
+	file_extent->physical_block_number = 0;
+	file_extent->data_size             = 8192;
+
+	result = libcdata_array_append_entry(
+	          file_extents,
+	          &entry_index,
+	          (intptr_t *) file_extent,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_extent = NULL;
+
+	result = libfsapfs_file_system_data_handle_initialize(
+	          &file_system_data_handle,
+	          io_handle,
+	          NULL,
+	          file_extents,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_system_data_handle",
+	 file_system_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	memory_set(
+	 data,
+	 0xff,
+	 16384 );
+
+	read_count = libfsapfs_file_system_data_handle_read_extent_data(
+	              file_system_data_handle,
+	              NULL,
+	              NULL,
+	              &extent_index,
+	              4096,
+	              data,
+	              16384,
+	              65536,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 4096 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_offset = 0;
+	     data_offset < 4096;
+	     data_offset++ )
+	{
+		FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+		 "data[ data_offset ]",
+		 data[ data_offset ],
+		 0 );
+	}
+	FSAPFS_TEST_ASSERT_EQUAL_UINT8(
+	 "data[ 4096 ]",
+	 data[ 4096 ],
+	 0xff );
+
+	result = libfsapfs_file_system_data_handle_get_file_extent_at_offset(
+	          file_system_data_handle,
+	          &extent_index,
+	          4096,
+	          &file_extent,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "file_extent",
+	 file_extent );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_extent = NULL;
+
+	result = libfsapfs_file_system_data_handle_get_file_extent_at_offset(
+	          file_system_data_handle,
+	          &extent_index,
+	          8192,
+	          &file_extent,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Advising is ignored if the container is not memory mapped
+	 */
+	result = libfsapfs_file_system_data_handle_advise_extent_data(
+	          file_system_data_handle,
+	          &extent_index,
+	          0,
+	          8192,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a sparse file extent without the sparse flag set
+	 */
+	file_system_data_handle->is_sparse = 0;
+
+	read_count = libfsapfs_file_system_data_handle_read_extent_data(
+	              file_system_data_handle,
+	              NULL,
+	              NULL,
+	              &extent_index,
+	              0,
+	              data,
+	              16384,
+	              0,
+	              &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_file_system_data_handle_free(
+	          &file_system_data_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "file_system_data_handle",
+	 file_system_data_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_free(
+	          &file_extents,
+	          (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_system_data_handle != NULL )
+	{
+		libfsapfs_file_system_data_handle_free(
+		 &file_system_data_handle,
+		 NULL );
+	}
+	if( file_extent != NULL )
+	{
+		libfsapfs_file_extent_free(
+		 &file_extent,
+		 NULL );
+	}
+	if( file_extents != NULL )
+	{
+		libcdata_array_free(
+		 &file_extents,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfsapfs_file_extent_free,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -94,7 +681,9 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
 
-	/* TODO: add tests for libfsapfs_file_system_data_handle_initialize */
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_system_data_handle_initialize",
+	 fsapfs_test_file_system_data_handle_initialize );
 
 	FSAPFS_TEST_RUN(
 	 "libfsapfs_file_system_data_handle_free",
@@ -102,6 +691,10 @@ int main(
 
 	/* TODO: add tests for libfsapfs_file_system_data_handle_read_data_block */
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_file_system_data_handle_read_extent_data_sparse",
+	 fsapfs_test_file_system_data_handle_read_extent_data_sparse );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
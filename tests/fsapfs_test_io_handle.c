@@ -398,6 +398,2015 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfsapfs_io_handle_clone function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_clone(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libfsapfs_io_handle_t *destination_io_handle = NULL;
+	libfsapfs_io_handle_t *source_io_handle      = NULL;
+	int number_of_cache_entries                  = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &source_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "source_io_handle",
+	 source_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	source_io_handle->block_size         = 8192;
+	source_io_handle->maximum_cache_size = 16 * 1024 * 1024;
+
+	source_io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES - 1 ]->number_of_lookups = 5;
+
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          source_io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &number_of_cache_entries,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries",
+	 number_of_cache_entries,
+	 1280 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_io_handle_clone(
+	          &destination_io_handle,
+	          source_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "destination_io_handle",
+	 destination_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT32(
+	 "destination_io_handle->block_size",
+	 destination_io_handle->block_size,
+	 8192 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "destination_io_handle->cache_statistics[ 2 ]",
+	 (int) ( destination_io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES - 1 ] != source_io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES - 1 ] ),
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "destination_io_handle->cache_statistics[ 2 ]->number_of_lookups",
+	 destination_io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES - 1 ]->number_of_lookups,
+	 (uint64_t) 0 );
+
+	/* The destination has the maximum cache size of the source but a cache budget of its own
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "destination_io_handle->maximum_cache_size",
+	 destination_io_handle->maximum_cache_size,
+	 (uint64_t) 16 * 1024 * 1024 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "destination_io_handle->number_of_reserved_cache_entries[ 2 ]",
+	 destination_io_handle->number_of_reserved_cache_entries[ LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES - 1 ],
+	 (uint64_t) 0 );
+
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          destination_io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &number_of_cache_entries,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries",
+	 number_of_cache_entries,
+	 1280 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "source_io_handle->number_of_reserved_cache_entries[ 2 ]",
+	 source_io_handle->number_of_reserved_cache_entries[ LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES - 1 ],
+	 (uint64_t) 1280 );
+
+	result = libfsapfs_io_handle_free(
+	          &destination_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "destination_io_handle",
+	 destination_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_clone(
+	          &destination_io_handle,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "destination_io_handle",
+	 destination_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_clone(
+	          NULL,
+	          source_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	destination_io_handle = (libfsapfs_io_handle_t *) 0x12345678UL;
+
+	result = libfsapfs_io_handle_clone(
+	          &destination_io_handle,
+	          source_io_handle,
+	          &error );
+
+	destination_io_handle = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &source_io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "source_io_handle",
+	 source_io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( destination_io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &destination_io_handle,
+		 NULL );
+	}
+	if( source_io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &source_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_set_maximum_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_set_maximum_cache_size(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsapfs_io_handle_t *io_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_io_handle_set_maximum_cache_size(
+	          io_handle,
+	          64 * 1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_set_maximum_cache_size(
+	          NULL,
+	          64 * 1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_set_maximum_cache_size_by_type function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_set_maximum_cache_size_by_type(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsapfs_io_handle_t *io_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_io_handle_set_maximum_cache_size_by_type(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_set_maximum_cache_size_by_type(
+	          NULL,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_set_maximum_cache_size_by_type(
+	          io_handle,
+	          0,
+	          1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_set_maximum_cache_size_by_type(
+	          io_handle,
+	          LIBFSAPFS_NUMBER_OF_CACHE_TYPES + 1,
+	          1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_set_maximum_read_ahead_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_set_maximum_read_ahead_size(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsapfs_io_handle_t *io_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->maximum_read_ahead_size",
+	 (uint64_t) io_handle->maximum_read_ahead_size,
+	 (uint64_t) LIBFSAPFS_DEFAULT_MAXIMUM_READ_AHEAD_SIZE );
+
+	result = libfsapfs_io_handle_set_maximum_read_ahead_size(
+	          io_handle,
+	          1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->maximum_read_ahead_size",
+	 (uint64_t) io_handle->maximum_read_ahead_size,
+	 (uint64_t) 1024 * 1024 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_set_maximum_read_ahead_size(
+	          NULL,
+	          1024 * 1024,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_set_maximum_read_ahead_size(
+	          io_handle,
+	          (size64_t) LIBFSAPFS_MAXIMUM_READ_AHEAD_SIZE + 1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_set_maximum_number_of_concurrent_reads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_set_maximum_number_of_concurrent_reads(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsapfs_io_handle_t *io_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->maximum_number_of_concurrent_reads",
+	 io_handle->maximum_number_of_concurrent_reads,
+	 1 );
+
+	result = libfsapfs_io_handle_set_maximum_number_of_concurrent_reads(
+	          io_handle,
+	          8,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->maximum_number_of_concurrent_reads",
+	 io_handle->maximum_number_of_concurrent_reads,
+	 8 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_set_maximum_number_of_concurrent_reads(
+	          NULL,
+	          8,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_set_maximum_number_of_concurrent_reads(
+	          io_handle,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_set_maximum_number_of_concurrent_reads(
+	          io_handle,
+	          LIBFSAPFS_MAXIMUM_NUMBER_OF_CONCURRENT_READS + 1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_set_maximum_number_of_decryption_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_set_maximum_number_of_decryption_threads(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsapfs_io_handle_t *io_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->maximum_number_of_decryption_threads",
+	 io_handle->maximum_number_of_decryption_threads,
+	 1 );
+
+	result = libfsapfs_io_handle_set_maximum_number_of_decryption_threads(
+	          io_handle,
+	          8,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->maximum_number_of_decryption_threads",
+	 io_handle->maximum_number_of_decryption_threads,
+	 8 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_set_maximum_number_of_decryption_threads(
+	          NULL,
+	          8,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_set_maximum_number_of_decryption_threads(
+	          io_handle,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_set_maximum_number_of_decryption_threads(
+	          io_handle,
+	          LIBFSAPFS_MAXIMUM_NUMBER_OF_DECRYPTION_THREADS + 1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_set_maximum_number_of_decompression_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_set_maximum_number_of_decompression_threads(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsapfs_io_handle_t *io_handle = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->maximum_number_of_decompression_threads",
+	 io_handle->maximum_number_of_decompression_threads,
+	 1 );
+
+	result = libfsapfs_io_handle_set_maximum_number_of_decompression_threads(
+	          io_handle,
+	          8,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "io_handle->maximum_number_of_decompression_threads",
+	 io_handle->maximum_number_of_decompression_threads,
+	 8 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_set_maximum_number_of_decompression_threads(
+	          NULL,
+	          8,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_set_maximum_number_of_decompression_threads(
+	          io_handle,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_set_maximum_number_of_decompression_threads(
+	          io_handle,
+	          LIBFSAPFS_MAXIMUM_NUMBER_OF_DECOMPRESSION_THREADS + 1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_get_maximum_number_of_cache_entries function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_get_maximum_number_of_cache_entries(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libfsapfs_io_handle_t *io_handle    = NULL;
+	int maximum_number_of_cache_entries = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &maximum_number_of_cache_entries,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_cache_entries",
+	 maximum_number_of_cache_entries,
+	 LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size         = 4096;
+	io_handle->maximum_cache_size = 16 * 1024 * 1024;
+
+	result = libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &maximum_number_of_cache_entries,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_cache_entries",
+	 maximum_number_of_cache_entries,
+	 2560 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->maximum_cache_size_by_type[ LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS - 1 ] = 1024;
+
+	result = libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+	          &maximum_number_of_cache_entries,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_cache_entries",
+	 maximum_number_of_cache_entries,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+	          NULL,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &maximum_number_of_cache_entries,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+	          io_handle,
+	          0,
+	          &maximum_number_of_cache_entries,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	io_handle->block_size = 0;
+
+	result = libfsapfs_io_handle_get_maximum_number_of_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &maximum_number_of_cache_entries,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_reserve_cache_entries and libfsapfs_io_handle_release_cache_entries functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_reserve_cache_entries(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsapfs_io_handle_t *io_handle = NULL;
+	int number_of_cache_entries1     = 0;
+	int number_of_cache_entries2     = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &number_of_cache_entries1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries1",
+	 number_of_cache_entries1,
+	 LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES );
+
+	/* Without a maximum cache size every cache gets the default number of cache entries
+	 */
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &number_of_cache_entries2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries2",
+	 number_of_cache_entries2,
+	 LIBFSAPFS_MAXIMUM_CACHE_ENTRIES_BTREE_NODES );
+
+	result = libfsapfs_io_handle_release_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          number_of_cache_entries1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_release_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          number_of_cache_entries2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->block_size         = 4096;
+	io_handle->maximum_cache_size = 16 * 1024 * 1024;
+
+	/* The maximum cache size of the cache type is shared by the caches
+	 */
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &number_of_cache_entries1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries1",
+	 number_of_cache_entries1,
+	 2560 );
+
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &number_of_cache_entries2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries2",
+	 number_of_cache_entries2,
+	 1 );
+
+	result = libfsapfs_io_handle_release_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          number_of_cache_entries1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &number_of_cache_entries1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_cache_entries1",
+	 number_of_cache_entries1,
+	 2559 );
+
+	result = libfsapfs_io_handle_release_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          number_of_cache_entries1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_release_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          number_of_cache_entries2,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "io_handle->number_of_reserved_cache_entries[ LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES - 1 ]",
+	 io_handle->number_of_reserved_cache_entries[ LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES - 1 ],
+	 (uint64_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          NULL,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          &number_of_cache_entries1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          io_handle,
+	          0,
+	          &number_of_cache_entries1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_DECOMPRESSED_DATA,
+	          &number_of_cache_entries1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_reserve_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_release_cache_entries(
+	          NULL,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_release_cache_entries(
+	          io_handle,
+	          0,
+	          1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_release_cache_entries(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_FILE_SYSTEM_NODES,
+	          -1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_get_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_get_cache_statistics(
+     void )
+{
+	libcerror_error_t *error                       = NULL;
+	libfsapfs_cache_statistics_t *cache_statistics = NULL;
+	libfsapfs_io_handle_t *io_handle               = NULL;
+	int result                                     = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_io_handle_get_cache_statistics(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "cache_statistics",
+	 (int) ( cache_statistics == io_handle->cache_statistics[ LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS - 1 ] ),
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_get_cache_statistics(
+	          NULL,
+	          LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_get_cache_statistics(
+	          io_handle,
+	          0,
+	          &cache_statistics,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_get_cache_statistics(
+	          io_handle,
+	          LIBFSAPFS_CACHE_TYPE_DATA_BLOCKS,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_io_handle_add_read_ahead_statistics and libfsapfs_io_handle_get_read_ahead_statistics functions
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_io_handle_get_read_ahead_statistics(
+     void )
+{
+	libcerror_error_t *error         = NULL;
+	libfsapfs_io_handle_t *io_handle = NULL;
+	size64_t read_size               = 0;
+	size64_t used_size               = 0;
+	uint64_t number_of_reads         = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_io_handle_add_read_ahead_statistics(
+	          io_handle,
+	          1,
+	          65536,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_add_read_ahead_statistics(
+	          io_handle,
+	          0,
+	          0,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_io_handle_get_read_ahead_statistics(
+	          io_handle,
+	          &number_of_reads,
+	          &read_size,
+	          &used_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_reads",
+	 number_of_reads,
+	 (uint64_t) 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "read_size",
+	 (uint64_t) read_size,
+	 (uint64_t) 65536 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "used_size",
+	 (uint64_t) used_size,
+	 (uint64_t) 4096 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_io_handle_add_read_ahead_statistics(
+	          NULL,
+	          1,
+	          65536,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_get_read_ahead_statistics(
+	          NULL,
+	          &number_of_reads,
+	          &read_size,
+	          &used_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_get_read_ahead_statistics(
+	          io_handle,
+	          NULL,
+	          &read_size,
+	          &used_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_get_read_ahead_statistics(
+	          io_handle,
+	          &number_of_reads,
+	          NULL,
+	          &used_size,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_io_handle_get_read_ahead_statistics(
+	          io_handle,
+	          &number_of_reads,
+	          &read_size,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 /* The main program
@@ -429,6 +2438,50 @@ int main(
 	 "libfsapfs_io_handle_clear",
 	 fsapfs_test_io_handle_clear );
 
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_clone",
+	 fsapfs_test_io_handle_clone );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_set_maximum_cache_size",
+	 fsapfs_test_io_handle_set_maximum_cache_size );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_set_maximum_cache_size_by_type",
+	 fsapfs_test_io_handle_set_maximum_cache_size_by_type );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_set_maximum_read_ahead_size",
+	 fsapfs_test_io_handle_set_maximum_read_ahead_size );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_set_maximum_number_of_concurrent_reads",
+	 fsapfs_test_io_handle_set_maximum_number_of_concurrent_reads );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_set_maximum_number_of_decryption_threads",
+	 fsapfs_test_io_handle_set_maximum_number_of_decryption_threads );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_set_maximum_number_of_decompression_threads",
+	 fsapfs_test_io_handle_set_maximum_number_of_decompression_threads );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_get_maximum_number_of_cache_entries",
+	 fsapfs_test_io_handle_get_maximum_number_of_cache_entries );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_reserve_cache_entries",
+	 fsapfs_test_io_handle_reserve_cache_entries );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_get_cache_statistics",
+	 fsapfs_test_io_handle_get_cache_statistics );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_io_handle_get_read_ahead_statistics",
+	 fsapfs_test_io_handle_get_read_ahead_statistics );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
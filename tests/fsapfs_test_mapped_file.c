@@ -0,0 +1,1180 @@
+/*
+ * Library mapped_file type test program
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_getopt.h"
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_definitions.h"
+#include "../libfsapfs/libfsapfs_mapped_file.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_mapped_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_mapped_file_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsapfs_mapped_file_t *mapped_file = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_mapped_file_initialize(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mapped_file = (libfsapfs_mapped_file_t *) 0x12345678UL;
+
+	result = libfsapfs_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	mapped_file = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_mapped_file_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_mapped_file_initialize(
+		          &mapped_file,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( mapped_file != NULL )
+			{
+				libfsapfs_mapped_file_free(
+				 &mapped_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "mapped_file",
+			 mapped_file );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_mapped_file_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_mapped_file_initialize(
+		          &mapped_file,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( mapped_file != NULL )
+			{
+				libfsapfs_mapped_file_free(
+				 &mapped_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "mapped_file",
+			 mapped_file );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		libfsapfs_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_mapped_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_mapped_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_mapped_file_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_mapped_file_open function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_mapped_file_open(
+     const system_character_t *source )
+{
+	uint8_t mapped_data[ 64 ];
+
+	libcerror_error_t *error             = NULL;
+	libfsapfs_mapped_file_t *mapped_file = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( source != NULL )
+	{
+		/* Test regular cases
+		 */
+		result = libfsapfs_mapped_file_open(
+		          mapped_file,
+		          source,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "mapped_file->data",
+		 mapped_file->data );
+
+		FSAPFS_TEST_ASSERT_NOT_EQUAL_INT64(
+		 "mapped_file->data_size",
+		 (int64_t) mapped_file->data_size,
+		 (int64_t) 0 );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "mapped_file->access_pattern",
+		 mapped_file->access_pattern,
+		 LIBFSAPFS_MAPPED_FILE_ADVICE_RANDOM );
+
+		/* Test error case where the file is already mapped
+		 */
+		result = libfsapfs_mapped_file_open(
+		          mapped_file,
+		          source,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		/* Clean up
+		 */
+		result = libfsapfs_mapped_file_close(
+		          mapped_file,
+		          &error );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		FSAPFS_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error case where the file does not exist
+	 */
+	result = libfsapfs_mapped_file_open(
+	          mapped_file,
+	          "fsapfs_test_mapped_file_does_not_exist",
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "mapped_file->data",
+	 mapped_file->data );
+
+#else
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( source )
+
+#endif /* defined( HAVE_LIBFSAPFS_MAPPED_FILE_SUPPORT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) */
+
+	/* Test error cases
+	 */
+	result = libfsapfs_mapped_file_open(
+	          NULL,
+	          "test",
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_mapped_file_open(
+	          mapped_file,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	mapped_file->data      = mapped_data;
+	mapped_file->data_size = 64;
+
+	result = libfsapfs_mapped_file_open(
+	          mapped_file,
+	          "test",
+	          &error );
+
+	mapped_file->data      = NULL;
+	mapped_file->data_size = 0;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		if( mapped_file->data == mapped_data )
+		{
+			mapped_file->data      = NULL;
+			mapped_file->data_size = 0;
+		}
+		libfsapfs_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_mapped_file_close function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_mapped_file_close(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsapfs_mapped_file_t *mapped_file = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	mapped_file->access_pattern = LIBFSAPFS_MAPPED_FILE_ADVICE_SEQUENTIAL;
+
+	result = libfsapfs_mapped_file_close(
+	          mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "mapped_file->data",
+	 mapped_file->data );
+
+	FSAPFS_TEST_ASSERT_EQUAL_UINT64(
+	 "mapped_file->data_size",
+	 (uint64_t) mapped_file->data_size,
+	 (uint64_t) 0 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "mapped_file->access_pattern",
+	 mapped_file->access_pattern,
+	 LIBFSAPFS_MAPPED_FILE_ADVICE_NORMAL );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_mapped_file_close(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		libfsapfs_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_mapped_file_get_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_mapped_file_get_data(
+     void )
+{
+	uint8_t mapped_data[ 64 ];
+
+	libcerror_error_t *error             = NULL;
+	libfsapfs_mapped_file_t *mapped_file = NULL;
+	const uint8_t *data                  = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_mapped_file_get_data(
+	          mapped_file,
+	          0,
+	          16,
+	          &data,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	mapped_file->data      = mapped_data;
+	mapped_file->data_size = 64;
+
+	result = libfsapfs_mapped_file_get_data(
+	          mapped_file,
+	          16,
+	          48,
+	          &data,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "data",
+	 (int) ( data - mapped_data ),
+	 16 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_mapped_file_get_data(
+	          mapped_file,
+	          16,
+	          49,
+	          &data,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_mapped_file_get_data(
+	          NULL,
+	          0,
+	          16,
+	          &data,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_mapped_file_get_data(
+	          mapped_file,
+	          -1,
+	          16,
+	          &data,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_mapped_file_get_data(
+	          mapped_file,
+	          0,
+	          16,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	mapped_file->data      = NULL;
+	mapped_file->data_size = 0;
+
+	result = libfsapfs_mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		mapped_file->data = NULL;
+
+		libfsapfs_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_mapped_file_set_access_pattern function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_mapped_file_set_access_pattern(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	libcerror_error_t *error             = NULL;
+	libfsapfs_mapped_file_t *mapped_file = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_mapped_file_set_access_pattern(
+	          mapped_file,
+	          LIBFSAPFS_MAPPED_FILE_ADVICE_RANDOM,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The access pattern is not set if the file is not mapped
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "mapped_file->access_pattern",
+	 mapped_file->access_pattern,
+	 LIBFSAPFS_MAPPED_FILE_ADVICE_NORMAL );
+
+	/* The access pattern is not advised again if it is unchanged
+	 */
+	mapped_file->data           = data;
+	mapped_file->data_size      = 4096;
+	mapped_file->access_pattern = LIBFSAPFS_MAPPED_FILE_ADVICE_RANDOM;
+
+	result = libfsapfs_mapped_file_set_access_pattern(
+	          mapped_file,
+	          LIBFSAPFS_MAPPED_FILE_ADVICE_RANDOM,
+	          &error );
+
+	mapped_file->data      = NULL;
+	mapped_file->data_size = 0;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "mapped_file->access_pattern",
+	 mapped_file->access_pattern,
+	 LIBFSAPFS_MAPPED_FILE_ADVICE_RANDOM );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_mapped_file_set_access_pattern(
+	          NULL,
+	          LIBFSAPFS_MAPPED_FILE_ADVICE_RANDOM,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_mapped_file_set_access_pattern(
+	          mapped_file,
+	          -1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		mapped_file->data = NULL;
+
+		libfsapfs_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_mapped_file_advise_will_need function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_mapped_file_advise_will_need(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsapfs_mapped_file_t *mapped_file = NULL;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_mapped_file_initialize(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_mapped_file_advise_will_need(
+	          mapped_file,
+	          0,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Advising does not change the access pattern of the whole mapping
+	 */
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "mapped_file->access_pattern",
+	 mapped_file->access_pattern,
+	 LIBFSAPFS_MAPPED_FILE_ADVICE_NORMAL );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_mapped_file_advise_will_need(
+	          NULL,
+	          0,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_mapped_file_advise_will_need(
+	          mapped_file,
+	          -1,
+	          4096,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_mapped_file_free(
+	          &mapped_file,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "mapped_file",
+	 mapped_file );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( mapped_file != NULL )
+	{
+		libfsapfs_mapped_file_free(
+		 &mapped_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	system_character_t *source = NULL;
+	system_integer_t option    = 0;
+
+	while( ( option = fsapfs_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "o:p:" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'o':
+			case (system_integer_t) 'p':
+				break;
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_mapped_file_initialize",
+	 fsapfs_test_mapped_file_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_mapped_file_free",
+	 fsapfs_test_mapped_file_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	FSAPFS_TEST_RUN_WITH_ARGS(
+	 "libfsapfs_mapped_file_open",
+	 fsapfs_test_mapped_file_open,
+	 source );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_mapped_file_close",
+	 fsapfs_test_mapped_file_close );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_mapped_file_get_data",
+	 fsapfs_test_mapped_file_get_data );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_mapped_file_set_access_pattern",
+	 fsapfs_test_mapped_file_set_access_pattern );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_mapped_file_advise_will_need",
+	 fsapfs_test_mapped_file_advise_will_need );
+
+#else
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( source )
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+}
+
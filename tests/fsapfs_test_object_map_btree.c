@@ -34,6 +34,7 @@
 #include "fsapfs_test_memory.h"
 #include "fsapfs_test_unused.h"
 
+#include "../libfsapfs/libfsapfs_io_handle.h"
 #include "../libfsapfs/libfsapfs_object_map_btree.h"
 
 uint8_t fsapfs_test_object_map_btree_data1[ 4096 ] = {
@@ -303,6 +304,7 @@ int fsapfs_test_object_map_btree_initialize(
      void )
 {
 	libcerror_error_t *error                       = NULL;
+	libfsapfs_io_handle_t *io_handle               = NULL;
 	libfsapfs_object_map_btree_t *object_map_btree = NULL;
 	int result                                     = 0;
 
@@ -312,12 +314,30 @@ int fsapfs_test_object_map_btree_initialize(
 	int test_number                                = 0;
 #endif
 
+	/* Initialize test
+	 */
+	result = libfsapfs_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test regular cases
 	 */
 	result = libfsapfs_object_map_btree_initialize(
 	          &object_map_btree,
-	          NULL,
-	          NULL,
+	          io_handle,
 	          0,
 	          &error );
 
@@ -354,7 +374,6 @@ int fsapfs_test_object_map_btree_initialize(
 	/* Test error cases
 	 */
 	result = libfsapfs_object_map_btree_initialize(
-	          NULL,
 	          NULL,
 	          NULL,
 	          0,
@@ -376,8 +395,7 @@ int fsapfs_test_object_map_btree_initialize(
 
 	result = libfsapfs_object_map_btree_initialize(
 	          &object_map_btree,
-	          NULL,
-	          NULL,
+	          io_handle,
 	          0,
 	          &error );
 
@@ -395,6 +413,24 @@ int fsapfs_test_object_map_btree_initialize(
 	libcerror_error_free(
 	 &error );
 
+	result = libfsapfs_object_map_btree_initialize(
+	          &object_map_btree,
+	          NULL,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
 #if defined( HAVE_FSAPFS_TEST_MEMORY )
 
 	for( test_number = 0;
@@ -407,8 +443,7 @@ int fsapfs_test_object_map_btree_initialize(
 
 		result = libfsapfs_object_map_btree_initialize(
 		          &object_map_btree,
-		          NULL,
-		          NULL,
+		          io_handle,
 		          0,
 		          &error );
 
@@ -452,8 +487,7 @@ int fsapfs_test_object_map_btree_initialize(
 
 		result = libfsapfs_object_map_btree_initialize(
 		          &object_map_btree,
-		          NULL,
-		          NULL,
+		          io_handle,
 		          0,
 		          &error );
 
@@ -489,6 +523,25 @@ int fsapfs_test_object_map_btree_initialize(
 	}
 #endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
 
+	/* Clean up
+	 */
+	result = libfsapfs_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -503,6 +556,12 @@ on_error:
 		 &object_map_btree,
 		 NULL );
 	}
+	if( io_handle != NULL )
+	{
+		libfsapfs_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
 	return( 0 );
 }
 
@@ -0,0 +1,406 @@
+/*
+ * Library password functions test program
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_password.h"
+
+/* The RFC 7914 PBKDF2-HMAC-SHA256 test vector 1
+ */
+uint8_t fsapfs_test_password_key1[ 64 ] = {
+	0x55, 0xac, 0x04, 0x6e, 0x56, 0xe3, 0x08, 0x9f, 0xec, 0x16, 0x91, 0xc2, 0x25, 0x44, 0xb6, 0x05,
+	0xf9, 0x41, 0x85, 0x21, 0x6d, 0xde, 0x04, 0x65, 0xe6, 0x8b, 0x9d, 0x57, 0xc2, 0x0d, 0xac, 0xbc,
+	0x49, 0xca, 0x9c, 0xcc, 0xf1, 0x79, 0xb6, 0x45, 0x99, 0x16, 0x64, 0xb3, 0x9d, 0x77, 0xef, 0x31,
+	0x7c, 0x71, 0xb8, 0x45, 0xb1, 0xe3, 0x0b, 0xd5, 0x09, 0x11, 0x20, 0x41, 0xd3, 0xa1, 0x97, 0x83 };
+
+/* The RFC 7914 PBKDF2-HMAC-SHA256 test vector 2 with 4096 iterations
+ */
+uint8_t fsapfs_test_password_key2[ 32 ] = {
+	0xc5, 0xe4, 0x78, 0xd5, 0x92, 0x88, 0xc8, 0x41, 0xaa, 0x53, 0x0d, 0xb6, 0x84, 0x5c, 0x4c, 0x8d,
+	0x96, 0x28, 0x93, 0xa0, 0x01, 0xce, 0x4e, 0x11, 0xa4, 0x96, 0x38, 0x73, 0xaa, 0x98, 0x13, 0x4a };
+
+/* A key that is not a multiple of the hash size
+ */
+uint8_t fsapfs_test_password_key3[ 40 ] = {
+	0x34, 0x8c, 0x89, 0xdb, 0xcb, 0xd3, 0x2b, 0x2f, 0x32, 0xd8, 0x14, 0xb8, 0x11, 0x6e, 0x84, 0xcf,
+	0x2b, 0x17, 0x34, 0x7e, 0xbc, 0x18, 0x00, 0x18, 0x1c, 0x4e, 0x2a, 0x1f, 0xb8, 0xdd, 0x53, 0xe1,
+	0xc6, 0x35, 0x51, 0x8c, 0x7d, 0xac, 0x47, 0xe9 };
+
+/* A key of a password that exceeds the HMAC block size
+ */
+uint8_t fsapfs_test_password_key4[ 20 ] = {
+	0x59, 0xbf, 0xa4, 0x97, 0x50, 0xdd, 0x54, 0x62, 0xce, 0x38, 0x37, 0x0a, 0x1e, 0x7a, 0xbe, 0x07,
+	0x36, 0xff, 0x33, 0x4c };
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Tests the libfsapfs_password_pbkdf2 function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_password_pbkdf2(
+     void )
+{
+	uint8_t key[ 64 ];
+	uint8_t password[ 100 ];
+
+	libcerror_error_t *error = NULL;
+	size_t password_index    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_password_pbkdf2(
+	          (uint8_t *) "passwd",
+	          6,
+	          (uint8_t *) "salt",
+	          4,
+	          1,
+	          key,
+	          64,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key,
+	          fsapfs_test_password_key1,
+	          64 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsapfs_password_pbkdf2(
+	          (uint8_t *) "password",
+	          8,
+	          (uint8_t *) "salt",
+	          4,
+	          4096,
+	          key,
+	          32,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key,
+	          fsapfs_test_password_key2,
+	          32 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfsapfs_password_pbkdf2(
+	          (uint8_t *) "passwordPASSWORDpassword",
+	          24,
+	          (uint8_t *) "saltSALTsaltSALTsaltSALTsaltSALTsalt",
+	          36,
+	          4096,
+	          key,
+	          40,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key,
+	          fsapfs_test_password_key3,
+	          40 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	for( password_index = 0;
+	     password_index < 100;
+	     password_index++ )
+	{
+		password[ password_index ] = (uint8_t) 'x';
+	}
+	result = libfsapfs_password_pbkdf2(
+	          password,
+	          100,
+	          (uint8_t *) "salt",
+	          4,
+	          3,
+	          key,
+	          20,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          key,
+	          fsapfs_test_password_key4,
+	          20 );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_password_pbkdf2(
+	          NULL,
+	          6,
+	          (uint8_t *) "salt",
+	          4,
+	          1,
+	          key,
+	          64,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_password_pbkdf2(
+	          (uint8_t *) "passwd",
+	          (size_t) SSIZE_MAX + 1,
+	          (uint8_t *) "salt",
+	          4,
+	          1,
+	          key,
+	          64,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_password_pbkdf2(
+	          (uint8_t *) "passwd",
+	          6,
+	          NULL,
+	          4,
+	          1,
+	          key,
+	          64,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_password_pbkdf2(
+	          (uint8_t *) "passwd",
+	          6,
+	          (uint8_t *) "salt",
+	          (size_t) SSIZE_MAX + 1,
+	          1,
+	          key,
+	          64,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_password_pbkdf2(
+	          (uint8_t *) "passwd",
+	          6,
+	          (uint8_t *) "salt",
+	          4,
+	          0,
+	          key,
+	          64,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_password_pbkdf2(
+	          (uint8_t *) "passwd",
+	          6,
+	          (uint8_t *) "salt",
+	          4,
+	          1,
+	          NULL,
+	          64,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_password_pbkdf2(
+	          (uint8_t *) "passwd",
+	          6,
+	          (uint8_t *) "salt",
+	          4,
+	          1,
+	          key,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_password_pbkdf2",
+	 fsapfs_test_password_pbkdf2 );
+
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,782 @@
+/*
+ * Library worker_pool type test program
+ *
+ * Copyright (C) 2018-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fsapfs_test_libcerror.h"
+#include "fsapfs_test_libfsapfs.h"
+#include "fsapfs_test_macros.h"
+#include "fsapfs_test_memory.h"
+#include "fsapfs_test_unused.h"
+
+#include "../libfsapfs/libfsapfs_worker_pool.h"
+
+#define FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS	8
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+/* Doubles the value of a job
+ * Job function of the worker pool used by the tests
+ * Returns 1 if successful or -1 on error
+ */
+int fsapfs_test_worker_pool_job_function(
+     int *value,
+     void *arguments FSAPFS_TEST_ATTRIBUTE_UNUSED )
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( arguments )
+
+	if( ( value == NULL )
+	 || ( *value < 0 ) )
+	{
+		return( -1 );
+	}
+	*value *= 2;
+
+	return( 1 );
+}
+
+/* Tests the libfsapfs_worker_pool_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_worker_pool_initialize(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsapfs_worker_pool_t *worker_pool = NULL;
+	int result                           = 0;
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+	int number_of_malloc_fail_tests      = 1;
+	int number_of_memset_fail_tests      = 1;
+	int test_number                      = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_worker_pool_initialize(
+	          &worker_pool,
+	          4,
+	          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+	          (int (*)(intptr_t *, void *)) &fsapfs_test_worker_pool_job_function,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "worker_pool",
+	 worker_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfsapfs_worker_pool_free(
+	          &worker_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "worker_pool",
+	 worker_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_worker_pool_initialize(
+	          NULL,
+	          4,
+	          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+	          (int (*)(intptr_t *, void *)) &fsapfs_test_worker_pool_job_function,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	worker_pool = (libfsapfs_worker_pool_t *) 0x12345678UL;
+
+	result = libfsapfs_worker_pool_initialize(
+	          &worker_pool,
+	          4,
+	          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+	          (int (*)(intptr_t *, void *)) &fsapfs_test_worker_pool_job_function,
+	          NULL,
+	          &error );
+
+	worker_pool = NULL;
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_worker_pool_initialize(
+	          &worker_pool,
+	          0,
+	          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+	          (int (*)(intptr_t *, void *)) &fsapfs_test_worker_pool_job_function,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "worker_pool",
+	 worker_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_worker_pool_initialize(
+	          &worker_pool,
+	          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS + 1,
+	          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+	          (int (*)(intptr_t *, void *)) &fsapfs_test_worker_pool_job_function,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "worker_pool",
+	 worker_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_worker_pool_initialize(
+	          &worker_pool,
+	          4,
+	          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "worker_pool",
+	 worker_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FSAPFS_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_worker_pool_initialize with malloc failing
+		 */
+		fsapfs_test_malloc_attempts_before_fail = test_number;
+
+		result = libfsapfs_worker_pool_initialize(
+		          &worker_pool,
+		          4,
+		          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+		          (int (*)(intptr_t *, void *)) &fsapfs_test_worker_pool_job_function,
+		          NULL,
+		          &error );
+
+		if( fsapfs_test_malloc_attempts_before_fail != -1 )
+		{
+			fsapfs_test_malloc_attempts_before_fail = -1;
+
+			if( worker_pool != NULL )
+			{
+				libfsapfs_worker_pool_free(
+				 &worker_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "worker_pool",
+			 worker_pool );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfsapfs_worker_pool_initialize with memset failing
+		 */
+		fsapfs_test_memset_attempts_before_fail = test_number;
+
+		result = libfsapfs_worker_pool_initialize(
+		          &worker_pool,
+		          4,
+		          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+		          (int (*)(intptr_t *, void *)) &fsapfs_test_worker_pool_job_function,
+		          NULL,
+		          &error );
+
+		if( fsapfs_test_memset_attempts_before_fail != -1 )
+		{
+			fsapfs_test_memset_attempts_before_fail = -1;
+
+			if( worker_pool != NULL )
+			{
+				libfsapfs_worker_pool_free(
+				 &worker_pool,
+				 NULL );
+			}
+		}
+		else
+		{
+			FSAPFS_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FSAPFS_TEST_ASSERT_IS_NULL(
+			 "worker_pool",
+			 worker_pool );
+
+			FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FSAPFS_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( worker_pool != NULL )
+	{
+		libfsapfs_worker_pool_free(
+		 &worker_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_worker_pool_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_worker_pool_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfsapfs_worker_pool_free(
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_worker_pool_get_number_of_workers function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_worker_pool_get_number_of_workers(
+     void )
+{
+	libcerror_error_t *error             = NULL;
+	libfsapfs_worker_pool_t *worker_pool = NULL;
+	int number_of_workers                = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_worker_pool_initialize(
+	          &worker_pool,
+	          4,
+	          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+	          (int (*)(intptr_t *, void *)) &fsapfs_test_worker_pool_job_function,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "worker_pool",
+	 worker_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfsapfs_worker_pool_get_number_of_workers(
+	          worker_pool,
+	          &number_of_workers,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+#if defined( HAVE_LIBFSAPFS_MULTI_THREAD_SUPPORT )
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_workers",
+	 number_of_workers,
+	 4 );
+#else
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "number_of_workers",
+	 number_of_workers,
+	 1 );
+#endif
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_worker_pool_get_number_of_workers(
+	          NULL,
+	          &number_of_workers,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_worker_pool_get_number_of_workers(
+	          worker_pool,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_worker_pool_free(
+	          &worker_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "worker_pool",
+	 worker_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( worker_pool != NULL )
+	{
+		libfsapfs_worker_pool_free(
+		 &worker_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfsapfs_worker_pool_run_jobs function
+ * Returns 1 if successful or 0 if not
+ */
+int fsapfs_test_worker_pool_run_jobs(
+     void )
+{
+	libfsapfs_worker_pool_job_t jobs[ 4 ];
+	int values[ 4 ];
+
+	libcerror_error_t *error             = NULL;
+	libfsapfs_worker_pool_t *worker_pool = NULL;
+	int job_index                        = 0;
+	int result                           = 0;
+
+	/* Initialize test
+	 */
+	result = libfsapfs_worker_pool_initialize(
+	          &worker_pool,
+	          4,
+	          FSAPFS_TEST_WORKER_POOL_MAXIMUM_NUMBER_OF_WORKERS,
+	          (int (*)(intptr_t *, void *)) &fsapfs_test_worker_pool_job_function,
+	          NULL,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "worker_pool",
+	 worker_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	for( job_index = 0;
+	     job_index < 4;
+	     job_index++ )
+	{
+		values[ job_index ]      = job_index + 1;
+		jobs[ job_index ].value  = (intptr_t *) &( values[ job_index ] );
+		jobs[ job_index ].result = 0;
+	}
+	result = libfsapfs_worker_pool_run_jobs(
+	          worker_pool,
+	          jobs,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( job_index = 0;
+	     job_index < 4;
+	     job_index++ )
+	{
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "values[ job_index ]",
+		 values[ job_index ],
+		 2 * ( job_index + 1 ) );
+
+		FSAPFS_TEST_ASSERT_EQUAL_INT(
+		 "jobs[ job_index ].result",
+		 jobs[ job_index ].result,
+		 1 );
+	}
+	result = libfsapfs_worker_pool_run_jobs(
+	          worker_pool,
+	          jobs,
+	          0,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a job that fails, which is also waited for when it was queued
+	 */
+	for( job_index = 0;
+	     job_index < 4;
+	     job_index++ )
+	{
+		values[ job_index ] = job_index + 1;
+	}
+	values[ 3 ] = -1;
+
+	result = libfsapfs_worker_pool_run_jobs(
+	          worker_pool,
+	          jobs,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "jobs[ 3 ].result",
+	 jobs[ 3 ].result,
+	 -1 );
+
+	/* Test error cases
+	 */
+	result = libfsapfs_worker_pool_run_jobs(
+	          NULL,
+	          jobs,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_worker_pool_run_jobs(
+	          worker_pool,
+	          NULL,
+	          4,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfsapfs_worker_pool_run_jobs(
+	          worker_pool,
+	          jobs,
+	          -1,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FSAPFS_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfsapfs_worker_pool_free(
+	          &worker_pool,
+	          &error );
+
+	FSAPFS_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "worker_pool",
+	 worker_pool );
+
+	FSAPFS_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( worker_pool != NULL )
+	{
+		libfsapfs_worker_pool_free(
+		 &worker_pool,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FSAPFS_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FSAPFS_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argc )
+	FSAPFS_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_worker_pool_initialize",
+	 fsapfs_test_worker_pool_initialize );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_worker_pool_free",
+	 fsapfs_test_worker_pool_free );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_worker_pool_get_number_of_workers",
+	 fsapfs_test_worker_pool_get_number_of_workers );
+
+	FSAPFS_TEST_RUN(
+	 "libfsapfs_worker_pool_run_jobs",
+	 fsapfs_test_worker_pool_run_jobs );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFSAPFS_DLL_IMPORT ) */
+}
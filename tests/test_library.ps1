@@ -1,7 +1,7 @@
 # Tests library functions and types.
 
-$LibraryTests = "bit_stream btree_entry btree_footer btree_node btree_node_header buffer_data_handle checkpoint_map checkpoint_map_entry checksum chunk_information_block container_data_handle container_key_bag container_reaper container_superblock compressed_data_handle compression data_block data_block_data_handle data_stream deflate directory_record encryption_context error extended_attribute extent_reference_tree file_entry file_extent file_system file_system_btree file_system_data_handle fusion_middle_tree huffman_tree inode io_handle key_bag_entry key_bag_header key_encrypted_key name name_hash notify object object_map object_map_btree object_map_descriptor profiler snapshot snapshot_metadata snapshot_metadata_tree space_manager volume volume_key_bag"
-$LibraryTestsWithInput = "container support"
+$LibraryTests = "address_table bit_stream block_reader btree_entry btree_footer btree_node btree_node_header buffer_data_handle buffer_pool cache_statistics checkpoint_map checkpoint_map_entry checksum chunk_information_block container_data_handle container_key_bag container_reaper container_superblock compressed_data_handle compression data_block data_block_data_handle data_stream decompressed_data_cache decompression_pool decryption_pool deflate directory_record encryption_context error extended_attribute extent_reference_tree file_entry file_extent file_system file_system_btree file_system_data_handle fusion_middle_tree huffman_tree inode io_handle key_bag_entry key_bag_header key_encrypted_key mapped_file name name_hash node_cache notify object object_map object_map_btree object_map_descriptor password profiler sha256 snapshot snapshot_metadata snapshot_metadata_tree space_manager volume volume_key_bag worker_pool"
+$LibraryTestsWithInput = "container mapped_file support"
 $OptionSets = "offset password" -split " "
 
 . .\test_functions.ps1